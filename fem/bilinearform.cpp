@@ -823,6 +823,146 @@ void BilinearForm::AssembleDiagonal(Vector &diag) const
    cP->AbsMultTranspose(local_diag, diag);
 }
 
+void BilinearForm::AssembleLocalBlockDiagonal(Vector &cols) const
+{
+   if (ext)
+   {
+      ext->AssembleBlockDiagonal(cols);
+      return;
+   }
+   MFEM_ASSERT(mat, "the BilinearForm is not assembled!");
+   MFEM_VERIFY(mat->Height() == fes->GetVSize(),
+               "the local matrix is not available after conforming assembly");
+   GetBlockDiagonalColumns(*mat, cols);
+}
+
+void BilinearForm::GetBlockDiagonalColumns(const SparseMatrix &A,
+                                           Vector &cols) const
+{
+   const int vdim = fes->GetVDim();
+   const int n = A.Height();
+   const int nn = n / vdim;
+   const bool byNODES = fes->GetOrdering() == Ordering::byNODES;
+   cols.SetSize(vdim*n);
+   real_t *h_cols = cols.HostWrite();
+   for (int i = 0; i < n; i++)
+   {
+      const int node = byNODES ? i % nn : i / vdim;
+      for (int c = 0; c < vdim; c++)
+      {
+         const int j = byNODES ? c*nn + node : node*vdim + c;
+         h_cols[c*n + i] = A.Elem(i, j);
+      }
+   }
+}
+
+void BilinearForm::BlockDiagonalFromColumns(const Vector &cols,
+                                            DenseTensor &blocks,
+                                            Array<int> &block_dofs) const
+{
+   const int vdim = fes->GetVDim();
+   const int n = cols.Size() / vdim;
+   const int nn = n / vdim;
+   const bool byNODES = fes->GetOrdering() == Ordering::byNODES;
+   blocks.SetSize(vdim, vdim, nn);
+   block_dofs.SetSize(n);
+   const real_t *h_cols = cols.HostRead();
+   for (int k = 0; k < nn; k++)
+   {
+      for (int r = 0; r < vdim; r++)
+      {
+         const int i = byNODES ? r*nn + k : k*vdim + r;
+         block_dofs[r + vdim*k] = i;
+         for (int c = 0; c < vdim; c++)
+         {
+            blocks(r, c, k) = h_cols[c*n + i];
+         }
+      }
+   }
+}
+
+void BilinearForm::AssembleBlockDiagonal(DenseTensor &blocks,
+                                         Array<int> &block_dofs) const
+{
+   const SparseMatrix *cP = fes->GetConformingProlongation();
+   Vector cols;
+   if (!ext)
+   {
+      MFEM_ASSERT(mat, "the BilinearForm is not assembled!");
+      MFEM_ASSERT(cP == nullptr || mat->Height() == cP->Width(),
+                  "BilinearForm::ConformingAssemble() is not called!");
+      GetBlockDiagonalColumns(*mat, cols);
+   }
+   else if (!cP)
+   {
+      ext->AssembleBlockDiagonal(cols);
+   }
+   else
+   {
+      // As in AssembleDiagonal(), the columns are reduced with |P^T|.
+      const int vdim = fes->GetVDim();
+      const int n = cP->Height(), m = cP->Width();
+      Vector local_cols;
+      ext->AssembleBlockDiagonal(local_cols);
+      cols.SetSize(vdim*m);
+      for (int c = 0; c < vdim; c++)
+      {
+         Vector lc, tc;
+         lc.MakeRef(local_cols, c*n, n);
+         tc.MakeRef(cols, c*m, m);
+         cP->AbsMultTranspose(lc, tc);
+         tc.SyncAliasMemory(cols);
+      }
+   }
+   BlockDiagonalFromColumns(cols, blocks, block_dofs);
+}
+
+void BilinearForm::AssembleElementBlockDiagonal(DenseTensor &blocks,
+                                                Array<int> &block_dofs)
+{
+   MFEM_VERIFY(fes->IsDGSpace(), "a discontinuous space is required");
+#ifdef MFEM_USE_MPI
+   MFEM_VERIFY(dynamic_cast<ParFiniteElementSpace*>(fes) == nullptr,
+               "not supported in parallel");
+#endif
+   const int ne = fes->GetNE();
+   if (auto *ea_ext = dynamic_cast<EABilinearFormExtension*>(ext.get()))
+   {
+      ea_ext->GetElementMatrices(blocks, ElementDofOrdering::NATIVE, true);
+   }
+   else if (ext)
+   {
+      // The element blocks are computed with a temporary EA extension.
+      EABilinearFormExtension ea_ext(this);
+      ea_ext.Assemble();
+      ea_ext.GetElementMatrices(blocks, ElementDofOrdering::NATIVE, true);
+   }
+   else
+   {
+      MFEM_ASSERT(mat, "the BilinearForm is not assembled!");
+      blocks.SetSize(0, 0, ne);
+      for (int e = 0; e < ne; e++)
+      {
+         fes->GetElementVDofs(e, vdofs);
+         if (e == 0) { blocks.SetSize(vdofs.Size(), vdofs.Size(), ne); }
+         mat->GetSubMatrix(vdofs, vdofs, blocks(e));
+      }
+   }
+   block_dofs.SetSize(0);
+   for (int e = 0; e < ne; e++)
+   {
+      fes->GetElementVDofs(e, vdofs);
+      block_dofs.Append(vdofs);
+   }
+}
+
+OperatorCostModel BilinearForm::GetCostModel() const
+{
+   if (ext) { return ext->GetCostModel(); }
+   MFEM_VERIFY(mat, "the BilinearForm is not assembled!");
+   return FABilinearFormExtension::SparseMatrixCostModel(*mat);
+}
+
 void BilinearForm::FormLinearSystem(const Array<int> &ess_tdof_list, Vector &x,
                                     Vector &b, OperatorHandle &A, Vector &X,
                                     Vector &B, int copy_interior)
@@ -144,6 +144,23 @@ protected:
        BilinearForm becomes an operator on the conforming FE space. */
    void ConformingAssemble();
 
+   /** @brief Assemble the vdim columns of the nodal block diagonal before
+       applying conforming/parallel assembly, see AssembleBlockDiagonal().
+
+       Column c is stored in entries [c*n, (c+1)*n) of @a cols, where n is the
+       local vector size of the FE space. Entry i of column c is the matrix
+       entry coupling the vdof i with component c of the same node. */
+   void AssembleLocalBlockDiagonal(Vector &cols) const;
+
+   /// Extract the vdim columns of the nodal block diagonal of @a A.
+   /** The layout of @a cols is the one of AssembleLocalBlockDiagonal(). */
+   void GetBlockDiagonalColumns(const SparseMatrix &A, Vector &cols) const;
+
+   /** @brief Convert the true-dof columns @a cols of the nodal block diagonal
+       into the output format of AssembleBlockDiagonal(). */
+   void BlockDiagonalFromColumns(const Vector &cols, DenseTensor &blocks,
+                                 Array<int> &block_dofs) const;
+
    /// may be used in the construction of derived classes
    BilinearForm() : Matrix (0)
    {
@@ -458,6 +475,44 @@ public:
        case. */
    void AssembleDiagonal(Vector &diag) const override;
 
+   /** @brief Assemble the vdim x vdim blocks of the true-dof matrix that
+       couple the vector components of each node.
+
+       On return, @a blocks has dimensions vdim x vdim x n, where n is the
+       number of true dofs divided by vdim, and @a block_dofs has size vdim*n.
+       Entry (r, c, k) of @a blocks is the matrix entry in row
+       block_dofs[r + vdim*k] and column block_dofs[c + vdim*k]. For scalar
+       spaces, this is the same as AssembleDiagonal().
+
+       As with AssembleDiagonal(), when the AssemblyLevel is not LEGACY and
+       the mesh has hanging nodes, the blocks are approximated with |P^T|. */
+   virtual void AssembleBlockDiagonal(DenseTensor &blocks,
+                                      Array<int> &block_dofs) const;
+
+   /** @brief Assemble the diagonal blocks of the matrix corresponding to the
+       degrees of freedom of each element, for discontinuous spaces.
+
+       On return, @a blocks has dimensions m x m x NE, where m is the number of
+       vector dofs per element, and @a block_dofs contains the concatenated
+       element vdofs, as returned by FiniteElementSpace::GetElementVDofs().
+       The face terms coupling the dofs of an element with themselves are
+       included. Only supported in serial. */
+   void AssembleElementBlockDiagonal(DenseTensor &blocks,
+                                     Array<int> &block_dofs);
+
+   /** @brief Estimate the storage, the memory traffic and the floating point
+       operations of one Mult() with the assembled operator.
+
+       The estimate depends on the AssemblyLevel: partially assembled forms sum
+       the models of their integrators, see
+       BilinearFormIntegrator::GetCostModelPA(), element assembled forms count
+       the batched element matrices, and fully assembled (or LEGACY) forms
+       count the CSR matrix. Comparing OperatorCostModel::bytes_per_apply and
+       OperatorCostModel::flops_per_apply with the measured time of Mult()
+       gives the achieved bandwidth and flop rate. The form must be assembled.
+       The prolongation of conforming spaces is not included. */
+   OperatorCostModel GetCostModel() const;
+
    /// Get the finite element space prolongation operator.
    const Operator *GetProlongation() const override
    { return fes->GetConformingProlongation(); }
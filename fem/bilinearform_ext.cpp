@@ -38,6 +38,29 @@ const Operator *BilinearFormExtension::GetRestriction() const
    return a->GetRestriction();
 }
 
+OperatorCostModel BilinearFormExtension::GetCostModel() const
+{
+   OperatorCostModel cost;
+   cost.complete = false;
+   return cost;
+}
+
+// Compulsory traffic of the gather (Mult) and of the scatter-add
+// (MultTranspose) performed by the element restriction R in one application.
+static OperatorCostModel ElementRestrictionCostModel(const Operator &R)
+{
+   OperatorCostModel cost;
+   cost.bytes_per_apply = 2.0*sizeof(real_t)*(R.Width() + R.Height());
+   if (auto *er = dynamic_cast<const ElementRestriction*>(&R))
+   {
+      cost.stored_bytes = sizeof(int)*(er->Offsets().Size() +
+                                       er->Indices().Size() +
+                                       er->GatherMap().Size());
+      cost.bytes_per_apply += cost.stored_bytes;
+   }
+   return cost;
+}
+
 // Data and methods for partially-assembled bilinear forms
 MFBilinearFormExtension::MFBilinearFormExtension(BilinearForm *form)
    : BilinearFormExtension(form),
@@ -51,6 +74,17 @@ MFBilinearFormExtension::MFBilinearFormExtension(BilinearForm *form)
 
 void MFBilinearFormExtension::Assemble()
 {
+   // Without libCEED, the matrix-free domain integrators act on E-vectors
+   const Mesh &mesh = *trial_fes->GetMesh();
+   if (!DeviceCanUseCeed() && mesh.GetNumGeometries(mesh.Dimension()) <= 1)
+   {
+      elem_restrict =
+         trial_fes->GetElementRestriction(GetEVectorOrdering(*trial_fes));
+      localX.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
+      localY.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
+      localY.UseDevice(true); // ensure 'localY = 0.0' is done on device
+   }
+
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
    const int integratorCount = integrators.Size();
    for (int i = 0; i < integratorCount; ++i)
@@ -256,8 +290,13 @@ PABilinearFormExtension::PABilinearFormExtension(BilinearForm *form)
 void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
 {
    if ( Device::Allows(Backend::CEED_MASK) ) { return; }
+   // On mixed-geometry meshes, the domain integrators act on L-vectors and
+   // group the elements by geometry internally, see PAElementGroup.
+   const Mesh &fes_mesh = *trial_fes->GetMesh();
+   const bool mixed = fes_mesh.GetNumGeometries(fes_mesh.Dimension()) > 1;
    ElementDofOrdering ordering = GetEVectorOrdering(*a->FESpace());
-   elem_restrict = trial_fes->GetElementRestriction(ordering);
+   elem_restrict = mixed ? nullptr :
+                   trial_fes->GetElementRestriction(ordering);
    if (elem_restrict)
    {
       localX.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
@@ -334,6 +373,15 @@ void PABilinearFormExtension::Assemble()
    SetupRestrictionOperators(L2FaceValues::DoubleValued);
 
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   const Mesh &mesh = *a->FESpace()->GetMesh();
+   if (mesh.GetNumGeometries(mesh.Dimension()) > 1 && !DeviceCanUseCeed())
+   {
+      for (Array<int> *markers : *a->GetDBFI_Marker())
+      {
+         MFEM_VERIFY(markers == nullptr, "Domain attribute markers are not "
+                     "supported on mixed-geometry meshes");
+      }
+   }
    for (BilinearFormIntegrator *integ : integrators)
    {
       if (integ->Patchwise())
@@ -367,6 +415,31 @@ void PABilinearFormExtension::Assemble()
    }
 }
 
+// Zero the entries of the E-vector @a d associated with the elements whose
+// attribute is not marked in @a markers (if non-null).
+static void ZeroUnmarkedEntries(const Array<int> *markers,
+                                const Array<int> &attributes,
+                                Vector &d)
+{
+   if (!markers) { return; }
+   const int ne = attributes.Size();
+   const int nd = d.Size() / ne;
+   const auto d_attr = Reshape(attributes.Read(), ne);
+   const auto d_m = Reshape(markers->Read(), markers->Size());
+   auto d_d = Reshape(d.ReadWrite(), nd, ne);
+   mfem::forall(ne, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int attr = d_attr[e];
+      if (attr <= 0 || d_m[attr - 1] == 0)
+      {
+         for (int i = 0; i < nd; ++i)
+         {
+            d_d(i, e) = 0.0;
+         }
+      }
+   });
+}
+
 void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
 {
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
@@ -377,29 +450,25 @@ void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
                                              Vector &d)
    {
       integ.AssembleDiagonalPA(d);
-      if (markers)
-      {
-         const int ne = attributes.Size();
-         const int nd = d.Size() / ne;
-         const auto d_attr = Reshape(attributes.Read(), ne);
-         const auto d_m = Reshape(markers->Read(), markers->Size());
-         auto d_d = Reshape(d.ReadWrite(), nd, ne);
-         mfem::forall(ne, [=] MFEM_HOST_DEVICE (int e)
-         {
-            const int attr = d_attr[e];
-            if (attr <= 0 || d_m[attr - 1] == 0)
-            {
-               for (int i = 0; i < nd; ++i)
-               {
-                  d_d(i, e) = 0.0;
-               }
-            }
-         });
-      }
+      ZeroUnmarkedEntries(markers, attributes, d);
    };
 
    const int iSz = integrators.Size();
-   if (elem_restrict && !DeviceCanUseCeed())
+   bool allPatchwise = iSz > 0;
+   for (int i = 0; i < iSz; ++i)
+   {
+      allPatchwise = allPatchwise && integrators[i]->Patchwise();
+   }
+   if (allPatchwise)
+   {
+      y.UseDevice(true);
+      y = 0.0;
+      for (int i = 0; i < iSz; ++i)
+      {
+         integrators[i]->AssembleDiagonalNURBSPA(y);
+      }
+   }
+   else if (elem_restrict && !DeviceCanUseCeed())
    {
       if (iSz > 0)
       {
@@ -453,6 +522,101 @@ void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
    }
 }
 
+void PABilinearFormExtension::AssembleBlockDiagonal(Vector &blocks) const
+{
+   const FiniteElementSpace &fes = *a->FESpace();
+   const int vdim = fes.GetVDim();
+   const int vsize = fes.GetVSize();
+   blocks.SetSize(vsize * vdim);
+   blocks.UseDevice(true);
+   if (vdim == 1)
+   {
+      AssembleDiagonal(blocks);
+      return;
+   }
+
+   MFEM_VERIFY(elem_restrict && !DeviceCanUseCeed(),
+               "AssembleBlockDiagonal requires an element restriction and is"
+               " not supported with libCEED.");
+   MFEM_VERIFY(a->GetBBFI()->Size() == 0 && a->GetFBFI()->Size() == 0 &&
+               a->GetBFBFI()->Size() == 0,
+               "AssembleBlockDiagonal only supports domain integrators.");
+
+   // E-vector of the blocks, with layout (nd, vdim, vdim, ne)
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   const int esize = localY.Size();
+   Vector eblocks(esize * vdim);
+   eblocks.UseDevice(true);
+   eblocks = 0.0;
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      if (elem_markers[i])
+      {
+         tmp_evec.SetSize(eblocks.Size());
+         tmp_evec.UseDevice(true);
+         tmp_evec = 0.0;
+         integrators[i]->AssembleBlockDiagonalPA(tmp_evec);
+         ZeroUnmarkedEntries(elem_markers[i], *elem_attributes, tmp_evec);
+         eblocks += tmp_evec;
+      }
+      else
+      {
+         integrators[i]->AssembleBlockDiagonalPA(eblocks);
+      }
+   }
+
+   // Each column of the blocks is an E-vector, assembled as an L-vector. The
+   // entries of the blocks only couple the components of the same dof, so the
+   // orientation signs cancel out, as for the diagonal.
+   const ElementRestriction *H1elem_restrict =
+      dynamic_cast<const ElementRestriction*>(elem_restrict);
+   const int ne = elem_attributes->Size();
+   const int nd = (ne > 0) ? esize / (vdim * ne) : 0;
+   for (int c = 0; c < vdim; ++c)
+   {
+      const int vd = vdim;
+      const auto d_eblocks = Reshape(eblocks.Read(), nd, vd, vd, ne);
+      auto d_localY = Reshape(localY.Write(), nd, vd, ne);
+      mfem::forall(esize, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int i = idx % nd;
+         const int r = (idx / nd) % vd;
+         const int e = idx / (nd * vd);
+         d_localY(i, r, e) = d_eblocks(i, r, c, e);
+      });
+      Vector col(blocks, c * vsize, vsize);
+      if (H1elem_restrict)
+      {
+         H1elem_restrict->AbsMultTranspose(localY, col);
+      }
+      else
+      {
+         elem_restrict->MultTranspose(localY, col);
+      }
+      col.SyncAliasMemory(blocks);
+   }
+}
+
+OperatorCostModel PABilinearFormExtension::GetCostModel() const
+{
+   OperatorCostModel cost;
+   for (BilinearFormIntegrator *integ : *a->GetDBFI())
+   {
+      cost += integ->GetCostModelPA();
+   }
+   if (a->GetBBFI()->Size() > 0 || a->GetFBFI()->Size() > 0 ||
+       a->GetBFBFI()->Size() > 0)
+   {
+      cost.complete = false;
+   }
+   if (elem_restrict && !DeviceCanUseCeed())
+   {
+      cost += ElementRestrictionCostModel(*elem_restrict);
+   }
+   return cost;
+}
+
 void PABilinearFormExtension::Update()
 {
    FiniteElementSpace *fes = a->FESpace();
@@ -1010,6 +1174,33 @@ void EABilinearFormExtension::Assemble()
    }
 }
 
+OperatorCostModel EABilinearFormExtension::GetCostModel() const
+{
+   if (ea_data.Size() == 0) { return BilinearFormExtension::GetCostModel(); }
+   OperatorCostModel cost;
+   // Each element matrix is read once, the E-vectors are read (x) and updated
+   // (y), and each entry contributes one multiply-add.
+   const real_t evec_size = real_t(ne)*elemDofs;
+   cost.stored_bytes = sizeof(real_t)*ea_data.Size();
+   cost.bytes_per_apply = cost.stored_bytes + 3.0*sizeof(real_t)*evec_size;
+   cost.flops_per_apply = 2.0*ea_data.Size();
+   const int face_size = ea_data_int.Size() + ea_data_ext.Size() +
+                         ea_data_bdr.Size();
+   if (!factorize_face_terms && face_size > 0)
+   {
+      // The traffic of the face restrictions is not included.
+      cost.stored_bytes += sizeof(real_t)*face_size;
+      cost.bytes_per_apply += sizeof(real_t)*face_size;
+      cost.flops_per_apply += 2.0*face_size;
+      cost.complete = false;
+   }
+   if (elem_restrict && !DeviceCanUseCeed())
+   {
+      cost += ElementRestrictionCostModel(*elem_restrict);
+   }
+   return cost;
+}
+
 void EABilinearFormExtension::MultInternal(const Vector &x, Vector &y,
                                            const bool useTranspose,
                                            const bool useAbs) const
@@ -1315,7 +1506,9 @@ void EABilinearFormExtension::GetElementMatrices(
       });
    }
 
-   if (add_bdr && ea_data_bdr.Size() > 0)
+   // With factorized face terms, the boundary face matrices are already
+   // included in the element matrices.
+   if (add_bdr && !factorize_face_terms && ea_data_bdr.Size() > 0)
    {
       const int ndof_face = faceDofs;
       const auto d_ea_bdr = Reshape(ea_data_bdr.Read(),
@@ -1353,7 +1546,7 @@ void EABilinearFormExtension::GetElementMatrices(
       const auto d_face_maps = Reshape(face_maps.Read(), ndof_face, n_faces_per_el);
       const auto d_face_info = Reshape(face_info.Read(), 2, nf_bdr);
 
-      const bool reorder = (ordering == ElementDofOrdering::NATIVE);
+      const bool reorder = (d_dof_map != nullptr);
 
       mfem::forall_2D(nf_bdr, ndof_face, ndof_face, [=] MFEM_HOST_DEVICE (int f)
       {
@@ -1365,22 +1558,18 @@ void EABilinearFormExtension::GetElementMatrices(
             // Convert from lexicographic face DOF to volume DOF
             const int i_lex = d_face_maps(i_lex_face, lf_i);
 
-            const int ii_s = d_dof_map[i_lex];
-            const int ii = (ii_s >= 0) ? ii_s : -1 - ii_s;
-
-            const int i = reorder ? ii : i_lex;
-            const int s_i = (ii_s < 0 && reorder) ? -1 : 1;
+            const int ii_s = reorder ? d_dof_map[i_lex] : i_lex;
+            const int i = (ii_s >= 0) ? ii_s : -1 - ii_s;
+            const int s_i = (ii_s >= 0) ? 1 : -1;
 
             MFEM_FOREACH_THREAD(j_lex_face, y, ndof_face)
             {
                // Convert from lexicographic face DOF to volume DOF
                const int j_lex = d_face_maps(j_lex_face, lf_i);
 
-               const int jj_s = d_dof_map[j_lex];
-               const int jj = (jj_s >= 0) ? jj_s : -1 - jj_s;
-
-               const int j = reorder ? jj : j_lex;
-               const int s_j = (jj_s < 0 && reorder) ? -1 : 1;
+               const int jj_s = reorder ? d_dof_map[j_lex] : j_lex;
+               const int j = (jj_s >= 0) ? jj_s : -1 - jj_s;
+               const int s_j = (jj_s >= 0) ? 1 : -1;
 
                AtomicAdd(d_element_matrices(i, j, e),
                          s_i*s_j*d_ea_bdr(i_lex_face, j_lex_face, f));
@@ -1517,6 +1706,26 @@ void FABilinearFormExtension::Assemble()
 }
 
 
+OperatorCostModel FABilinearFormExtension::GetCostModel() const
+{
+   if (!mat) { return BilinearFormExtension::GetCostModel(); }
+   return SparseMatrixCostModel(*mat);
+}
+
+OperatorCostModel FABilinearFormExtension::SparseMatrixCostModel(
+   const SparseMatrix &A)
+{
+   OperatorCostModel cost;
+   // Values and column indices, row offsets, and the input and output vectors.
+   const real_t nnz = A.NumNonZeroElems();
+   cost.stored_bytes = nnz*(sizeof(real_t) + sizeof(int)) +
+                       (A.Height() + 1.0)*sizeof(int);
+   cost.bytes_per_apply = cost.stored_bytes +
+                          sizeof(real_t)*(A.Width() + A.Height());
+   cost.flops_per_apply = 2.0*nnz;
+   return cost;
+}
+
 void FABilinearFormExtension::RAP(OperatorHandle &A)
 {
 #ifdef MFEM_USE_MPI
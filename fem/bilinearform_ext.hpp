@@ -22,6 +22,7 @@ namespace mfem
 class BilinearForm;
 class MixedBilinearForm;
 class DiscreteLinearOperator;
+struct OperatorCostModel;
 
 /// Class extending the BilinearForm class to support different AssemblyLevels.
 /**  FA - Full Assembly
@@ -54,6 +55,24 @@ public:
       MFEM_ABORT("AssembleDiagonal not implemented for this assembly level!");
    }
 
+   /** @brief Assemble the blocks coupling the vector components of each dof,
+       see BilinearForm::AssembleBlockDiagonal().
+
+       The result is stored as vdim L-vectors: the entry of @a blocks at index
+       c*VSize + vdof(i, r) is the coupling between the components c (trial)
+       and r (test) of the dof i. */
+   virtual void AssembleBlockDiagonal(Vector &blocks) const
+   {
+      MFEM_ABORT("AssembleBlockDiagonal not implemented for this assembly"
+                 " level!");
+   }
+
+   /** @brief Estimate the storage, memory traffic and flops of one Mult() of
+       the assembled operator, see BilinearForm::GetCostModel().
+
+       The default implementation returns an empty, incomplete model. */
+   virtual OperatorCostModel GetCostModel() const;
+
    virtual void FormSystemMatrix(const Array<int> &ess_tdof_list,
                                  OperatorHandle &A) = 0;
    virtual void FormLinearSystem(const Array<int> &ess_tdof_list,
@@ -86,6 +105,11 @@ public:
 
    void Assemble() override;
    void AssembleDiagonal(Vector &diag) const override;
+   void AssembleBlockDiagonal(Vector &blocks) const override;
+   /** @brief Sum of the models of the domain integrators, see
+       BilinearFormIntegrator::GetCostModelPA(), and of the element
+       restriction. Face and boundary integrators make the model incomplete. */
+   OperatorCostModel GetCostModel() const override;
    void FormSystemMatrix(const Array<int> &ess_tdof_list,
                          OperatorHandle &A) override;
    void FormLinearSystem(const Array<int> &ess_tdof_list,
@@ -161,6 +185,9 @@ public:
 
    void Assemble() override;
 
+   /// Cost of the batched element (and face) matrix-vector products.
+   OperatorCostModel GetCostModel() const override;
+
    void Mult(const Vector &x, Vector &y) const override
    { MultInternal(x, y, false); }
    void AbsMult(const Vector &x, Vector &y) const override
@@ -197,6 +224,10 @@ public:
    FABilinearFormExtension(BilinearForm *form);
 
    void Assemble() override;
+   /// Cost of the CSR matrix-vector product with the assembled matrix.
+   OperatorCostModel GetCostModel() const override;
+   /// Cost of the matrix-vector product with the CSR matrix @a A.
+   static OperatorCostModel SparseMatrixCostModel(const SparseMatrix &A);
    void RAP(OperatorHandle &A);
    /** @note Always does `DIAG_ONE` policy to be consistent with
        `Operator::FormConstrainedSystemOperator`. */
@@ -12,6 +12,7 @@
 // Implementation of Bilinear Form Integrators
 
 #include "fem.hpp"
+#include "../general/forall.hpp"
 #include <cmath>
 #include <algorithm>
 #include <memory>
@@ -21,6 +22,111 @@ using namespace std;
 namespace mfem
 {
 
+void BilinearFormIntegrator::SetupPAElementGroups(
+   const FiniteElementSpace &fes)
+{
+   MFEM_VERIFY(fes.GetVDim() == 1 && !fes.IsVariableOrder(),
+               "Only scalar, fixed-order spaces are supported.");
+   Mesh &mesh = *fes.GetMesh();
+   Array<Geometry::Type> geoms;
+   mesh.GetGeometries(mesh.Dimension(), geoms);
+   pa_groups.clear();
+   pa_groups.resize(geoms.Size());
+   for (int k = 0; k < geoms.Size(); k++)
+   {
+      PAElementGroup &g = pa_groups[k];
+      g.geom = geoms[k];
+      g.elements.SetSize(0);
+      for (int e = 0; e < mesh.GetNE(); e++)
+      {
+         if (mesh.GetElementGeometry(e) == g.geom) { g.elements.Append(e); }
+      }
+      g.ne = g.elements.Size();
+      const int e0 = g.elements[0];
+      const FiniteElement &fe = *fes.GetFE(e0);
+      ElementTransformation &T = *mesh.GetElementTransformation(e0);
+      g.ir = GetIntegrationRule(fe, T);
+      MFEM_VERIFY(g.ir, "No integration rule for geometry " << g.geom);
+      g.maps = &fe.GetDofToQuad(*g.ir, DofToQuad::FULL);
+      g.nd = fe.GetDof();
+      g.nq = g.ir->GetNPoints();
+
+      g.dofs.SetSize(g.nd*g.ne);
+      int *d_dofs = g.dofs.HostWrite();
+      Array<int> el_dofs;
+      for (int i = 0; i < g.ne; i++)
+      {
+         fes.GetElementDofs(g.elements[i], el_dofs);
+         MFEM_ASSERT(el_dofs.Size() == g.nd, "invalid element dofs");
+         std::copy(el_dofs.begin(), el_dofs.end(), d_dofs + i*g.nd);
+      }
+      g.xe.SetSize(g.nd*g.ne, Device::GetDeviceMemoryType());
+      g.ye.SetSize(g.nd*g.ne, Device::GetDeviceMemoryType());
+      g.ye.UseDevice(true);
+   }
+}
+
+void BilinearFormIntegrator::GatherPAElementGroup(const PAElementGroup &g,
+                                                  const Vector &x)
+{
+   const auto d_dofs = g.dofs.Read();
+   const auto d_x = x.Read();
+   auto d_xe = g.xe.Write();
+   mfem::forall(g.nd*g.ne, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int j = d_dofs[k];
+      d_xe[k] = (j >= 0) ? d_x[j] : -d_x[-1-j];
+   });
+}
+
+void BilinearFormIntegrator::ScatterAddPAElementGroup(const PAElementGroup &g,
+                                                      Vector &y,
+                                                      bool use_sign)
+{
+   const auto d_dofs = g.dofs.Read();
+   const auto d_ye = g.ye.Read();
+   auto d_y = y.ReadWrite();
+   mfem::forall(g.nd*g.ne, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int j = d_dofs[k];
+      const real_t v = (j >= 0 || !use_sign) ? d_ye[k] : -d_ye[k];
+      AtomicAdd(d_y[(j >= 0) ? j : -1-j], v);
+   });
+}
+
+OperatorCostModel BilinearFormIntegrator::PACostModel(const DofToQuad &maps,
+                                                     int dim, int ne, int vdim,
+                                                     int nin, int nout,
+                                                     real_t qflops,
+                                                     const Vector &pa_data)
+{
+   const real_t D = maps.ndof, Q = maps.nqpt;
+   real_t nd, nq, interp;
+   if (maps.mode == DofToQuad::TENSOR)
+   {
+      // The contraction in the k-th direction maps D^(dim-k+1) Q^(k-1) values
+      // to D^(dim-k) Q^k values.
+      nd = std::pow(D, dim);
+      nq = std::pow(Q, dim);
+      interp = 0.0;
+      for (int k = 1; k <= dim; k++)
+      {
+         interp += 2.0 * std::pow(D, dim-k+1) * std::pow(Q, k);
+      }
+   }
+   else
+   {
+      nd = D;
+      nq = Q;
+      interp = 2.0 * D * Q;
+   }
+   OperatorCostModel cost;
+   cost.stored_bytes = sizeof(real_t) * real_t(pa_data.Size());
+   cost.bytes_per_apply = cost.stored_bytes + 3.0 * sizeof(real_t) * nd*vdim*ne;
+   cost.flops_per_apply = real_t(ne) * vdim * ((nin + nout)*interp + qflops*nq);
+   return cost;
+}
+
 void BilinearFormIntegrator::AssemblePA(const FiniteElementSpace&)
 {
    MFEM_ABORT("BilinearFormIntegrator::AssemblePA(fes)\n"
@@ -64,6 +170,19 @@ void BilinearFormIntegrator::AssembleDiagonalPA(Vector &)
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AssembleBlockDiagonalPA(Vector &)
+{
+   MFEM_ABORT("BilinearFormIntegrator::AssembleBlockDiagonalPA(...)\n"
+              "   is not implemented for this class.");
+}
+
+OperatorCostModel BilinearFormIntegrator::GetCostModelPA() const
+{
+   OperatorCostModel cost;
+   cost.complete = false;
+   return cost;
+}
+
 void BilinearFormIntegrator::AssembleEA(const FiniteElementSpace &fes,
                                         Vector &emat,
                                         const bool add)
@@ -133,6 +252,12 @@ void BilinearFormIntegrator::AddMultNURBSPA(const Vector &, Vector &) const
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AssembleDiagonalNURBSPA(Vector &)
+{
+   MFEM_ABORT("BilinearFormIntegrator::AssembleDiagonalNURBSPA(...)\n"
+              "   is not implemented for this class.");
+}
+
 void BilinearFormIntegrator::AddMultTransposePA(const Vector &, Vector &) const
 {
    MFEM_ABORT("BilinearFormIntegrator::AddMultTransposePA(...)\n"
@@ -391,22 +516,6 @@ void SumIntegrator::AssembleFaceMatrix(
    }
 }
 
-void SumIntegrator::AssemblePA(const FiniteElementSpace& fes)
-{
-   for (int i = 0; i < integrators.Size(); i++)
-   {
-      integrators[i]->AssemblePA(fes);
-   }
-}
-
-void SumIntegrator::AssembleDiagonalPA(Vector &diag)
-{
-   for (int i = 0; i < integrators.Size(); i++)
-   {
-      integrators[i]->AssembleDiagonalPA(diag);
-   }
-}
-
 void SumIntegrator::AssemblePAInteriorFaces(const FiniteElementSpace &fes)
 {
    for (int i = 0; i < integrators.Size(); i++)
@@ -423,38 +532,6 @@ void SumIntegrator::AssemblePABoundaryFaces(const FiniteElementSpace &fes)
    }
 }
 
-void SumIntegrator::AddMultPA(const Vector& x, Vector& y) const
-{
-   for (int i = 0; i < integrators.Size(); i++)
-   {
-      integrators[i]->AddMultPA(x, y);
-   }
-}
-
-void SumIntegrator::AddAbsMultPA(const Vector& x, Vector& y) const
-{
-   for (int i = 0; i < integrators.Size(); i++)
-   {
-      integrators[i]->AddAbsMultPA(x, y);
-   }
-}
-
-void SumIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
-{
-   for (int i = 0; i < integrators.Size(); i++)
-   {
-      integrators[i]->AddMultTransposePA(x, y);
-   }
-}
-
-void SumIntegrator::AddAbsMultTransposePA(const Vector &x, Vector &y) const
-{
-   for (int i = 0; i < integrators.Size(); i++)
-   {
-      integrators[i]->AddAbsMultTransposePA(x, y);
-   }
-}
-
 void SumIntegrator::AssembleMF(const FiniteElementSpace &fes)
 {
    for (int i = 0; i < integrators.Size(); i++)
@@ -17,6 +17,7 @@
 #include "fespace.hpp"
 #include "ceed/interface/util.hpp"
 #include "qfunction.hpp"
+#include "integ/bilininteg_patch.hpp"
 #include <memory>
 
 #include "kernel_dispatch.hpp"
@@ -26,13 +27,100 @@ namespace mfem
 class QuadratureSpace;
 class FaceQuadratureSpace;
 
+/** @brief Performance model of an operator: the memory it stores, and the
+    memory traffic and floating point operations of one application.
+
+    The traffic is the compulsory traffic of the kernels, i.e. every array that
+    is read or written by a kernel is counted once per application, and the
+    flop counts are those of the sum-factorized (or dense) kernels. The model
+    is an estimate that can be compared with measured bandwidth and flop rates,
+    e.g. to choose the AssemblyLevel of an operator. */
+struct OperatorCostModel
+{
+   /// Bytes stored by the operator (quadrature data, matrices, index arrays).
+   real_t stored_bytes = 0.0;
+   /// Bytes read and written by one application of the operator.
+   real_t bytes_per_apply = 0.0;
+   /// Floating point operations of one application of the operator.
+   real_t flops_per_apply = 0.0;
+   /** @brief False if some of the terms of the operator do not provide a cost
+       model, in which case their costs are not included. */
+   bool complete = true;
+
+   OperatorCostModel &operator+=(const OperatorCostModel &other)
+   {
+      stored_bytes += other.stored_bytes;
+      bytes_per_apply += other.bytes_per_apply;
+      flops_per_apply += other.flops_per_apply;
+      complete = complete && other.complete;
+      return *this;
+   }
+
+   /// Arithmetic intensity of one application, in flops per byte.
+   real_t ArithmeticIntensity() const
+   { return bytes_per_apply > 0.0 ? flops_per_apply / bytes_per_apply : 0.0; }
+};
+
+/** @brief Partial assembly data for the elements of one geometry type.
+
+    Used by integrators supporting partial assembly on mixed-geometry meshes,
+    where the elements are grouped by geometry. The action of each group is
+    computed with the non-tensor kernels of the integrator on the E-vectors of
+    the group, which are gathered from and added to L-vectors. */
+struct PAElementGroup
+{
+   Geometry::Type geom;
+   int ne, nd, nq;
+   const IntegrationRule *ir; ///< Not owned
+   const DofToQuad *maps;     ///< Not owned, DofToQuad::FULL mode
+   /// Indices of the elements in the group, size #ne.
+   Array<int> elements;
+   /** @brief Gather map, size #nd x #ne, with negative entries for dofs with
+       flipped sign, see FiniteElementSpace::DecodeDof(). */
+   Array<int> dofs;
+   /// Quadrature point data computed by the integrator.
+   Vector pa_data;
+   /// E-vectors of the group, size #nd x #ne.
+   mutable Vector xe, ye;
+};
+
 /// Abstract base class BilinearFormIntegrator
 class BilinearFormIntegrator : public NonlinearFormIntegrator
 {
 protected:
+   /// Element groups for partial assembly on mixed-geometry meshes.
+   std::vector<PAElementGroup> pa_groups;
+
    BilinearFormIntegrator(const IntegrationRule *ir = NULL)
       : NonlinearFormIntegrator(ir) { }
 
+   /** @brief Group the elements of the scalar space @a fes by geometry in
+       #pa_groups, using the rule given by GetIntegrationRule() for each
+       geometry. The quadrature data PAElementGroup::pa_data is not set. */
+   void SetupPAElementGroups(const FiniteElementSpace &fes);
+
+   /// Gather the L-vector @a x into the E-vector of the group @a g.
+   static void GatherPAElementGroup(const PAElementGroup &g, const Vector &x);
+
+   /** @brief Add the E-vector PAElementGroup::ye of the group @a g to the
+       L-vector @a y. If @a use_sign is false, the dof signs are ignored, e.g.
+       when adding diagonals. */
+   static void ScatterAddPAElementGroup(const PAElementGroup &g, Vector &y,
+                                        bool use_sign = true);
+
+   /** @brief Cost model of a partially assembled kernel on @a ne elements with
+       the basis @a maps (tensor or full) in dimension @a dim.
+
+       Each of the @a vdim components is interpolated to @a nin values per
+       quadrature point (e.g. 1 for values, dim for gradients), @a qflops
+       operations per component are performed at each quadrature point, and
+       @a nout values per point are integrated back. The stored data is
+       @a pa_data, which is read once per application. The E-vectors are read
+       (input and output) and written (output) once. */
+   static OperatorCostModel PACostModel(const DofToQuad &maps, int dim, int ne,
+                                        int vdim, int nin, int nout,
+                                        real_t qflops, const Vector &pa_data);
+
 public:
    // TODO: add support for other assembly levels (in addition to PA) and their
    // actions.
@@ -68,6 +156,24 @@ public:
    /// Assemble diagonal and add it to Vector @a diag.
    virtual void AssembleDiagonalPA(Vector &diag);
 
+   /** @brief Assemble the blocks coupling the vector components of each dof
+       and add them to @a blocks.
+
+       For a space with vector dimension vdim and nd scalar dofs per element,
+       @a blocks has the layout (nd, vdim, vdim, NE): the entry (i, r, c, e) is
+       the coupling between component c (trial) and component r (test) of the
+       dof i of element e. For each c, the slice (:, :, c, :) is an E-vector.
+       This method can be called only after the method AssemblePA() has been
+       called. */
+   virtual void AssembleBlockDiagonalPA(Vector &blocks);
+
+   /** @brief Return an estimate of the stored memory, and of the memory traffic
+       and flops of one AddMultPA(), see OperatorCostModel.
+
+       This method can be called only after the method AssemblePA() has been
+       called. The default implementation returns an empty, incomplete model. */
+   virtual OperatorCostModel GetCostModelPA() const;
+
    /// Assemble diagonal of $A D A^T$ ($A$ is this integrator) and add it to @a diag.
    virtual void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag);
 
@@ -85,6 +191,10 @@ public:
    /// Method for partially assembled action on NURBS patches.
    virtual void AddMultNURBSPA(const Vector&x, Vector&y) const;
 
+   /// Assemble the diagonal of the operator partially assembled on NURBS
+   /// patches and add it to the global Vector @a diag.
+   virtual void AssembleDiagonalNURBSPA(Vector &diag);
+
    /// Method for partially assembled transposed action.
    /** Perform the transpose action of integrator on the input @a x and add the
        result to the output @a y. Both @a x and @a y are E-vectors, i.e. they
@@ -463,6 +573,20 @@ private:
    mutable DenseMatrix elem_mat;
    Array<BilinearFormIntegrator*> integrators;
 
+   // Fused PA extension, see AssemblePA
+   bool fused = false;
+   bool has_mass = false, has_conv = false, has_diff = false;
+   mutable bool integrators_pa = false; ///< PA data of the integrators is set
+   const FiniteElementSpace *fespace = nullptr; ///< Not owned
+   const DofToQuad *maps = nullptr;             ///< Not owned
+   int dim = 0, ne = 0, dofs1D = 0, quad1D = 0;
+   Vector pa_data;
+
+   /// Setup of the fused quadrature data, returns false if not supported.
+   bool AssembleFusedPA(const FiniteElementSpace &fes);
+   /// Assemble the PA data of the integrators, if not already done.
+   void EnsureIntegratorsPA() const;
+
 public:
    SumIntegrator(int own_integs = 1) { own_integrators = own_integs; }
 
@@ -491,9 +615,21 @@ public:
                            FaceElementTransformations &Trans,
                            DenseMatrix &elmat) override;
 
+   /** @brief Partial assembly of the sum of the integrators.
+
+       If all the integrators are MassIntegrator, DiffusionIntegrator (with a
+       scalar coefficient) or ConvectionIntegrator using the same integration
+       rule (e.g. set with SetIntRule), on a space with tensor-product
+       elements, their quadrature data is combined and AddMultPA applies the
+       sum with a single kernel: the input is interpolated to the quadrature
+       points and integrated against the test functions only once. Otherwise,
+       the integrators are assembled and applied one after the other. */
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace& fes) override;
 
+   /// Returns true if AssemblePA combined the integrators into one kernel.
+   bool IsFusedPA() const { return fused; }
+
    void AssembleDiagonalPA(Vector &diag) override;
 
    void AssemblePAInteriorFaces(const FiniteElementSpace &fes) override;
@@ -2176,6 +2312,7 @@ protected:
     can be a scalar or a matrix coefficient. */
 class DiffusionIntegrator: public BilinearFormIntegrator
 {
+   friend class SumIntegrator;
 public:
 
    using ApplyKernelType = void(*)(const int, const bool, const Array<real_t>&,
@@ -2213,6 +2350,17 @@ private:
    Vector pa_data;
    bool symmetric = true; ///< False if using a nonsymmetric matrix coefficient
 
+   // Matrix-free extension: only the E-vector of the mesh nodes and the
+   // coefficient values are stored, and the geometric factors are recomputed
+   // from the nodes inside the kernels, see AssembleMF.
+   const DofToQuad *mf_nodes_maps = nullptr; ///< Not owned
+   const IntegrationRule *mf_ir = nullptr;   ///< Not owned
+   Vector mf_nodes, mf_coeff;
+
+   /// Partial assembly on mixed-geometry meshes, grouping by geometry.
+   void AssemblePAMixed(const FiniteElementSpace &fes);
+   void AddMultPAMixed(const Vector &x, Vector &y, bool abs = false) const;
+
    // Data for NURBS patch PA
 
    // Type for a variable-row-length 2D array, used for data related to 1D
@@ -2314,6 +2462,15 @@ public:
                             ElementTransformation &Trans,
                             Vector &flux, Vector *d_energy = NULL) override;
 
+   /** @brief Setup for matrix-free application (AssemblyLevel::NONE).
+
+       Without libCEED, this stores only the mesh nodes and the values of the
+       scalar coefficient at the quadrature points (a single value for a
+       constant coefficient). The Jacobians of the element transformations
+       are recomputed from the nodes with sum factorization in AddMultMF, so
+       unlike AssemblePA no O(NE NQ dim^2) quadrature data is kept in memory.
+       Requires tensor-product elements of a single geometry and a scalar
+       coefficient. */
    void AssembleMF(const FiniteElementSpace &fes) override;
 
    using BilinearFormIntegrator::AssemblePA;
@@ -2324,6 +2481,8 @@ public:
 
    void AssembleDiagonalPA(Vector &diag) override;
 
+   OperatorCostModel GetCostModelPA() const override;
+
    void AssembleDiagonalMF(Vector &diag) override;
 
    void AddMultMF(const Vector&, Vector&) const override;
@@ -2367,6 +2526,7 @@ protected:
 class MassIntegrator: public BilinearFormIntegrator
 {
    friend class DGMassInverse;
+   friend class SumIntegrator;
 protected:
 #ifndef MFEM_THREAD_SAFE
    Vector shape, te_shape;
@@ -2382,6 +2542,18 @@ protected:
 
    void AssembleEA_(Vector &ea, const bool add);
 
+   /// Partial assembly on mixed-geometry meshes, grouping by geometry.
+   void AssemblePAMixed(const FiniteElementSpace &fes);
+   void AddMultPAMixed(const Vector &x, Vector &y, bool abs = false) const;
+
+   // Data for NURBS patch PA: the quadrature data of each patch is w det(J) Q.
+   internal::NURBSPatchAssembly patch_assembly;
+   std::vector<Vector> patch_qdata;
+
+   void SetupPatchQData(const int patch, bool unitWeights, Vector &qdata);
+   void ApplyPatchQFunction(const Vector &qdata, int q0, int nq,
+                            const real_t *in, real_t *out) const;
+
 public:
 
    using ApplyKernelType = void(*)(const int, const Array<real_t>&,
@@ -2427,6 +2599,8 @@ public:
 
    virtual void AssembleDiagonalPA(Vector &diag) override;
 
+   OperatorCostModel GetCostModelPA() const override;
+
    void AssembleDiagonalMF(Vector &diag) override;
 
    void AddMultMF(const Vector&, Vector&) const override;
@@ -2439,6 +2613,16 @@ public:
 
    void AddAbsMultTransposePA(const Vector&, Vector&) const override;
 
+   void AssembleNURBSPA(const FiniteElementSpace &fes) override;
+
+   void AddMultNURBSPA(const Vector&, Vector&) const override;
+
+   void AssembleDiagonalNURBSPA(Vector &diag) override;
+
+   void AssemblePatchMatrix(const int patch,
+                            const FiniteElementSpace &fes,
+                            SparseMatrix*& smat) override;
+
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe,
                                          const ElementTransformation &Trans);
@@ -2480,6 +2664,7 @@ public:
 /// $\alpha (Q \cdot \nabla u, v)$
 class ConvectionIntegrator : public BilinearFormIntegrator
 {
+   friend class SumIntegrator;
 protected:
    VectorCoefficient *Q;
    real_t alpha;
@@ -2512,6 +2697,8 @@ public:
 
    void AssembleDiagonalPA(Vector &diag) override;
 
+   OperatorCostModel GetCostModelPA() const override;
+
    void AssembleDiagonalMF(Vector &diag) override;
 
    void AddMultMF(const Vector&, Vector&) const override;
@@ -2646,6 +2833,8 @@ public:
    void AssemblePA(const FiniteElementSpace &fes) override;
    void AssembleMF(const FiniteElementSpace &fes) override;
    void AssembleDiagonalPA(Vector &diag) override;
+   void AssembleBlockDiagonalPA(Vector &blocks) override;
+   OperatorCostModel GetCostModelPA() const override;
    void AssembleDiagonalMF(Vector &diag) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
    void AddMultMF(const Vector &x, Vector &y) const override;
@@ -2865,6 +3054,9 @@ public:
    void AddAbsMultPA(const Vector &x, Vector &y) const override;
    void AssembleDiagonalPA(Vector& diag) override;
 
+   void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
+                   const bool add) override;
+
    const Coefficient *GetCoefficient() const { return Q; }
 
    /// arguments: d1d, q1d, symmetric, NE, bo, bc, bot, bct, gc, gct, pa_data,
@@ -3144,6 +3336,15 @@ protected:
    int ne, dim, sdim, dofs1D, quad1D, coeff_vdim;
    Vector pa_data;
 
+   // Data for NURBS patch PA
+   const FiniteElementSpace *fespace = nullptr; ///< Not owned
+   internal::NURBSPatchAssembly patch_assembly;
+   std::vector<Vector> patch_qdata;
+
+   void SetupPatchQData(const int patch, bool unitWeights, Vector &qdata);
+   void ApplyPatchQFunction(const Vector &qdata, int q0, int nq,
+                            const real_t *in, real_t *out) const;
+
 public:
    VectorDiffusionIntegrator(const IntegrationRule *ir = nullptr);
 
@@ -3201,11 +3402,21 @@ public:
    void AssemblePA(const FiniteElementSpace &fes) override;
    void AssembleMF(const FiniteElementSpace &fes) override;
    void AssembleDiagonalPA(Vector &diag) override;
+   void AssembleBlockDiagonalPA(Vector &blocks) override;
+   OperatorCostModel GetCostModelPA() const override;
    void AssembleDiagonalMF(Vector &diag) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
    void AddMultMF(const Vector &x, Vector &y) const override;
    bool SupportsCeed() const override { return DeviceCanUseCeed(); }
 
+   /// Patch-wise assembly on 3D NURBS meshes. MatrixCoefficient is not
+   /// supported.
+   void AssembleNURBSPA(const FiniteElementSpace &fes) override;
+   void AddMultNURBSPA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalNURBSPA(Vector &diag) override;
+   void AssemblePatchMatrix(const int patch, const FiniteElementSpace &fes,
+                            SparseMatrix*& smat) override;
+
    /// arguments: ne, coeff_vdim, B, G, pa_data, x, y, d1d, q1d, vdim
    using ApplyKernelType = void (*)(const int, const int,
                                     const Array<real_t> &, const Array<real_t> &,
@@ -3262,6 +3473,15 @@ private:
    /// Set up the quadrature space and project lambda and mu coefficients
    void SetUpQuadratureSpaceAndCoefficients(const FiniteElementSpace &fes);
 
+   // Data for NURBS patch PA
+   internal::NURBSPatchAssembly patch_assembly;
+   std::vector<Vector> patch_qdata;
+
+   void SetupPatchAssembly(const FiniteElementSpace &fes);
+   void SetupPatchQData(const int patch, bool unitWeights, Vector &qdata);
+   void ApplyPatchQFunction(const Vector &qdata, int q0, int nq,
+                            const real_t *in, real_t *out) const;
+
 public:
    ElasticityIntegrator(Coefficient &l, Coefficient &m)
    { lambda = &l; mu = &m; }
@@ -3279,10 +3499,22 @@ public:
 
    void AssembleDiagonalPA(Vector &diag) override;
 
+   void AssembleBlockDiagonalPA(Vector &blocks) override;
+
    void AddMultPA(const Vector &x, Vector &y) const override;
 
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
 
+   /// Patch-wise assembly on 3D NURBS meshes.
+   void AssembleNURBSPA(const FiniteElementSpace &fes) override;
+
+   void AddMultNURBSPA(const Vector &x, Vector &y) const override;
+
+   void AssembleDiagonalNURBSPA(Vector &diag) override;
+
+   void AssemblePatchMatrix(const int patch, const FiniteElementSpace &fes,
+                            SparseMatrix*& smat) override;
+
    /** Compute the stress corresponding to the local displacement @a $u$ and
        interpolate it at the nodes of the given @a fluxelem. Only the symmetric
        part of the stress is stored, so that the size of @a flux is equal to
@@ -3340,6 +3572,9 @@ public:
    void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
                    const bool add = true) override;
 
+   /// Only supported for the diagonal blocks, i.e. when $i = j$.
+   void AssembleDiagonalPA(Vector &diag) override;
+
    void AddMultPA(const Vector &x, Vector &y) const override;
 
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
@@ -3517,6 +3752,11 @@ protected:
    const DofToQuad *maps; ///< Not owned
    int dim, nf, nq, dofs1D, quad1D;
    IntegrationRules irs{0, Quadrature1D::GaussLobatto};
+   /// (master side, interpolator index) for each face, the master side is -1
+   /// on conforming faces. Empty if the mesh has no nonconforming faces.
+   Array<int> nc_info;
+   /// Coarse-to-fine face interpolators, see InterpolationManager.
+   Vector nc_interp;
 
 public:
    DGDiffusionIntegrator(const real_t s, const real_t k);
@@ -3544,13 +3784,14 @@ public:
 
    real_t GetPenaltyParameter() const { return kappa; }
 
-   /// arguments: nf, B, Bt, G, Gt, sigma, pa_data, x, dxdn, y, dydn, dofs1D,
-   /// quad1D
+   /// arguments: nf, B, Bt, G, Gt, sigma, pa_data, nc_info, nc_interp, x,
+   /// dxdn, y, dydn, dofs1D, quad1D
    using ApplyKernelType = void (*)(const int, const Array<real_t> &,
                                     const Array<real_t> &,
                                     const Array<real_t> &,
                                     const Array<real_t> &, const real_t,
-                                    const Vector &, const Vector &_,
+                                    const Vector &, const Array<int> &,
+                                    const Vector &, const Vector &,
                                     const Vector &, Vector &, Vector &,
                                     const int, const int);
 
@@ -3691,12 +3932,10 @@ public:
 class DGElasticityIntegrator : public BilinearFormIntegrator
 {
 public:
-   DGElasticityIntegrator(real_t alpha_, real_t kappa_)
-      : lambda(NULL), mu(NULL), alpha(alpha_), kappa(kappa_) { }
+   DGElasticityIntegrator(real_t alpha_, real_t kappa_);
 
    DGElasticityIntegrator(Coefficient &lambda_, Coefficient &mu_,
-                          real_t alpha_, real_t kappa_)
-      : lambda(&lambda_), mu(&mu_), alpha(alpha_), kappa(kappa_) { }
+                          real_t alpha_, real_t kappa_);
 
    using BilinearFormIntegrator::AssembleFaceMatrix;
    void AssembleFaceMatrix(const FiniteElement &el1,
@@ -3704,10 +3943,54 @@ public:
                            FaceElementTransformations &Trans,
                            DenseMatrix &elmat) override;
 
+   bool RequiresFaceNormalDerivatives() const override { return true; }
+
+   using BilinearFormIntegrator::AssemblePA;
+
+   /** @brief Partial assembly on the interior faces of a vector L2 space with
+       Gauss-Lobatto basis on a tensor-product mesh, requires @a lambda and
+       @a mu. Nonconforming (serial) meshes are supported. */
+   void AssemblePAInteriorFaces(const FiniteElementSpace &fes) override;
+
+   void AssemblePABoundaryFaces(const FiniteElementSpace &fes) override;
+
+   void AddMultPAFaceNormalDerivatives(const Vector &x, const Vector &dxdn,
+                                       Vector &y, Vector &dydn) const override;
+
+   /// arguments: nf, B, G, alpha, pa_data, nc_info, nc_interp, x, dxdn, y,
+   /// dydn, dofs1D, quad1D
+   using ApplyKernelType = void (*)(const int, const Array<real_t> &,
+                                    const Array<real_t> &, const real_t,
+                                    const Vector &, const Array<int> &,
+                                    const Vector &, const Vector &,
+                                    const Vector &, Vector &, Vector &,
+                                    const int, const int);
+
+   /// arguments: DIM, d1d, q1d
+   MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType, (int, int, int));
+
+   template <int DIM, int D1D, int Q1D> static void AddSpecialization()
+   {
+      ApplyPAKernels::Specialization<DIM, D1D, Q1D>::Add();
+   }
+
+   struct Kernels { Kernels(); };
+
 protected:
    Coefficient *lambda, *mu;
    real_t alpha, kappa;
 
+   // PA extension
+   Vector pa_data; // (nor, pen, [lambda, mu, R J^{-1}]|el0, [...]|el1)
+   const DofToQuad *maps; ///< Not owned
+   int dim, nf, dofs1D, quad1D;
+   IntegrationRules irs{0, Quadrature1D::GaussLobatto};
+   /// (master side, interpolator index) for each face, the master side is -1
+   /// on conforming faces. Empty if the mesh has no nonconforming faces.
+   Array<int> nc_info;
+   /// Coarse-to-fine face interpolators, see InterpolationManager.
+   Vector nc_interp;
+
 #ifndef MFEM_THREAD_SAFE
    // values of all scalar basis functions for one component of u (which is a
    // vector) at the integration point in the reference space
@@ -3736,6 +4019,9 @@ protected:
       const Vector &row_shape, const Vector &col_shape,
       const Vector &col_dshape_dnM, const DenseMatrix &col_dshape,
       DenseMatrix &elmat, DenseMatrix &jmat);
+
+private:
+   void SetupPA(const FiniteElementSpace &fes, FaceType type);
 };
 
 /** Integrator for the DPG form:$ \langle v, [w] \rangle $ over all faces (the interface) where
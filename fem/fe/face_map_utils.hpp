@@ -206,16 +206,13 @@ inline int PermuteFace3D(const int face_id1, const int face_id2,
 /// relative to element 1, return the associated (i, j) coordinates.
 ///
 /// The returned coordinates will be relative to element 1 or element 2
-/// according to the value of side (side == 0 corresponds element 1).
+/// according to the value of side (side == 0 corresponds element 1). The
+/// orientation of the face relative to element 2 is given by @a orientation.
 MFEM_HOST_DEVICE
 inline void FaceIdxToVolIdx2D(const int qi, const int nq, const int face_id0,
-                              const int face_id1, const int side, int &i, int &j)
+                              const int face_id1, const int side,
+                              const int orientation, int &i, int &j)
 {
-   // Note: in 2D, a consistently ordered mesh will always have the element 2
-   // face reversed relative to element 1, so orientation is determined entirely
-   // by side. (In 3D, separate orientation information is needed).
-   const int orientation = side;
-
    const int face_id = (side == 0) ? face_id0 : face_id1;
    const int edge_idx = (side == 0) ? qi : PermuteFace2D(face_id0, face_id1,
                                                          orientation, nq, qi);
@@ -227,6 +224,22 @@ inline void FaceIdxToVolIdx2D(const int qi, const int nq, const int face_id0,
    j = x_axis ? level : edge_idx;
 }
 
+/// @brief Given a face DOF (or quadrature) index ordered lexicographically
+/// relative to element 1, return the associated (i, j) coordinates.
+///
+/// The returned coordinates will be relative to element 1 or element 2
+/// according to the value of side (side == 0 corresponds element 1).
+MFEM_HOST_DEVICE
+inline void FaceIdxToVolIdx2D(const int qi, const int nq, const int face_id0,
+                              const int face_id1, const int side, int &i, int &j)
+{
+   // Note: in 2D, a consistently ordered conforming mesh will always have the
+   // element 2 face reversed relative to element 1, so orientation is
+   // determined entirely by side. (In 3D, and on nonconforming faces, separate
+   // orientation information is needed).
+   FaceIdxToVolIdx2D(qi, nq, face_id0, face_id1, side, side, i, j);
+}
+
 /// @brief Given a face DOF (or quadrature) index ordered lexicographically
 /// relative to element 1, return the associated (i, j, k) coordinates.
 ///
@@ -355,41 +355,38 @@ void FiniteElementSpace::BuildElementToDofTable() const
 {
    if (elem_dof) { return; }
 
-   // TODO: can we call GetElementDofs only once per element?
-   Table *el_dof = new Table;
-   Table *el_fos = (mesh->Dimension() > 2) ? (new Table) : NULL;
-   Array<int> dofs;
-   Array<int> F, Fo;
-   el_dof->MakeI(mesh->GetNE());
-   if (el_fos) { el_fos->MakeI(mesh->GetNE()); }
-   for (int i = 0; i < mesh->GetNE(); i++)
+   // Collect the DOFs (and face orientations) of all elements in one pass,
+   // since GetElementDofs is the expensive part, then copy them to the tables
+   const int NE = mesh->GetNE();
+   const bool fos = (mesh->Dimension() > 2);
+   Array<int> dofs, F, Fo;
+   Array<int> dof_I(NE+1), dof_J, fos_I(fos ? NE+1 : 0), fos_J;
+   dof_I[0] = 0;
+   if (fos) { fos_I[0] = 0; }
+   for (int i = 0; i < NE; i++)
    {
       GetElementDofs(i, dofs);
-      el_dof->AddColumnsInRow(i, dofs.Size());
+      dof_J.Append(dofs);
+      dof_I[i+1] = dof_J.Size();
 
-      if (el_fos)
+      if (fos)
       {
          mesh->GetElementFaces(i, F, Fo);
-         el_fos->AddColumnsInRow(i, Fo.Size());
+         fos_J.Append(Fo);
+         fos_I[i+1] = fos_J.Size();
       }
    }
-   el_dof->MakeJ();
-   if (el_fos) { el_fos->MakeJ(); }
-   for (int i = 0; i < mesh->GetNE(); i++)
-   {
-      GetElementDofs(i, dofs);
-      el_dof->AddConnections(i, (int *)dofs, dofs.Size());
 
-      if (el_fos)
-      {
-         mesh->GetElementFaces(i, F, Fo);
-         el_fos->AddConnections(i, (int *)Fo, Fo.Size());
-      }
-   }
-   el_dof->ShiftUpI();
-   if (el_fos) { el_fos->ShiftUpI(); }
-   elem_dof = el_dof;
-   elem_fos = el_fos;
+   auto make_table = [NE](const Array<int> &I, const Array<int> &J)
+   {
+      Table *table = new Table;
+      table->SetDims(NE, J.Size());
+      std::copy(I.begin(), I.end(), table->GetI());
+      std::copy(J.begin(), J.end(), table->GetJ());
+      return table;
+   };
+   elem_dof = make_table(dof_I, dof_J);
+   elem_fos = fos ? make_table(fos_I, fos_J) : NULL;
 }
 
 void FiniteElementSpace::BuildBdrElementToDofTable() const
@@ -912,7 +909,7 @@ FiniteElementSpace::H2L_GlobalRestrictionMatrix (FiniteElementSpace *lfes)
 
 void FiniteElementSpace::AddDependencies(
    SparseMatrix& deps, Array<int>& master_dofs, Array<int>& slave_dofs,
-   DenseMatrix& I, int skipfirst)
+   const DenseMatrix& I, int skipfirst)
 {
    for (int i = skipfirst; i < slave_dofs.Size(); i++)
    {
@@ -989,6 +986,28 @@ void FiniteElementSpace::AddEdgeFaceDependencies(
    }
 }
 
+const DenseMatrix &FiniteElementSpace::NCTransferMatrices::Get(
+   const NCMesh::Slave &slave, const FiniteElement &master_fe,
+   const FiniteElement &slave_fe)
+{
+   const unsigned pm = (slave.matrix << 8) | slave.edge_flags;
+   DenseMatrix &I =
+      matrices[std::make_tuple(&master_fe, &slave_fe, int(slave.Geom()), pm)];
+   if (!I.Height())
+   {
+      switch (master_fe.GetGeomType())
+      {
+         case Geometry::SQUARE:   T.SetFE(&QuadrilateralFE); break;
+         case Geometry::TRIANGLE: T.SetFE(&TriangleFE); break;
+         case Geometry::SEGMENT:  T.SetFE(&SegmentFE); break;
+         default: MFEM_ABORT("unsupported geometry");
+      }
+      list.OrientedPointMatrix(slave, T.GetPointMat());
+      slave_fe.GetTransferMatrix(master_fe, T, I);
+   }
+   return I;
+}
+
 bool FiniteElementSpace::DofFinalizable(int dof, const Array<bool>& finalized,
                                         const SparseMatrix& deps)
 {
@@ -1182,6 +1201,9 @@ void FiniteElementSpace::BuildConformingInterpolation() const
       const NCMesh::NCList &list = mesh->ncmesh->GetNCList(entity);
       if (!list.masters.Size()) { continue; }
 
+      // slaves at the same position share their interpolation matrix
+      NCTransferMatrices transfer(list);
+
       // loop through all master edges/faces, constrain their slave edges/faces
       for (const NCMesh::Master &master : list.masters)
       {
@@ -1194,14 +1216,6 @@ void FiniteElementSpace::BuildConformingInterpolation() const
          const FiniteElement *master_fe = fec->GetFE(master_geom, p);
          if (!master_fe) { continue; }
 
-         switch (master_geom)
-         {
-            case Geometry::SQUARE:   T.SetFE(&QuadrilateralFE); break;
-            case Geometry::TRIANGLE: T.SetFE(&TriangleFE); break;
-            case Geometry::SEGMENT:  T.SetFE(&SegmentFE); break;
-            default: MFEM_ABORT("unsupported geometry");
-         }
-
          for (int si = master.slaves_begin; si < master.slaves_end; si++)
          {
             const NCMesh::Slave &slave = list.slaves[si];
@@ -1210,8 +1224,8 @@ void FiniteElementSpace::BuildConformingInterpolation() const
             if (!slave_dofs.Size()) { break; }
 
             const FiniteElement *slave_fe = fec->GetFE(slave.Geom(), q);
-            list.OrientedPointMatrix(slave, T.GetPointMat());
-            slave_fe->GetTransferMatrix(*master_fe, T, I);
+            const DenseMatrix &slave_I =
+               transfer.Get(slave, *master_fe, *slave_fe);
 
             // variable-order spaces: face edges need to be handled separately
             int skipfirst = 0;
@@ -1221,7 +1235,8 @@ void FiniteElementSpace::BuildConformingInterpolation() const
             }
 
             // make each slave DOF dependent on all master DOFs
-            AddDependencies(deps, master_dofs, slave_dofs, I, skipfirst);
+            AddDependencies(deps, master_dofs, slave_dofs, slave_I,
+                            skipfirst);
 
             if (skipfirst)
             {
@@ -1274,9 +1289,6 @@ void FiniteElementSpace::BuildConformingInterpolation() const
       return;
    }
 
-   // create the conforming prolongation matrix cP
-   cP.reset(new SparseMatrix(ndofs, n_true_dofs));
-
    // create the conforming restriction matrix cR
    int *cR_J;
    {
@@ -1311,12 +1323,23 @@ void FiniteElementSpace::BuildConformingInterpolation() const
    Array<int> cols;
    Vector srow;
 
+   // The rows of the prolongation matrix cP are stored in (P_J, P_A) in the
+   // order in which they are calculated, the row of 'dof' starts at
+   // P_pos[dof]. The rows are copied to cP in the end.
+   Array<int> P_pos(ndofs), P_len(ndofs), P_J;
+   Array<real_t> P_A;
+   P_J.Reserve(ndofs);
+   P_A.Reserve(ndofs);
+
    // Put identity in the prolongation matrix for true DOFs, and set cR_hp
    for (int i = 0, true_dof = 0; i < ndofs; i++)
    {
       if (!deps.RowSize(i)) // true dof
       {
-         cP->Add(i, true_dof, 1.0);
+         P_pos[i] = P_J.Size();
+         P_len[i] = 1;
+         P_J.Append(true_dof);
+         P_A.Append(1.0);
          cR_J[true_dof] = i;
          finalized[i] = true;
 
@@ -1346,6 +1369,8 @@ void FiniteElementSpace::BuildConformingInterpolation() const
    // cP matrix), in the third iteration slaves of slaves of slaves, etc.
    bool finished;
    int n_finalized = n_true_dofs;
+   Array<int> col_pos(n_true_dofs); // position of a column in the current row
+   col_pos = -1;
    do
    {
       finished = true;
@@ -1357,12 +1382,30 @@ void FiniteElementSpace::BuildConformingInterpolation() const
             const real_t* dep_coef = deps.GetRowEntries(dof);
             int n_dep = deps.RowSize(dof);
 
+            const int pos = P_J.Size();
             for (int j = 0; j < n_dep; j++)
             {
-               cP->GetRow(dep_col[j], cols, srow);
-               srow *= dep_coef[j];
-               cP->AddRow(dof, cols, srow);
+               const int mdof = dep_col[j];
+               for (int k = P_pos[mdof]; k < P_pos[mdof] + P_len[mdof]; k++)
+               {
+                  const real_t a = P_A[k] * dep_coef[j];
+                  if (a == 0.0) { continue; }
+
+                  const int col = P_J[k];
+                  if (col_pos[col] < pos)
+                  {
+                     col_pos[col] = P_J.Size();
+                     P_J.Append(col);
+                     P_A.Append(0.0);
+                  }
+                  P_A[col_pos[col]] += a;
+               }
             }
+            // keep the column order of a SparseMatrix assembled with AddRow
+            std::reverse(P_J.begin() + pos, P_J.end());
+            std::reverse(P_A.begin() + pos, P_A.end());
+            P_pos[dof] = pos;
+            P_len[dof] = P_J.Size() - pos;
 
             finalized[dof] = true;
             n_finalized++;
@@ -1378,7 +1421,33 @@ void FiniteElementSpace::BuildConformingInterpolation() const
                "Error creating cP matrix: n_finalized = "
                << n_finalized << ", ndofs = " << ndofs);
 
-   cP->Finalize();
+   // create the conforming prolongation matrix cP, skipping zeros
+   int *cP_I = Memory<int>(ndofs+1);
+   cP_I[0] = 0;
+   for (int i = 0; i < ndofs; i++)
+   {
+      int nnz = 0;
+      for (int k = P_pos[i]; k < P_pos[i] + P_len[i]; k++)
+      {
+         nnz += (P_A[k] != 0.0);
+      }
+      cP_I[i+1] = cP_I[i] + nnz;
+   }
+   int *cP_J = Memory<int>(cP_I[ndofs]);
+   real_t *cP_A = Memory<real_t>(cP_I[ndofs]);
+   bool sorted = true;
+   for (int i = 0, j = 0; i < ndofs; i++)
+   {
+      for (int k = P_pos[i]; k < P_pos[i] + P_len[i]; k++)
+      {
+         if (P_A[k] == 0.0) { continue; }
+         if (j > cP_I[i] && cP_J[j-1] > P_J[k]) { sorted = false; }
+         cP_J[j] = P_J[k];
+         cP_A[j++] = P_A[k];
+      }
+   }
+   cP.reset(new SparseMatrix(cP_I, cP_J, cP_A, ndofs, n_true_dofs,
+                             true, true, sorted));
    if (cR_hp) { cR_hp->Finalize(); }
 
    if (vdim > 1)
@@ -1835,7 +1904,8 @@ FiniteElementSpace::RefinementOperator::RefinementOperator(
    int old_ndofs)
    : fespace(fespace),
      old_elem_dof(old_elem_dof),
-     old_elem_fos(old_elem_fos)
+     old_elem_fos(old_elem_fos),
+     batched(false)
 {
    MFEM_VERIFY(fespace->GetNE() >= old_elem_dof->Size(),
                "Previous mesh is not coarser.");
@@ -1854,12 +1924,13 @@ FiniteElementSpace::RefinementOperator::RefinementOperator(
    }
 
    ConstructDoFTransArray();
+   ConstructBatched();
 }
 
 FiniteElementSpace::RefinementOperator::RefinementOperator(
    const FiniteElementSpace *fespace, const FiniteElementSpace *coarse_fes)
    : Operator(fespace->GetVSize(), coarse_fes->GetVSize()),
-     fespace(fespace), old_elem_dof(NULL), old_elem_fos(NULL)
+     fespace(fespace), old_elem_dof(NULL), old_elem_fos(NULL), batched(false)
 {
    Mesh::GeometryList elem_geoms(*fespace->GetMesh());
 
@@ -1882,6 +1953,7 @@ FiniteElementSpace::RefinementOperator::RefinementOperator(
    }
 
    ConstructDoFTransArray();
+   ConstructBatched();
 }
 
 FiniteElementSpace::RefinementOperator::~RefinementOperator()
@@ -1939,9 +2011,142 @@ void FiniteElementSpace::RefinementOperator::ConstructDoFTransArray()
    }
 }
 
+void FiniteElementSpace::RefinementOperator::ConstructBatched()
+{
+   if (fespace->IsVariableOrder()) { return; }
+
+   const Mesh *mesh_ref = fespace->GetMesh();
+   const CoarseFineTransformations &trans_ref =
+      mesh_ref->GetRefinementTransforms();
+   const Table &elem_dof = fespace->GetElementToDofTable();
+   const int NE = mesh_ref->GetNE();
+
+   // Number the rows of the local matrices of all geometries: the row 'i' of
+   // the matrix 'm' of the geometry 'geom' is geom_rows[geom] + m*height + i
+   Mesh::GeometryList elem_geoms(*mesh_ref);
+   int geom_rows[Geometry::NumGeom];
+   int nrows = 0;
+   for (int i = 0; i < elem_geoms.Size(); i++)
+   {
+      const Geometry::Type geom = elem_geoms[i];
+      if (fespace->DoFTransArray[geom]) { return; }
+      geom_rows[geom] = nrows;
+      nrows += localP[geom].SizeI() * localP[geom].SizeK();
+   }
+
+   row_I.SetSize(nrows + 1);
+   row_I.HostWrite();
+   row_I[0] = 0;
+   for (int i = 0, r = 0; i < elem_geoms.Size(); i++)
+   {
+      const DenseTensor &lP = localP[elem_geoms[i]];
+      for (int m = 0; m < lP.SizeK(); m++)
+      {
+         for (int k = 0; k < lP.SizeI(); k++, r++)
+         {
+            int nnz = 0;
+            for (int j = 0; j < lP.SizeJ(); j++)
+            {
+               nnz += (lP(k, j, m) != 0.0);
+            }
+            row_I[r + 1] = row_I[r] + nnz;
+         }
+      }
+   }
+   row_J.SetSize(row_I[nrows]);
+   row_A.SetSize(row_I[nrows]);
+   row_J.HostWrite();
+   row_A.HostWrite();
+   for (int i = 0, nz = 0; i < elem_geoms.Size(); i++)
+   {
+      const DenseTensor &lP = localP[elem_geoms[i]];
+      for (int m = 0; m < lP.SizeK(); m++)
+      {
+         for (int k = 0; k < lP.SizeI(); k++)
+         {
+            for (int j = 0; j < lP.SizeJ(); j++)
+            {
+               if (lP(k, j, m) == 0.0) { continue; }
+               row_J[nz] = j;
+               row_A[nz++] = lP(k, j, m);
+            }
+         }
+      }
+   }
+
+   // A fine DOF shared by several fine elements is set by the last of them
+   const int *I = elem_dof.GetI(), *J = elem_dof.GetJ();
+   const int *old_I = old_elem_dof->GetI();
+   dof_row.SetSize(fespace->GetNDofs());
+   dof_parent.SetSize(fespace->GetNDofs());
+   dof_row.HostWrite();
+   dof_parent.HostWrite();
+   for (int k = 0; k < NE; k++)
+   {
+      const Embedding &emb = trans_ref.embeddings[k];
+      const Geometry::Type geom = mesh_ref->GetElementBaseGeometry(k);
+      const int height = localP[geom].SizeI();
+      MFEM_ASSERT(I[k+1] - I[k] == height, "");
+      MFEM_ASSERT(old_elem_dof->RowSize(emb.parent) == localP[geom].SizeJ(),
+                  "");
+      const int offset = old_I[emb.parent];
+      for (int i = 0; i < height; i++)
+      {
+         const int dof = J[I[k] + i];
+         const int d = (dof >= 0) ? dof : (-1 - dof);
+         dof_row[d] = geom_rows[geom] + emb.matrix*height + i;
+         dof_parent[d] = (dof >= 0) ? offset : (-1 - offset);
+      }
+   }
+   batched = true;
+}
+
+void FiniteElementSpace::RefinementOperator::BatchedMult(const Vector &x,
+                                                         Vector &y) const
+{
+   const int vdim = fespace->GetVDim();
+   const bool byvdim = (fespace->GetOrdering() == Ordering::byVDIM);
+   const int coarse_ndofs = Width() / vdim, fine_ndofs = Height() / vdim;
+
+   const auto d_x = x.Read();
+   const auto d_rI = row_I.Read();
+   const auto d_rJ = row_J.Read();
+   const auto d_rA = row_A.Read();
+   const auto d_row = dof_row.Read();
+   const auto d_par = dof_parent.Read();
+   const auto d_old = Read(old_elem_dof->GetJMemory(),
+                           old_elem_dof->Size_of_connections());
+   auto d_y = y.Write();
+   mfem::forall(fine_ndofs, [=] MFEM_HOST_DEVICE (int dof)
+   {
+      const int r = d_row[dof], p = d_par[dof];
+      const int *old_dofs = d_old + ((p >= 0) ? p : (-1 - p));
+      for (int vd = 0; vd < vdim; vd++)
+      {
+         real_t sum = 0.0;
+         for (int k = d_rI[r]; k < d_rI[r + 1]; k++)
+         {
+            const int od = old_dofs[d_rJ[k]];
+            const int cdof = (od >= 0) ? od : (-1 - od);
+            const real_t val =
+               d_x[byvdim ? (vd + cdof*vdim) : (cdof + vd*coarse_ndofs)];
+            sum += (od >= 0) ? d_rA[k] * val : -d_rA[k] * val;
+         }
+         d_y[byvdim ? (vd + dof*vdim) : (dof + vd*fine_ndofs)] =
+            (p >= 0) ? sum : -sum;
+      }
+   });
+}
+
 void FiniteElementSpace::RefinementOperator::Mult(const Vector &x,
                                                   Vector &y) const
 {
+   if (batched)
+   {
+      BatchedMult(x, y);
+      return;
+   }
+
    Mesh* mesh_ref = fespace->GetMesh();
    const CoarseFineTransformations &trans_ref =
       mesh_ref->GetRefinementTransforms();
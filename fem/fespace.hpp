@@ -21,6 +21,8 @@
 #include "doftrans.hpp"
 #include "restriction.hpp"
 #include <iostream>
+#include <map>
+#include <tuple>
 #include <unordered_map>
 
 namespace mfem
@@ -472,7 +474,7 @@ protected:
    void VariableOrderMinimumRule(SparseMatrix & deps) const;
 
    static void AddDependencies(SparseMatrix& deps, Array<int>& master_dofs,
-                               Array<int>& slave_dofs, DenseMatrix& I,
+                               Array<int>& slave_dofs, const DenseMatrix& I,
                                int skipfirst = 0);
 
    static bool DofFinalizable(int dof, const Array<bool>& finalized,
@@ -483,6 +485,29 @@ protected:
                                 Array<int> &slave_dofs, int slave_face,
                                 const DenseMatrix *pm) const;
 
+   /** @brief Local slave-to-master interpolation matrices of an NCList, used
+       to build the conforming interpolation.
+
+       The point matrices of an NCList are shared by all slaves with the same
+       position in their master, so only a few distinct interpolation matrices
+       exist in a mesh. Each of them is computed once, when first requested. */
+   class NCTransferMatrices
+   {
+      const NCMesh::NCList &list;
+      IsoparametricTransformation T;
+      std::map<std::tuple<const FiniteElement*, const FiniteElement*, int,
+          unsigned>, DenseMatrix> matrices;
+
+   public:
+      NCTransferMatrices(const NCMesh::NCList &list) : list(list) {}
+
+      /** Return the matrix interpolating @a master_fe on the master of
+          @a slave into @a slave_fe on the @a slave. */
+      const DenseMatrix &Get(const NCMesh::Slave &slave,
+                             const FiniteElement &master_fe,
+                             const FiniteElement &slave_fe);
+   };
+
    /// Replicate 'mat' in the vector dimension, according to vdim ordering mode.
    void MakeVDimMatrix(SparseMatrix &mat) const;
 
@@ -497,7 +522,26 @@ protected:
       Array<StatelessDofTransformation*> old_DoFTransArray;
       mutable DofTransformation old_DoFTrans;
 
+      /** Data of the batched, device-capable Mult, which is not used in
+          variable-order spaces and with DOF transformations. Each fine DOF is
+          computed once, from the row of the local refinement matrix of one of
+          the fine elements that contain it (the last one, as in the
+          element-by-element Mult) and the coarse DOFs of its parent. The rows
+          of all local matrices are stored without their zero entries, so the
+          rows of the elements that were not refined have a single entry. */
+      bool batched;
+      /// Rows of the local matrices in CSR format, with local column indices.
+      Array<int> row_I, row_J;
+      Vector row_A;
+      /// Local row of each fine DOF.
+      Array<int> dof_row;
+      /// Offset of the coarse DOFs of the parent of the fine element in the
+      /// J array of old_elem_dof, for each fine DOF, -1-offset if negated.
+      Array<int> dof_parent;
+
       void ConstructDoFTransArray();
+      void ConstructBatched();
+      void BatchedMult(const Vector &x, Vector &y) const;
 
    public:
       /** Construct the operator based on the elem_dof table of the original
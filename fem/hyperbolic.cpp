@@ -27,6 +27,10 @@ HyperbolicFormIntegrator::HyperbolicFormIntegrator(
      fluxFunction(numFlux.GetFluxFunction()),
      IntOrderOffset(IntOrderOffset),
      sign(sign),
+     dim(0), ne(0), nf(0), nq(0), nq_face(0),
+     maps(nullptr),
+     face_maps(nullptr),
+     qi(nullptr),
      num_equations(fluxFunction.num_equations)
 {
 #ifndef MFEM_THREAD_SAFE
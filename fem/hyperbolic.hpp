@@ -311,8 +311,21 @@ private:
    const int IntOrderOffset; // integration order offset, 2*p + IntOrderOffset.
    const real_t sign;
 
-   // The maximum characteristic speed, updated during element/face vector assembly
-   real_t max_char_speed;
+   // The maximum characteristic speed, updated during element/face vector
+   // assembly and during the partial assembly action
+   mutable real_t max_char_speed;
+
+   // Partial assembly data
+   int dim, ne, nf, nq, nq_face;
+   const DofToQuad *maps;        // domain shape functions, tensor
+   const DofToQuad *face_maps;   // trace shape functions, tensor
+   const QuadratureInterpolator *qi;
+   Vector pa_data;               // sign*w*adj(J), (NQ, dim, dim, NE)
+   Vector pa_face_data;          // scaled normal n*|J|, (NQ, dim, NF)
+   mutable Vector q_state;       // state at the quadrature points
+   mutable Vector q_flux;        // reference flux at the quadrature points
+   mutable Vector q_speed;       // characteristic speed, domain points
+   mutable Vector face_speed;    // characteristic speed, face points
 
 #ifndef MFEM_THREAD_SAFE
    // Local storage for element integration
@@ -410,6 +423,49 @@ public:
                          const FiniteElement &el2,
                          FaceElementTransformations &Tr,
                          const Vector &elfun, DenseMatrix &elmat) override;
+
+   using NonlinearFormIntegrator::AssemblePA;
+
+   /**
+    * @brief Setup the partial assembly of the (F(u), ∇v) term
+    *
+    * Supported for tensor-product elements in 2D and 3D with BurgersFlux,
+    * ShallowWaterFlux or EulerFlux. The space must have vdim equal to
+    * #num_equations.
+    *
+    * @param[in] fes finite element space
+    */
+   void AssemblePA(const FiniteElementSpace &fes) override;
+
+   /**
+    * @brief Partial assembly action of the (F(u), ∇v) term. Updates the
+    * maximum characteristic speed.
+    *
+    * @param[in] x state E-vector, lexicographic ordering
+    * @param[in,out] y E-vector where the result is added
+    */
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   /**
+    * @brief Setup the partial assembly of the <-F̂(u⁻,u⁺,x) n, [v]> term on
+    * the interior faces
+    *
+    * In addition to the requirements of AssemblePA(), the numerical flux must
+    * be a RusanovFlux or a ComponentwiseUpwindFlux and the space must use a
+    * Gauss-Lobatto basis.
+    *
+    * @param[in] fes finite element space
+    */
+   void AssemblePAInteriorFaces(const FiniteElementSpace &fes) override;
+
+   /**
+    * @brief Partial assembly action of the <-F̂(u⁻,u⁺,x) n, [v]> term on the
+    * interior faces. Updates the maximum characteristic speed.
+    *
+    * @param[in] x double-valued interior face E-vector of the state
+    * @param[in,out] y double-valued face E-vector where the result is added
+    */
+   void AddMultPAInteriorFaces(const Vector &x, Vector &y) const override;
 };
 
 /**
@@ -1016,6 +1072,9 @@ public:
    ShallowWaterFlux(const int dim, const real_t g=9.8)
       : FluxFunction(dim + 1, dim), g(g) {}
 
+   /// Get the gravity constant
+   real_t GetGravity() const { return g; }
+
    /**
     * @brief Compute F(h, hu)
     *
@@ -1060,6 +1119,9 @@ public:
       : FluxFunction(dim + 2, dim),
         specific_heat_ratio(specific_heat_ratio) {}
 
+   /// Get the specific heat ratio, γ
+   real_t GetSpecificHeatRatio() const { return specific_heat_ratio; }
+
    /**
     * @brief Compute F(ρ, ρu, E)
     *
@@ -213,16 +213,170 @@ void ConvectionIntegrator::AssemblePA(const FiniteElementSpace &fes)
                      vel, alpha, pa_data);
 }
 
+// PA Convection Diagonal 2D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAConvectionDiagonal2D(const int NE,
+                                   const Array<real_t> &b,
+                                   const Array<real_t> &g,
+                                   const Vector &op_,
+                                   Vector &diag,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto op = Reshape(op_.Read(), Q1D, Q1D, 2, NE);
+   auto Y = Reshape(diag.ReadWrite(), D1D, D1D, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      // The diagonal entry of dof (dx,dy) is the sum over the quadrature
+      // points of (O1 Gx By + O2 Bx Gy) Bx By
+      real_t QD0[MQ1][MD1];
+      real_t QD1[MQ1][MD1];
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            QD0[qx][dy] = 0.0;
+            QD1[qx][dy] = 0.0;
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const real_t By = B(qy,dy);
+               QD0[qx][dy] += By * By * op(qx,qy,0,e);
+               QD1[qx][dy] += By * G(qy,dy) * op(qx,qy,1,e);
+            }
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            real_t temp = 0.0;
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const real_t Bx = B(qx,dx);
+               temp += Bx * G(qx,dx) * QD0[qx][dy];
+               temp += Bx * Bx * QD1[qx][dy];
+            }
+            Y(dx,dy,e) += temp;
+         }
+      }
+   });
+}
+
+// PA Convection Diagonal 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAConvectionDiagonal3D(const int NE,
+                                   const Array<real_t> &b,
+                                   const Array<real_t> &g,
+                                   const Vector &op_,
+                                   Vector &diag,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto op = Reshape(op_.Read(), Q1D, Q1D, Q1D, 3, NE);
+   auto Y = Reshape(diag.ReadWrite(), D1D, D1D, D1D, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      // The three terms are O1 Gx By Bz, O2 Bx Gy Bz and O3 Bx By Gz, each
+      // multiplied by the test function Bx By Bz
+      real_t QQD[MQ1][MQ1][MD1];
+      real_t QDD[MQ1][MD1][MD1];
+      for (int k = 0; k < 3; ++k)
+      {
+         // first tensor contraction, along z direction
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int dz = 0; dz < D1D; ++dz)
+               {
+                  QQD[qx][qy][dz] = 0.0;
+                  for (int qz = 0; qz < Q1D; ++qz)
+                  {
+                     const real_t Bz = B(qz,dz);
+                     const real_t L = k == 2 ? G(qz,dz) : Bz;
+                     QQD[qx][qy][dz] += L * op(qx,qy,qz,k,e) * Bz;
+                  }
+               }
+            }
+         }
+         // second tensor contraction, along y direction
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int dz = 0; dz < D1D; ++dz)
+            {
+               for (int dy = 0; dy < D1D; ++dy)
+               {
+                  QDD[qx][dy][dz] = 0.0;
+                  for (int qy = 0; qy < Q1D; ++qy)
+                  {
+                     const real_t By = B(qy,dy);
+                     const real_t L = k == 1 ? G(qy,dy) : By;
+                     QDD[qx][dy][dz] += L * QQD[qx][qy][dz] * By;
+                  }
+               }
+            }
+         }
+         // third tensor contraction, along x direction
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  real_t temp = 0.0;
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     const real_t Bx = B(qx,dx);
+                     const real_t L = k == 0 ? G(qx,dx) : Bx;
+                     temp += L * QDD[qx][dy][dz] * Bx;
+                  }
+                  Y(dx,dy,dz,e) += temp;
+               }
+            }
+         }
+      }
+   });
+}
+
 void ConvectionIntegrator::AssembleDiagonalPA(Vector &diag)
 {
    if (DeviceCanUseCeed())
    {
       ceedOp->GetDiagonal(diag);
    }
+   else if (dim == 2)
+   {
+      PAConvectionDiagonal2D(ne, maps->B, maps->G, pa_data, diag,
+                             dofs1D, quad1D);
+   }
+   else if (dim == 3)
+   {
+      PAConvectionDiagonal3D(ne, maps->B, maps->G, pa_data, diag,
+                             dofs1D, quad1D);
+   }
    else
    {
-      MFEM_ABORT("AssembleDiagonalPA not yet implemented for"
-                 " ConvectionIntegrator.");
+      MFEM_ABORT("Dimension not implemented.");
    }
 }
 
@@ -260,6 +414,13 @@ ConvectionIntegrator::ApplyPATKernels::Fallback(int DIM, int, int)
    }
 }
 
+OperatorCostModel ConvectionIntegrator::GetCostModelPA() const
+{
+   if (DeviceCanUseCeed()) { return BilinearFormIntegrator::GetCostModelPA(); }
+   // The gradient is dotted with the velocity at each point.
+   return PACostModel(*maps, dim, ne, 1, dim, 1, 2.0*dim, pa_data);
+}
+
 void ConvectionIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
    if (DeviceCanUseCeed())
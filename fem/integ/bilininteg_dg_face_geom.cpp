@@ -0,0 +1,202 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bilininteg_dg_face_geom.hpp"
+#include "../fe/face_map_utils.hpp"
+#include "../fespace.hpp"
+#include "../../general/forall.hpp"
+#ifdef MFEM_USE_MPI
+#include "../../mesh/pmesh.hpp"
+#endif
+
+namespace mfem
+{
+
+namespace internal
+{
+
+// Index of the reference coordinate normal to the given local face of a
+// quadrilateral (dim = 2) or hexahedron (dim = 3).
+static int FaceNormalAxis(const int dim, const int local_face_id)
+{
+   if (dim == 2) { return (local_face_id == 1 || local_face_id == 3) ? 0 : 1; }
+   return GetFaceNormal3D(local_face_id).first;
+}
+
+DGFaceGeometry::DGFaceGeometry(Mesh &mesh_, const IntegrationRule &ir1d_)
+   : mesh(mesh_),
+     dim(mesh.Dimension()),
+     q1d(ir1d_.GetNPoints()),
+     ir1d(ir1d_),
+     face_ir((dim == 2) ? q1d : q1d*q1d),
+     nsides(0)
+{
+   MFEM_VERIFY(dim == 2 || dim == 3, "Unsupported dimension.");
+   MFEM_VERIFY(q1d >= 2 && ir1d.IntPoint(0).x == 0.0 &&
+               ir1d.IntPoint(q1d-1).x == 1.0,
+               "The 1D points must include the end points.");
+   R[0].SetSize(dim);
+   R[1].SetSize(dim);
+}
+
+void DGFaceGeometry::SetFace(int f, const Mesh::FaceInformation &face)
+{
+   MFEM_ASSERT(!face.IsNonconformingCoarse(), "Invalid face.");
+   if (face.IsShared())
+   {
+#ifdef MFEM_USE_MPI
+      ParMesh *pmesh = dynamic_cast<ParMesh*>(&mesh);
+      MFEM_VERIFY(pmesh, "Shared face on a serial mesh.");
+      pmesh->GetSharedFaceTransformationsByLocalIndex(f, T, T1, T2);
+#endif
+   }
+   else
+   {
+      mesh.GetFaceElementTransformations(f, T, T1, T2);
+   }
+   nsides = face.IsInterior() ? 2 : 1;
+
+   // The map from the face reference coordinates r to the reference
+   // coordinates of the first element is affine: xi = c + M r. Invert it (in
+   // the least squares sense) at the lexicographic points of the first element.
+   IntegrationPoint r, xi;
+   real_t c[3], xi_r[3];
+   r.Init(0);
+   T.Loc1.Transform(r, xi);
+   xi.Get(c, dim);
+   DenseMatrix M(dim, dim-1);
+   for (int a = 0; a < dim-1; ++a)
+   {
+      r.Init(0);
+      if (a == 0) { r.x = 1.0; }
+      else { r.y = 1.0; }
+      T.Loc1.Transform(r, xi);
+      xi.Get(xi_r, dim);
+      for (int i = 0; i < dim; ++i) { M(i, a) = xi_r[i] - c[i]; }
+   }
+   DenseMatrix MtM(dim-1), P(dim-1, dim);
+   MultAtB(M, M, MtM);
+   MtM.Invert();
+   MultABt(MtM, M, P);
+
+   const int fid0 = face.element[0].local_face_id;
+   for (int p = 0; p < face_ir.GetNPoints(); ++p)
+   {
+      int ijk[3] = {0, 0, 0};
+      real_t w;
+      if (dim == 2)
+      {
+         FaceIdxToVolIdx2D(p, q1d, fid0, -1, 0, ijk[0], ijk[1]);
+         w = ir1d.IntPoint(p).weight;
+      }
+      else
+      {
+         FaceIdxToVolIdx3D(p, q1d, fid0, -1, 0, 0, ijk[0], ijk[1], ijk[2]);
+         w = ir1d.IntPoint(p % q1d).weight * ir1d.IntPoint(p / q1d).weight;
+      }
+      real_t rp[2] = {0.0, 0.0};
+      for (int a = 0; a < dim-1; ++a)
+      {
+         for (int i = 0; i < dim; ++i)
+         {
+            rp[a] += P(a, i) * (ir1d.IntPoint(ijk[i]).x - c[i]);
+         }
+      }
+      face_ir.IntPoint(p).Set(rp[0], rp[1], 0.0, w);
+   }
+
+   SetupDerivativeMap(0, fid0);
+   if (nsides == 2)
+   {
+      SetupDerivativeMap(1, face.element[1].local_face_id);
+   }
+}
+
+void DGFaceGeometry::SetupDerivativeMap(int side, int local_face_id)
+{
+   IntegrationPointTransformation &loc = (side == 0) ? T.Loc1 : T.Loc2;
+
+   const int n = FaceNormalAxis(dim, local_face_id);
+   int t[2];
+   for (int k = 0, i = 0; k < dim; ++k)
+   {
+      if (k != n) { t[i++] = k; }
+   }
+
+   // The map from the lexicographic face coordinates s (relative to the first
+   // element) to the tangential reference coordinates of this side is affine:
+   // A(i, a) = d xi_{t_i} / d s_a.
+   IntegrationPoint xi;
+   real_t xi0[3], xi1[3];
+   loc.Transform(face_ir.IntPoint(0), xi);
+   xi.Get(xi0, dim);
+   DenseMatrix A(dim-1);
+   for (int a = 0; a < dim-1; ++a)
+   {
+      const int p = (a == 0) ? (q1d - 1) : (q1d - 1)*q1d;
+      loc.Transform(face_ir.IntPoint(p), xi);
+      xi.Get(xi1, dim);
+      for (int i = 0; i < dim-1; ++i) { A(i, a) = xi1[t[i]] - xi0[t[i]]; }
+   }
+   A.Invert();
+
+   // du/dxi_{t_i} = sum_a A^{-1}(a, i) du/ds_a
+   DenseMatrix &Rs = R[side];
+   Rs = 0.0;
+   Rs(0, n) = 1.0;
+   for (int a = 0; a < dim-1; ++a)
+   {
+      for (int i = 0; i < dim-1; ++i)
+      {
+         Rs(1 + a, t[i]) = A(a, i);
+      }
+   }
+}
+
+FaceElementTransformations &DGFaceGeometry::SetPoint(int p)
+{
+   T.SetAllIntPoints(&face_ir.IntPoint(p));
+   return T;
+}
+
+void GetDGNonconformingFaceInfo(const FiniteElementSpace &fes,
+                                Array<int> &nc_info_, Vector &nc_interp)
+{
+   nc_info_.SetSize(0);
+   nc_interp.SetSize(0);
+
+   Mesh &mesh = *fes.GetMesh();
+   if (!mesh.Nonconforming()) { return; }
+
+   const FaceType type = FaceType::Interior;
+   const InterpolationManager &interpolations =
+      fes.GetInterpolationManager(ElementDofOrdering::LEXICOGRAPHIC, type);
+   if (interpolations.GetNumInterpolators() == 0) { return; }
+
+   MFEM_VERIFY(mesh.GetNumFacesWithGhost() == mesh.GetNumFaces(),
+               "Nonconforming shared faces are not supported.");
+
+   const Array<InterpConfig> &config = interpolations.GetFaceInterpConfig();
+   const int nf = config.Size();
+   nc_interp = interpolations.GetInterpolators();
+   nc_info_.SetSize(2 * nf);
+   auto nc_info = Reshape(nc_info_.HostWrite(), 2, nf);
+   for (int f = 0; f < nf; ++f)
+   {
+      const InterpConfig conf = config[f];
+      nc_info(0, f) = conf.is_non_conforming ? (int) conf.master_side : -1;
+      nc_info(1, f) = conf.is_non_conforming ? (int) conf.index : 0;
+   }
+}
+
+} // namespace internal
+
+} // namespace mfem
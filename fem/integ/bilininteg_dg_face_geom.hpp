@@ -0,0 +1,95 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_BILININTEG_DG_FACE_GEOM_HPP
+#define MFEM_BILININTEG_DG_FACE_GEOM_HPP
+
+#include "../../config/config.hpp"
+#include "../../mesh/mesh.hpp"
+#include "../eltrans.hpp"
+
+/// \cond DO_NOT_DOCUMENT
+namespace mfem
+{
+
+class FiniteElementSpace;
+
+namespace internal
+{
+
+/// @brief Host-side geometric information at the quadrature points of a face
+/// of a tensor-product mesh, used to set up the partial assembly data of the
+/// DG face integrators.
+///
+/// The face quadrature points are the tensor product of the 1D points @a ir1d
+/// given in the constructor (which must include the end points, e.g.
+/// Gauss-Lobatto), ordered lexicographically relative to the first element of
+/// the face, consistently with the face E-vectors. Contrary to the volume
+/// GeometricFactors, this class can be used on the coarse side of
+/// nonconforming faces and on shared faces.
+class DGFaceGeometry
+{
+   Mesh &mesh;
+   const int dim;
+   const int q1d;
+   const IntegrationRule &ir1d;
+
+   FaceElementTransformations T;
+   IsoparametricTransformation T1, T2;
+   IntegrationRule face_ir; ///< Points in the face reference coordinates.
+   DenseMatrix R[2];
+   int nsides;
+
+   void SetupDerivativeMap(int side, int local_face_id);
+
+public:
+   DGFaceGeometry(Mesh &mesh_, const IntegrationRule &ir1d_);
+
+   /// Set the mesh face @a f, with face information @a face.
+   void SetFace(int f, const Mesh::FaceInformation &face);
+
+   /// Number of quadrature points on the face.
+   int GetNPoints() const { return face_ir.GetNPoints(); }
+
+   /// Number of sides of the current face (1 on boundary faces, 2 otherwise).
+   int GetNSides() const { return nsides; }
+
+   /** @brief Set the quadrature point @a p of the current face in the face and
+       neighboring element transformations, and return them. */
+   FaceElementTransformations &SetPoint(int p);
+
+   /** @brief Return the matrix mapping the face-local derivatives to the
+       reference derivatives of the element on side @a side of the face.
+
+       The face-local derivatives of a function u are g_0 = du/dn (the
+       derivative in the direction of the reference coordinate normal to the
+       face, as computed by L2NormalDerivativeFaceRestriction), and g_1 (and
+       g_2 in 3D), the derivatives along the (lexicographic) face coordinates
+       relative to the first element. The reference derivatives are then given
+       by du/dxi_k = sum_j g_j R(j,k). */
+   const DenseMatrix &GetDerivativeMap(int side) const { return R[side]; }
+};
+
+/** @brief Fill @a nc_info with the pair (master side, interpolator index) for
+    each interior face of @a fes, where the master side is -1 on conforming
+    faces, and @a nc_interp with the coarse-to-fine face interpolators, see
+    InterpolationManager.
+
+    Both arrays are left empty if the mesh has no nonconforming faces. */
+void GetDGNonconformingFaceInfo(const FiniteElementSpace &fes,
+                                Array<int> &nc_info, Vector &nc_interp);
+
+} // namespace internal
+
+} // namespace mfem
+/// \endcond DO_NOT_DOCUMENT
+
+#endif
@@ -30,7 +30,9 @@ static void PADGDiffusionApply2D(const int NF, const Array<real_t> &b,
                                  const Array<real_t> &bt,
                                  const Array<real_t> &g,
                                  const Array<real_t> &gt, const real_t sigma,
-                                 const Vector &pa_data, const Vector &x_,
+                                 const Vector &pa_data,
+                                 const Array<int> &nc_info_,
+                                 const Vector &nc_interp_, const Vector &x_,
                                  const Vector &dxdn_, Vector &y_, Vector &dydn_,
                                  const int d1d = 0, const int q1d = 0)
 {
@@ -45,6 +47,14 @@ static void PADGDiffusionApply2D(const int NF, const Array<real_t> &b,
    auto pa =
       Reshape(pa_data.Read(), 6, Q1D, NF); // (q, 1/h, J00, J01, J10, J11)
 
+   // (master side, interpolator index), master side is -1 on conforming faces
+   const bool has_nc = nc_info_.Size() > 0;
+   MFEM_VERIFY(!has_nc || D1D <= Q1D, "Nonconforming faces require Q1D >= D1D.");
+   auto nc_info = Reshape(has_nc ? nc_info_.Read() : nullptr, 2, NF);
+   const int n_interp = nc_interp_.Size() / (D1D * D1D);
+   auto interp = Reshape(has_nc ? nc_interp_.Read() : nullptr, D1D, D1D,
+                         n_interp);
+
    auto x = Reshape(x_.Read(), D1D, 2, NF);
    auto y = Reshape(y_.ReadWrite(), D1D, 2, NF);
    auto dxdn = Reshape(dxdn_.Read(), D1D, 2, NF);
@@ -73,6 +83,12 @@ static void PADGDiffusionApply2D(const int NF, const Array<real_t> &b,
       DeviceMatrix B(BG, Q1D, D1D);
       DeviceMatrix G(BG + D1D * Q1D, Q1D, D1D);
 
+      // On the nonconforming faces, the normal derivatives on the master
+      // (coarse) side are interpolated to the slave (fine) face.
+      const int nc_side = has_nc ? nc_info(0, f) : -1;
+      const int nc_idx = has_nc ? nc_info(1, f) : 0;
+      real_t *du_nc = (nc_side == 0) ? du0 : du1;
+
       if (MFEM_THREAD_ID(y) == 0)
       {
          MFEM_FOREACH_THREAD(p, x, Q1D)
@@ -99,6 +115,28 @@ static void PADGDiffusionApply2D(const int NF, const Array<real_t> &b,
       }
       MFEM_SYNC_THREAD;
 
+      if (nc_side >= 0)
+      {
+         if (MFEM_THREAD_ID(y) == 0)
+         {
+            MFEM_FOREACH_THREAD(d, x, D1D)
+            {
+               real_t res = 0.0;
+               for (int k = 0; k < D1D; ++k)
+               {
+                  res += interp(d, k, nc_idx) * du_nc[k];
+               }
+               r[d] = res;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         if (MFEM_THREAD_ID(y) == 0)
+         {
+            MFEM_FOREACH_THREAD(d, x, D1D) { du_nc[d] = r[d]; }
+         }
+         MFEM_SYNC_THREAD;
+      }
+
       // eval @ quad points
       MFEM_FOREACH_THREAD(side, y, 2)
       {
@@ -186,6 +224,29 @@ static void PADGDiffusionApply2D(const int NF, const Array<real_t> &b,
       }
       MFEM_SYNC_THREAD;
 
+      // transpose of the master side interpolation
+      if (nc_side >= 0)
+      {
+         if (MFEM_THREAD_ID(y) == 0)
+         {
+            MFEM_FOREACH_THREAD(k, x, D1D)
+            {
+               real_t res = 0.0;
+               for (int d = 0; d < D1D; ++d)
+               {
+                  res += interp(d, k, nc_idx) * du_nc[d];
+               }
+               r[k] = res;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         if (MFEM_THREAD_ID(y) == 0)
+         {
+            MFEM_FOREACH_THREAD(k, x, D1D) { du_nc[k] = r[k]; }
+         }
+         MFEM_SYNC_THREAD;
+      }
+
       MFEM_FOREACH_THREAD(side, y, 2)
       {
          real_t *u = (side == 0) ? u0 : u1;
@@ -204,7 +265,9 @@ static void PADGDiffusionApply3D(const int NF, const Array<real_t> &b,
                                  const Array<real_t> &bt,
                                  const Array<real_t> &g,
                                  const Array<real_t> &gt, const real_t sigma,
-                                 const Vector &pa_data, const Vector &x_,
+                                 const Vector &pa_data,
+                                 const Array<int> &nc_info_,
+                                 const Vector &nc_interp_, const Vector &x_,
                                  const Vector &dxdn_, Vector &y_, Vector &dydn_,
                                  const int d1d = 0, const int q1d = 0)
 {
@@ -219,6 +282,14 @@ static void PADGDiffusionApply3D(const int NF, const Array<real_t> &b,
    // (J0[0], J0[1], J0[2], J1[0], J1[1], J1[2], q/h)
    auto pa = Reshape(pa_data.Read(), 7, Q1D, Q1D, NF);
 
+   // (master side, interpolator index), master side is -1 on conforming faces
+   const bool has_nc = nc_info_.Size() > 0;
+   MFEM_VERIFY(!has_nc || D1D <= Q1D, "Nonconforming faces require Q1D >= D1D.");
+   auto nc_info = Reshape(has_nc ? nc_info_.Read() : nullptr, 2, NF);
+   const int n_interp = nc_interp_.Size() / (D1D * D1D * D1D * D1D);
+   auto interp = Reshape(has_nc ? nc_interp_.Read() : nullptr, D1D, D1D, D1D,
+                         D1D, n_interp);
+
    auto x = Reshape(x_.Read(), D1D, D1D, 2, NF);
    auto y = Reshape(y_.ReadWrite(), D1D, D1D, 2, NF);
    auto dxdn = Reshape(dxdn_.Read(), D1D, D1D, 2, NF);
@@ -262,6 +333,12 @@ static void PADGDiffusionApply3D(const int NF, const Array<real_t> &b,
       DeviceMatrix B(BG, Q1D, D1D);
       DeviceMatrix G(BG + D1D * Q1D, Q1D, D1D);
 
+      // On the nonconforming faces, the normal derivatives on the master
+      // (coarse) side are interpolated to the slave (fine) face.
+      const int nc_side = has_nc ? nc_info(0, f) : -1;
+      const int nc_idx = has_nc ? nc_info(1, f) : 0;
+      real_t(*du_nc)[max_Q1D] = (nc_side == 0) ? du0 : du1;
+
       // copy face values to u0, u1 and copy normals to du0, du1
       MFEM_FOREACH_THREAD(side, z, 2)
       {
@@ -308,6 +385,41 @@ static void PADGDiffusionApply3D(const int NF, const Array<real_t> &b,
       }
       MFEM_SYNC_THREAD;
 
+      if (nc_side >= 0)
+      {
+         // kappa_Qh is loaded above, use Gu0 as temporary storage
+         if (MFEM_THREAD_ID(z) == 0)
+         {
+            MFEM_FOREACH_THREAD(d2, x, D1D)
+            {
+               MFEM_FOREACH_THREAD(d1, y, D1D)
+               {
+                  real_t res = 0.0;
+                  for (int k2 = 0; k2 < D1D; ++k2)
+                  {
+                     for (int k1 = 0; k1 < D1D; ++k1)
+                     {
+                        res += interp(d1, d2, k1, k2, nc_idx) * du_nc[k2][k1];
+                     }
+                  }
+                  Gu0[d2][d1] = res;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         if (MFEM_THREAD_ID(z) == 0)
+         {
+            MFEM_FOREACH_THREAD(d2, x, D1D)
+            {
+               MFEM_FOREACH_THREAD(d1, y, D1D)
+               {
+                  du_nc[d2][d1] = Gu0[d2][d1];
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+
       // eval u and normal derivative @ quad points
       MFEM_FOREACH_THREAD(side, z, 2)
       {
@@ -461,6 +573,41 @@ static void PADGDiffusionApply3D(const int NF, const Array<real_t> &b,
       }
       MFEM_SYNC_THREAD;
 
+      // transpose of the master side interpolation
+      if (nc_side >= 0)
+      {
+         if (MFEM_THREAD_ID(z) == 0)
+         {
+            MFEM_FOREACH_THREAD(k2, x, D1D)
+            {
+               MFEM_FOREACH_THREAD(k1, y, D1D)
+               {
+                  real_t res = 0.0;
+                  for (int d2 = 0; d2 < D1D; ++d2)
+                  {
+                     for (int d1 = 0; d1 < D1D; ++d1)
+                     {
+                        res += interp(d1, d2, k1, k2, nc_idx) * du_nc[d2][d1];
+                     }
+                  }
+                  Gu0[k2][k1] = res;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         if (MFEM_THREAD_ID(z) == 0)
+         {
+            MFEM_FOREACH_THREAD(k2, x, D1D)
+            {
+               MFEM_FOREACH_THREAD(k1, y, D1D)
+               {
+                  du_nc[k2][k1] = Gu0[k2][k1];
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+
       // map back to y and dydn
       MFEM_FOREACH_THREAD(side, z, 2)
       {
@@ -15,6 +15,7 @@
 #include "../gridfunc.hpp"
 #include "../qfunction.hpp"
 
+#include "bilininteg_dg_face_geom.hpp"
 #include "bilininteg_dgdiffusion_kernels.hpp"
 
 namespace mfem
@@ -323,7 +324,7 @@ static void PADGDiffusionSetupFaceInfo2D(const int nf, const Mesh &mesh,
    {
       auto f_info = mesh.GetFaceInformation(f);
 
-      if (f_info.IsOfFaceType(type))
+      if (f_info.IsOfFaceType(type) && !f_info.IsNonconformingCoarse())
       {
          const int face_id_1 = f_info.element[0].local_face_id;
          face_info(0, fidx) = (face_id_1 == 1 || face_id_1 == 3) ? 0 : 1;
@@ -453,7 +454,7 @@ static void PADGDiffusionSetupFaceInfo3D(const int nf, const Mesh &mesh,
    {
       auto f_info = mesh.GetFaceInformation(f);
 
-      if (f_info.IsOfFaceType(type))
+      if (f_info.IsOfFaceType(type) && !f_info.IsNonconformingCoarse())
       {
          const int fid0 = f_info.element[0].local_face_id;
          const int or0 = f_info.element[0].orientation;
@@ -496,6 +497,110 @@ static void PADGDiffusionSetupFaceInfo3D(const int nf, const Mesh &mesh,
    }
 }
 
+// Recompute the partial assembly data on the nonconforming interior faces,
+// where the quadrature points do not coincide with the Gauss-Lobatto points of
+// the master (coarse) element. The master side normal derivatives are
+// interpolated to the slave (fine) face in the kernels.
+static void PADGDiffusionSetupNonconforming(const FiniteElementSpace &fes,
+                                            const IntegrationRule &ir1d,
+                                            const IntegrationRule &ir,
+                                            const FaceGeometricFactors &face_geom,
+                                            const Vector &q, const int coeff_dim,
+                                            const real_t kappa,
+                                            const Array<int> &nc_info_,
+                                            Vector &pa_data)
+{
+   const FaceType type = FaceType::Interior;
+   Mesh &mesh = *fes.GetMesh();
+   const int dim = mesh.Dimension();
+   const int nf = fes.GetNFbyType(type);
+   const int nq = ir.GetNPoints();
+
+   const auto nc_info = Reshape(nc_info_.HostRead(), 2, nf);
+
+   const bool const_q = (q.Size() == coeff_dim);
+   const real_t *h_q = q.HostRead();
+   const auto n = Reshape(face_geom.normal.HostRead(), nq, dim, nf);
+   const auto detJf = Reshape(face_geom.detJ.HostRead(), nq, nf);
+   const real_t *W = ir.GetWeights().HostRead();
+
+   // 2D: (q, 1/h, J0_0, J0_1, J1_0, J1_1)
+   // 3D: (J00, J01, J02, J10, J11, J12, q/h)
+   auto pa = Reshape(pa_data.HostReadWrite(), (dim == 2) ? 6 : 7, nq, nf);
+
+   internal::DGFaceGeometry geom(mesh, ir1d);
+   DenseMatrix adjJ(dim);
+   Vector Qtn(dim), nJi(dim);
+
+   int fidx = 0;
+   for (int f = 0; f < mesh.GetNumFaces(); ++f)
+   {
+      const Mesh::FaceInformation face = mesh.GetFaceInformation(f);
+      if (!face.IsOfFaceType(type) || face.IsNonconformingCoarse()) { continue; }
+      if (nc_info(0, fidx) < 0) { fidx++; continue; }
+
+      MFEM_VERIFY(!face.IsShared(),
+                  "Nonconforming shared faces are not supported.");
+
+      geom.SetFace(f, face);
+      for (int p = 0; p < nq; ++p)
+      {
+         FaceElementTransformations &T = geom.SetPoint(p);
+
+         const real_t *qp = const_q ? h_q : h_q + coeff_dim*(p + nq*fidx);
+         real_t qh = 0.0;
+         if (coeff_dim > 1)
+         {
+            // matrix coefficient
+            for (int i = 0; i < dim; ++i)
+            {
+               Qtn(i) = 0.0;
+               for (int j = 0; j < dim; ++j)
+               {
+                  Qtn(i) += qp[j + dim*i] * n(p, j, fidx);
+               }
+               qh += Qtn(i) * n(p, i, fidx);
+            }
+         }
+         else
+         {
+            qh = qp[0];
+            for (int i = 0; i < dim; ++i) { Qtn(i) = qh * n(p, i, fidx); }
+         }
+
+         const real_t dJf = detJf(p, fidx);
+         real_t hi = 0.0;
+         for (int side = 0; side < 2; ++side)
+         {
+            ElementTransformation &Te = (side == 0) ? *T.Elem1 : *T.Elem2;
+            const DenseMatrix &J = Te.Jacobian();
+            CalcAdjugate(J, adjJ);
+            adjJ.Mult(Qtn, nJi);
+
+            const real_t dJe = J.Det();
+            const real_t w = 0.5 * W[p] * dJf / dJe;
+
+            // Coefficients of the face-local derivatives (normal derivative
+            // and tangential derivatives along the face coordinates)
+            const DenseMatrix &R = geom.GetDerivativeMap(side);
+            for (int j = 0; j < dim; ++j)
+            {
+               real_t nJi_j = 0.0;
+               for (int k = 0; k < dim; ++k) { nJi_j += R(j, k) * nJi(k); }
+               const int idx = (dim == 2) ? (2 + 2*side + j) : (3*side + j);
+               pa(idx, p, fidx) = w * nJi_j;
+            }
+
+            hi += 0.5 * dJf / dJe;
+         }
+
+         if (dim == 2) { pa(1, p, fidx) = hi; }
+         else { pa(6, p, fidx) = kappa * hi * qh * W[p] * dJf; }
+      }
+      fidx++;
+   }
+}
+
 void DGDiffusionIntegrator::SetupPA(const FiniteElementSpace &fes,
                                     FaceType type)
 {
@@ -566,6 +671,19 @@ void DGDiffusionIntegrator::SetupPA(const FiniteElementSpace &fes,
                            *face_geom, nbr_geom.get(), q, coeff_dim, sigma,
                            kappa, pa_data, face_info);
    }
+
+   nc_info.SetSize(0);
+   nc_interp.SetSize(0);
+   if (type == FaceType::Interior)
+   {
+      internal::GetDGNonconformingFaceInfo(fes, nc_info, nc_interp);
+   }
+   if (nc_info.Size() > 0)
+   {
+      const IntegrationRule &ir1d = irs.Get(Geometry::SEGMENT, ir_order);
+      PADGDiffusionSetupNonconforming(fes, ir1d, ir, *face_geom, q, coeff_dim,
+                                      kappa, nc_info, pa_data);
+   }
 }
 
 void DGDiffusionIntegrator::AssemblePAInteriorFaces(
@@ -586,8 +704,8 @@ void DGDiffusionIntegrator::AddMultPAFaceNormalDerivatives(const Vector &x,
                                                            Vector &dydn) const
 {
    ApplyPAKernels::Run(dim, dofs1D, quad1D, nf, maps->B, maps->Bt, maps->G,
-                       maps->Gt, sigma, pa_data, x, dxdn, y, dydn, dofs1D,
-                       quad1D);
+                       maps->Gt, sigma, pa_data, nc_info, nc_interp, x, dxdn,
+                       y, dydn, dofs1D, quad1D);
 }
 
 DGDiffusionIntegrator::DGDiffusionIntegrator(const real_t s, const real_t k)
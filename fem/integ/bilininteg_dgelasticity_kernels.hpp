@@ -0,0 +1,623 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_BILININTEG_DGELASTICITY_KERNELS_HPP
+#define MFEM_BILININTEG_DGELASTICITY_KERNELS_HPP
+
+#include "../../general/forall.hpp"
+#include "../bilininteg.hpp"
+
+/// \cond DO_NOT_DOCUMENT
+namespace mfem
+{
+
+namespace internal
+{
+
+// Size of the partial assembly data at each face quadrature point:
+// (nor, pen, [w lambda, w mu, Z] on side 0, [w lambda, w mu, Z] on side 1),
+// where nor is the (non-unit) face normal, pen is the penalty coefficient, and
+// Z = R J^{-1} maps the face-local derivatives to the physical derivatives.
+template <int DIM>
+constexpr int PADGElasticityDataSize() { return 1 + DIM + 2*(2 + DIM*DIM); }
+
+// Point-wise evaluation of the DG elasticity face terms. The input is the value
+// u[s][c] and the face-local derivatives g[s][c][j] (see
+// internal::DGFaceGeometry) of each component c on both sides s of the face,
+// and the output is the corresponding test function coefficients ru and rg.
+template <int DIM>
+MFEM_HOST_DEVICE inline
+void PADGElasticityQFunction(const real_t alpha, const real_t *pa,
+                             const real_t (&u)[2][DIM],
+                             const real_t (&g)[2][DIM][DIM],
+                             real_t (&ru)[2][DIM], real_t (&rg)[2][DIM][DIM])
+{
+   const real_t *nor = pa;
+   const real_t pen = pa[DIM];
+
+   // F = {sigma(u)} . nor, scaled by the quadrature weight
+   real_t F[DIM];
+   for (int a = 0; a < DIM; ++a) { F[a] = 0.0; }
+   for (int s = 0; s < 2; ++s)
+   {
+      const real_t *pa_s = pa + 1 + DIM + s*(2 + DIM*DIM);
+      const real_t wL = pa_s[0], wM = pa_s[1];
+      const real_t *Z = pa_s + 2;
+
+      real_t grad[DIM][DIM];
+      real_t div = 0.0;
+      for (int a = 0; a < DIM; ++a)
+      {
+         for (int b = 0; b < DIM; ++b)
+         {
+            real_t v = 0.0;
+            for (int j = 0; j < DIM; ++j) { v += g[s][a][j] * Z[j*DIM + b]; }
+            grad[a][b] = v;
+         }
+         div += grad[a][a];
+      }
+      for (int a = 0; a < DIM; ++a)
+      {
+         real_t Fa = wL * div * nor[a];
+         for (int b = 0; b < DIM; ++b)
+         {
+            Fa += wM * (grad[a][b] + grad[b][a]) * nor[b];
+         }
+         F[a] += Fa;
+      }
+   }
+
+   real_t jump[DIM];
+   real_t jump_n = 0.0;
+   for (int a = 0; a < DIM; ++a)
+   {
+      jump[a] = u[0][a] - u[1][a];
+      jump_n += jump[a] * nor[a];
+   }
+
+   // - < {sigma(u) . n}, [v] > + kappa < h^{-1} {lambda + 2 mu} [u], [v] >
+   for (int a = 0; a < DIM; ++a)
+   {
+      ru[0][a] = -F[a] + pen * jump[a];
+      ru[1][a] = -ru[0][a];
+   }
+
+   // alpha < [u], {sigma(v) . n} >
+   for (int s = 0; s < 2; ++s)
+   {
+      const real_t *pa_s = pa + 1 + DIM + s*(2 + DIM*DIM);
+      const real_t wL = alpha * pa_s[0], wM = alpha * pa_s[1];
+      const real_t *Z = pa_s + 2;
+      for (int a = 0; a < DIM; ++a)
+      {
+         real_t H[DIM];
+         for (int b = 0; b < DIM; ++b)
+         {
+            H[b] = wM * (jump[a] * nor[b] + nor[a] * jump[b]);
+         }
+         H[a] += wL * jump_n;
+         for (int j = 0; j < DIM; ++j)
+         {
+            real_t v = 0.0;
+            for (int b = 0; b < DIM; ++b) { v += H[b] * Z[j*DIM + b]; }
+            rg[s][a][j] = v;
+         }
+      }
+   }
+}
+
+template <int T_D1D = 0, int T_Q1D = 0>
+static void PADGElasticityApply2D(const int NF, const Array<real_t> &b,
+                                  const Array<real_t> &g, const real_t alpha,
+                                  const Vector &pa_data,
+                                  const Array<int> &nc_info_,
+                                  const Vector &nc_interp_, const Vector &x_,
+                                  const Vector &dxdn_, Vector &y_,
+                                  Vector &dydn_, const int d1d = 0,
+                                  const int q1d = 0)
+{
+   constexpr int DIM = 2;
+   constexpr int PA_SIZE = PADGElasticityDataSize<DIM>();
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+
+   auto B_ = Reshape(b.Read(), Q1D, D1D);
+   auto G_ = Reshape(g.Read(), Q1D, D1D);
+   auto pa = Reshape(pa_data.Read(), PA_SIZE, Q1D, NF);
+
+   // (master side, interpolator index), master side is -1 on conforming faces
+   const bool has_nc = nc_info_.Size() > 0;
+   MFEM_VERIFY(!has_nc || D1D <= Q1D, "Nonconforming faces require Q1D >= D1D.");
+   auto nc_info = Reshape(has_nc ? nc_info_.Read() : nullptr, 2, NF);
+   const int n_interp = nc_interp_.Size() / (D1D * D1D);
+   auto interp = Reshape(has_nc ? nc_interp_.Read() : nullptr, D1D, D1D,
+                         n_interp);
+
+   auto x = Reshape(x_.Read(), D1D, DIM, 2, NF);
+   auto y = Reshape(y_.ReadWrite(), D1D, DIM, 2, NF);
+   auto dxdn = Reshape(dxdn_.Read(), D1D, DIM, 2, NF);
+   auto dydn = Reshape(dydn_.ReadWrite(), D1D, DIM, 2, NF);
+
+   const int NBX = std::max(D1D, Q1D);
+
+   mfem::forall_2D(NF, NBX, 1, [=] MFEM_HOST_DEVICE (int f) -> void
+   {
+      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      MFEM_SHARED real_t u[2][DIM][max_D1D];
+      MFEM_SHARED real_t du[2][DIM][max_D1D];
+      MFEM_SHARED real_t ru[2][DIM][max_Q1D];
+      MFEM_SHARED real_t rg[2][DIM][DIM][max_Q1D];
+
+      MFEM_SHARED real_t BG[2 * max_D1D * max_Q1D];
+      DeviceMatrix B(BG, Q1D, D1D);
+      DeviceMatrix G(BG + D1D * Q1D, Q1D, D1D);
+
+      // On the nonconforming faces, the normal derivatives on the master
+      // (coarse) side are interpolated to the slave (fine) face.
+      const int nc_side = has_nc ? nc_info(0, f) : -1;
+      const int nc_idx = has_nc ? nc_info(1, f) : 0;
+
+      MFEM_FOREACH_THREAD(p, x, Q1D)
+      {
+         for (int d = 0; d < D1D; ++d)
+         {
+            B(p, d) = B_(p, d);
+            G(p, d) = G_(p, d);
+         }
+      }
+      MFEM_FOREACH_THREAD(d, x, D1D)
+      {
+         for (int s = 0; s < 2; ++s)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               u[s][c][d] = x(d, c, s, f);
+               du[s][c][d] = dxdn(d, c, s, f);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      if (nc_side >= 0)
+      {
+         // use ru as temporary storage
+         MFEM_FOREACH_THREAD(d, x, D1D)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               real_t res = 0.0;
+               for (int k = 0; k < D1D; ++k)
+               {
+                  res += interp(d, k, nc_idx) * du[nc_side][c][k];
+               }
+               ru[0][c][d] = res;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(d, x, D1D)
+         {
+            for (int c = 0; c < DIM; ++c) { du[nc_side][c][d] = ru[0][c][d]; }
+         }
+         MFEM_SYNC_THREAD;
+      }
+
+      // eval @ quad points and apply the point-wise operator
+      MFEM_FOREACH_THREAD(p, x, Q1D)
+      {
+         real_t uq[2][DIM], gq[2][DIM][DIM];
+         for (int s = 0; s < 2; ++s)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               real_t bu = 0.0, bdu = 0.0, gu = 0.0;
+               for (int d = 0; d < D1D; ++d)
+               {
+                  bu += B(p, d) * u[s][c][d];
+                  bdu += B(p, d) * du[s][c][d];
+                  gu += G(p, d) * u[s][c][d];
+               }
+               uq[s][c] = bu;
+               gq[s][c][0] = bdu;
+               gq[s][c][1] = gu;
+            }
+         }
+
+         real_t ruq[2][DIM], rgq[2][DIM][DIM];
+         PADGElasticityQFunction<DIM>(alpha, &pa(0, p, f), uq, gq, ruq, rgq);
+
+         for (int s = 0; s < 2; ++s)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               ru[s][c][p] = ruq[s][c];
+               for (int j = 0; j < DIM; ++j) { rg[s][c][j][p] = rgq[s][c][j]; }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      // apply the transpose of the interpolation, overwrite u, du
+      MFEM_FOREACH_THREAD(d, x, D1D)
+      {
+         for (int s = 0; s < 2; ++s)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               real_t yv = 0.0, ydn = 0.0;
+               for (int p = 0; p < Q1D; ++p)
+               {
+                  yv += B(p, d) * ru[s][c][p] + G(p, d) * rg[s][c][1][p];
+                  ydn += B(p, d) * rg[s][c][0][p];
+               }
+               u[s][c][d] = yv;
+               du[s][c][d] = ydn;
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      // transpose of the master side interpolation
+      if (nc_side >= 0)
+      {
+         MFEM_FOREACH_THREAD(k, x, D1D)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               real_t res = 0.0;
+               for (int d = 0; d < D1D; ++d)
+               {
+                  res += interp(d, k, nc_idx) * du[nc_side][c][d];
+               }
+               ru[0][c][k] = res;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(k, x, D1D)
+         {
+            for (int c = 0; c < DIM; ++c) { du[nc_side][c][k] = ru[0][c][k]; }
+         }
+         MFEM_SYNC_THREAD;
+      }
+
+      MFEM_FOREACH_THREAD(d, x, D1D)
+      {
+         for (int s = 0; s < 2; ++s)
+         {
+            for (int c = 0; c < DIM; ++c)
+            {
+               y(d, c, s, f) += u[s][c][d];
+               dydn(d, c, s, f) += du[s][c][d];
+            }
+         }
+      }
+   });
+}
+
+template <int T_D1D = 0, int T_Q1D = 0>
+static void PADGElasticityApply3D(const int NF, const Array<real_t> &b,
+                                  const Array<real_t> &g, const real_t alpha,
+                                  const Vector &pa_data,
+                                  const Array<int> &nc_info_,
+                                  const Vector &nc_interp_, const Vector &x_,
+                                  const Vector &dxdn_, Vector &y_,
+                                  Vector &dydn_, const int d1d = 0,
+                                  const int q1d = 0)
+{
+   constexpr int DIM = 3;
+   constexpr int PA_SIZE = PADGElasticityDataSize<DIM>();
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   // The shared memory usage grows with the number of components, so the
+   // non-specialized kernel is limited to the interpolation sizes.
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_INTERP_1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_INTERP_1D, "");
+   MFEM_VERIFY(D1D <= Q1D, "");
+
+   auto B_ = Reshape(b.Read(), Q1D, D1D);
+   auto G_ = Reshape(g.Read(), Q1D, D1D);
+   auto pa = Reshape(pa_data.Read(), PA_SIZE, Q1D, Q1D, NF);
+
+   // (master side, interpolator index), master side is -1 on conforming faces
+   const bool has_nc = nc_info_.Size() > 0;
+   auto nc_info = Reshape(has_nc ? nc_info_.Read() : nullptr, 2, NF);
+   const int n_interp = nc_interp_.Size() / (D1D * D1D * D1D * D1D);
+   auto interp = Reshape(has_nc ? nc_interp_.Read() : nullptr, D1D, D1D, D1D,
+                         D1D, n_interp);
+
+   auto x = Reshape(x_.Read(), D1D, D1D, DIM, 2, NF);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, DIM, 2, NF);
+   auto dxdn = Reshape(dxdn_.Read(), D1D, D1D, DIM, 2, NF);
+   auto dydn = Reshape(dydn_.ReadWrite(), D1D, D1D, DIM, 2, NF);
+
+   mfem::forall_2D(NF, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int f) -> void
+   {
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_INTERP_1D;
+      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_INTERP_1D;
+
+      // values and normal derivatives at the face dofs, (d2, d1)
+      MFEM_SHARED real_t u[2][DIM][max_Q1D][max_Q1D];
+      MFEM_SHARED real_t du[2][DIM][max_Q1D][max_Q1D];
+      // partial contractions, (p1, d2)
+      MFEM_SHARED real_t Bu[2][DIM][max_Q1D][max_Q1D];
+      MFEM_SHARED real_t Gu[2][DIM][max_Q1D][max_Q1D];
+      MFEM_SHARED real_t Bdu[2][DIM][max_Q1D][max_Q1D];
+      // test function coefficients at the quadrature points, (p2, p1)
+      MFEM_SHARED real_t ru[2][DIM][max_Q1D][max_Q1D];
+      MFEM_SHARED real_t rg[2][DIM][DIM][max_Q1D][max_Q1D];
+
+      MFEM_SHARED real_t BG[2 * max_D1D * max_Q1D];
+      DeviceMatrix B(BG, Q1D, D1D);
+      DeviceMatrix G(BG + D1D * Q1D, Q1D, D1D);
+
+      // On the nonconforming faces, the normal derivatives on the master
+      // (coarse) side are interpolated to the slave (fine) face.
+      const int nc_side = has_nc ? nc_info(0, f) : -1;
+      const int nc_idx = has_nc ? nc_info(1, f) : 0;
+
+      MFEM_FOREACH_THREAD(p, x, Q1D)
+      {
+         MFEM_FOREACH_THREAD(d, y, D1D)
+         {
+            B(p, d) = B_(p, d);
+            G(p, d) = G_(p, d);
+         }
+      }
+      MFEM_FOREACH_THREAD(d2, x, D1D)
+      {
+         MFEM_FOREACH_THREAD(d1, y, D1D)
+         {
+            for (int s = 0; s < 2; ++s)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  u[s][c][d2][d1] = x(d1, d2, c, s, f);
+                  du[s][c][d2][d1] = dxdn(d1, d2, c, s, f);
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      if (nc_side >= 0)
+      {
+         // use ru as temporary storage
+         MFEM_FOREACH_THREAD(d2, x, D1D)
+         {
+            MFEM_FOREACH_THREAD(d1, y, D1D)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  real_t res = 0.0;
+                  for (int k2 = 0; k2 < D1D; ++k2)
+                  {
+                     for (int k1 = 0; k1 < D1D; ++k1)
+                     {
+                        res += interp(d1, d2, k1, k2, nc_idx) *
+                               du[nc_side][c][k2][k1];
+                     }
+                  }
+                  ru[0][c][d2][d1] = res;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(d2, x, D1D)
+         {
+            MFEM_FOREACH_THREAD(d1, y, D1D)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  du[nc_side][c][d2][d1] = ru[0][c][d2][d1];
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+
+      // contract in the first face direction
+      MFEM_FOREACH_THREAD(p1, x, Q1D)
+      {
+         MFEM_FOREACH_THREAD(d2, y, D1D)
+         {
+            for (int s = 0; s < 2; ++s)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  real_t bu = 0.0, gu = 0.0, bdu = 0.0;
+                  for (int d1 = 0; d1 < D1D; ++d1)
+                  {
+                     bu += B(p1, d1) * u[s][c][d2][d1];
+                     gu += G(p1, d1) * u[s][c][d2][d1];
+                     bdu += B(p1, d1) * du[s][c][d2][d1];
+                  }
+                  Bu[s][c][p1][d2] = bu;
+                  Gu[s][c][p1][d2] = gu;
+                  Bdu[s][c][p1][d2] = bdu;
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      // contract in the second face direction and apply the point-wise
+      // operator
+      MFEM_FOREACH_THREAD(p2, x, Q1D)
+      {
+         MFEM_FOREACH_THREAD(p1, y, Q1D)
+         {
+            real_t uq[2][DIM], gq[2][DIM][DIM];
+            for (int s = 0; s < 2; ++s)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  real_t bbu = 0.0, bbdu = 0.0, bgu = 0.0, gbu = 0.0;
+                  for (int d2 = 0; d2 < D1D; ++d2)
+                  {
+                     const real_t b = B(p2, d2);
+                     bbu += b * Bu[s][c][p1][d2];
+                     bbdu += b * Bdu[s][c][p1][d2];
+                     bgu += b * Gu[s][c][p1][d2];
+                     gbu += G(p2, d2) * Bu[s][c][p1][d2];
+                  }
+                  uq[s][c] = bbu;
+                  gq[s][c][0] = bbdu;
+                  gq[s][c][1] = bgu;
+                  gq[s][c][2] = gbu;
+               }
+            }
+
+            real_t ruq[2][DIM], rgq[2][DIM][DIM];
+            PADGElasticityQFunction<DIM>(alpha, &pa(0, p1, p2, f), uq, gq,
+                                         ruq, rgq);
+
+            for (int s = 0; s < 2; ++s)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  ru[s][c][p2][p1] = ruq[s][c];
+                  for (int j = 0; j < DIM; ++j)
+                  {
+                     rg[s][c][j][p2][p1] = rgq[s][c][j];
+                  }
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      // transpose contraction in the second face direction, overwrite Bu, Gu,
+      // Bdu
+      MFEM_FOREACH_THREAD(d2, x, D1D)
+      {
+         MFEM_FOREACH_THREAD(p1, y, Q1D)
+         {
+            for (int s = 0; s < 2; ++s)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  real_t br = 0.0, bg1 = 0.0, bg0 = 0.0;
+                  for (int p2 = 0; p2 < Q1D; ++p2)
+                  {
+                     const real_t b = B(p2, d2);
+                     br += b * ru[s][c][p2][p1] + G(p2, d2) * rg[s][c][2][p2][p1];
+                     bg1 += b * rg[s][c][1][p2][p1];
+                     bg0 += b * rg[s][c][0][p2][p1];
+                  }
+                  Bu[s][c][p1][d2] = br;
+                  Gu[s][c][p1][d2] = bg1;
+                  Bdu[s][c][p1][d2] = bg0;
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      // transpose contraction in the first face direction, overwrite u, du
+      MFEM_FOREACH_THREAD(d2, x, D1D)
+      {
+         MFEM_FOREACH_THREAD(d1, y, D1D)
+         {
+            for (int s = 0; s < 2; ++s)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  real_t yv = 0.0, ydn = 0.0;
+                  for (int p1 = 0; p1 < Q1D; ++p1)
+                  {
+                     const real_t b = B(p1, d1);
+                     yv += b * Bu[s][c][p1][d2] + G(p1, d1) * Gu[s][c][p1][d2];
+                     ydn += b * Bdu[s][c][p1][d2];
+                  }
+                  u[s][c][d2][d1] = yv;
+                  du[s][c][d2][d1] = ydn;
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      // transpose of the master side interpolation
+      if (nc_side >= 0)
+      {
+         MFEM_FOREACH_THREAD(k2, x, D1D)
+         {
+            MFEM_FOREACH_THREAD(k1, y, D1D)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  real_t res = 0.0;
+                  for (int d2 = 0; d2 < D1D; ++d2)
+                  {
+                     for (int d1 = 0; d1 < D1D; ++d1)
+                     {
+                        res += interp(d1, d2, k1, k2, nc_idx) *
+                               du[nc_side][c][d2][d1];
+                     }
+                  }
+                  ru[0][c][k2][k1] = res;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(k2, x, D1D)
+         {
+            MFEM_FOREACH_THREAD(k1, y, D1D)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  du[nc_side][c][k2][k1] = ru[0][c][k2][k1];
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+
+      MFEM_FOREACH_THREAD(d2, x, D1D)
+      {
+         MFEM_FOREACH_THREAD(d1, y, D1D)
+         {
+            for (int s = 0; s < 2; ++s)
+            {
+               for (int c = 0; c < DIM; ++c)
+               {
+                  y(d1, d2, c, s, f) += u[s][c][d2][d1];
+                  dydn(d1, d2, c, s, f) += du[s][c][d2][d1];
+               }
+            }
+         }
+      }
+   });
+}
+
+} // namespace internal
+
+template <int DIM, int D1D, int Q1D>
+DGElasticityIntegrator::ApplyKernelType
+DGElasticityIntegrator::ApplyPAKernels::Kernel()
+{
+   if constexpr (DIM == 2)
+   {
+      return internal::PADGElasticityApply2D<D1D, Q1D>;
+   }
+   else if constexpr (DIM == 3)
+   {
+      return internal::PADGElasticityApply3D<D1D, Q1D>;
+   }
+   MFEM_ABORT("");
+}
+
+} // namespace mfem
+/// \endcond DO_NOT_DOCUMENT
+#endif
@@ -0,0 +1,187 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../gridfunc.hpp"
+
+#include "bilininteg_dg_face_geom.hpp"
+#include "bilininteg_dgelasticity_kernels.hpp"
+
+namespace mfem
+{
+
+void DGElasticityIntegrator::SetupPA(const FiniteElementSpace &fes,
+                                     FaceType type)
+{
+   MFEM_VERIFY(lambda && mu, "Partial assembly requires the Lame coefficients.");
+
+   Mesh &mesh = *fes.GetMesh();
+   dim = mesh.Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "Unsupported dimension.");
+   MFEM_VERIFY(fes.GetVDim() == dim, "The space must have vdim == dim.");
+   nf = fes.GetNFbyType(type);
+
+   // Assumes tensor-product elements
+   const Geometry::Type face_geom_type = mesh.GetTypicalFaceGeometry();
+   const FiniteElement &el = *fes.GetTypicalTraceElement();
+   const int ir_order = IntRule ? IntRule->GetOrder() : 2*el.GetOrder();
+   const IntegrationRule &ir = irs.Get(face_geom_type, ir_order);
+   const IntegrationRule &ir1d = irs.Get(Geometry::SEGMENT, ir_order);
+   maps = &el.GetDofToQuad(ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+
+   nc_info.SetSize(0);
+   nc_interp.SetSize(0);
+   if (type == FaceType::Interior)
+   {
+      internal::GetDGNonconformingFaceInfo(fes, nc_info, nc_interp);
+   }
+
+   const int nq = ir.GetNPoints();
+   const int pa_size = (dim == 2) ? internal::PADGElasticityDataSize<2>()
+                       : internal::PADGElasticityDataSize<3>();
+   pa_data.SetSize(pa_size * nq * nf, Device::GetMemoryType());
+   auto pa = Reshape(pa_data.HostWrite(), pa_size, nq, nf);
+
+   internal::DGFaceGeometry geom(mesh, ir1d);
+   DenseMatrix Jinv(dim), Z(dim);
+   Vector nor(dim);
+
+   int fidx = 0;
+   for (int f = 0; f < mesh.GetNumFaces(); ++f)
+   {
+      const Mesh::FaceInformation face = mesh.GetFaceInformation(f);
+      if (!face.IsOfFaceType(type) || face.IsNonconformingCoarse()) { continue; }
+
+      geom.SetFace(f, face);
+      const int nsides = geom.GetNSides();
+      const real_t factor = (nsides == 2) ? 0.5 : 1.0;
+      for (int p = 0; p < nq; ++p)
+      {
+         FaceElementTransformations &T = geom.SetPoint(p);
+         CalcOrtho(T.Jacobian(), nor);
+         const real_t w = factor * ir.IntPoint(p).weight;
+
+         real_t wLM = 0.0;
+         for (int side = 0; side < 2; ++side)
+         {
+            const int offset = 1 + dim + side*(2 + dim*dim);
+            if (side >= nsides)
+            {
+               for (int i = 0; i < 2 + dim*dim; ++i)
+               {
+                  pa(offset + i, p, fidx) = 0.0;
+               }
+               continue;
+            }
+            ElementTransformation &Te = (side == 0) ? *T.Elem1 : *T.Elem2;
+            const IntegrationPoint &eip = (side == 0) ?
+                                          T.GetElement1IntPoint() :
+                                          T.GetElement2IntPoint();
+            const real_t wL = w * lambda->Eval(Te, eip);
+            const real_t wM = w * mu->Eval(Te, eip);
+            wLM += (wL + 2.0*wM) / Te.Weight();
+
+            CalcInverse(Te.Jacobian(), Jinv);
+            Mult(geom.GetDerivativeMap(side), Jinv, Z);
+
+            pa(offset, p, fidx) = wL;
+            pa(offset + 1, p, fidx) = wM;
+            for (int j = 0; j < dim; ++j)
+            {
+               for (int b = 0; b < dim; ++b)
+               {
+                  pa(offset + 2 + j*dim + b, p, fidx) = Z(j, b);
+               }
+            }
+         }
+
+         for (int a = 0; a < dim; ++a) { pa(a, p, fidx) = nor(a); }
+         pa(dim, p, fidx) = kappa * (nor*nor) * wLM;
+      }
+      fidx++;
+   }
+   MFEM_VERIFY(fidx == nf, "Unexpected number of faces.");
+}
+
+void DGElasticityIntegrator::AssemblePAInteriorFaces(
+   const FiniteElementSpace &fes)
+{
+   SetupPA(fes, FaceType::Interior);
+}
+
+void DGElasticityIntegrator::AssemblePABoundaryFaces(
+   const FiniteElementSpace &fes)
+{
+   SetupPA(fes, FaceType::Boundary);
+}
+
+void DGElasticityIntegrator::AddMultPAFaceNormalDerivatives(const Vector &x,
+                                                            const Vector &dxdn,
+                                                            Vector &y,
+                                                            Vector &dydn) const
+{
+   ApplyPAKernels::Run(dim, dofs1D, quad1D, nf, maps->B, maps->G, alpha,
+                       pa_data, nc_info, nc_interp, x, dxdn, y, dydn, dofs1D,
+                       quad1D);
+}
+
+DGElasticityIntegrator::DGElasticityIntegrator(real_t alpha_, real_t kappa_)
+   : lambda(NULL), mu(NULL), alpha(alpha_), kappa(kappa_)
+{
+   static Kernels kernels;
+}
+
+DGElasticityIntegrator::DGElasticityIntegrator(Coefficient &lambda_,
+                                               Coefficient &mu_,
+                                               real_t alpha_, real_t kappa_)
+   : DGElasticityIntegrator(alpha_, kappa_)
+{
+   lambda = &lambda_;
+   mu = &mu_;
+}
+
+/// \cond DO_NOT_DOCUMENT
+
+DGElasticityIntegrator::ApplyKernelType
+DGElasticityIntegrator::ApplyPAKernels::Fallback(int dim, int, int)
+{
+   if (dim == 2)
+   {
+      return internal::PADGElasticityApply2D;
+   }
+   else if (dim == 3)
+   {
+      return internal::PADGElasticityApply3D;
+   }
+   else
+   {
+      MFEM_ABORT("");
+   }
+}
+
+DGElasticityIntegrator::Kernels::Kernels()
+{
+   DGElasticityIntegrator::AddSpecialization<2, 2, 2>();
+   DGElasticityIntegrator::AddSpecialization<2, 3, 3>();
+   DGElasticityIntegrator::AddSpecialization<2, 4, 4>();
+   DGElasticityIntegrator::AddSpecialization<2, 5, 5>();
+
+   DGElasticityIntegrator::AddSpecialization<3, 2, 2>();
+   DGElasticityIntegrator::AddSpecialization<3, 3, 3>();
+   DGElasticityIntegrator::AddSpecialization<3, 4, 4>();
+   DGElasticityIntegrator::AddSpecialization<3, 5, 5>();
+}
+
+/// \endcond DO_NOT_DOCUMENT
+
+} // namespace mfem
@@ -10,6 +10,7 @@
 // CONTRIBUTING.md for details.
 
 #include "bilininteg_diffusion_kernels.hpp"
+#include "../../linalg/kernels.hpp"
 
 namespace mfem
 {
@@ -124,6 +125,94 @@ void PADiffusionSetup(const int dim,
    }
 }
 
+void PADiffusionSetupNonTensor(const int dim,
+                               const int NQ,
+                               const int coeffDim,
+                               const int NE,
+                               const Array<real_t> &w,
+                               const Vector &j,
+                               const Vector &c,
+                               Vector &d)
+{
+   MFEM_VERIFY(dim == 2 || dim == 3, "Unsupported dimension " << dim);
+   const bool symmetric = (coeffDim != dim*dim);
+   const int NC = symmetric ? (dim*(dim+1))/2 : dim*dim;
+   const bool const_c = c.Size() == coeffDim;
+   const auto W = Reshape(w.Read(), NQ);
+   const auto J = Reshape(j.Read(), NQ, dim, dim, NE);
+   const auto C = const_c ? Reshape(c.Read(), coeffDim, 1, 1) :
+                  Reshape(c.Read(), coeffDim, NQ, NE);
+   auto D = Reshape(d.Write(), NQ, NC, NE);
+
+   mfem::forall(NQ*NE, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int q = k % NQ, e = k / NQ;
+      const int qc = const_c ? 0 : q, ec = const_c ? 0 : e;
+      real_t Jq[9], A[9], M[9], AM[9];
+      for (int col = 0; col < dim; ++col)
+      {
+         for (int row = 0; row < dim; ++row)
+         {
+            Jq[row + dim*col] = J(q,row,col,e);
+         }
+      }
+      real_t detJ;
+      if (dim == 2)
+      {
+         detJ = kernels::Det<2>(Jq);
+         kernels::CalcAdjugate<2>(Jq, A);
+      }
+      else
+      {
+         detJ = kernels::Det<3>(Jq);
+         kernels::CalcAdjugate<3>(Jq, A);
+      }
+      // Coefficient matrix M, column-major. Matrix coefficients are stored by
+      // rows (transposed), symmetric ones as the upper triangle by rows.
+      for (int col = 0; col < dim; ++col)
+      {
+         for (int row = 0; row < dim; ++row)
+         {
+            real_t m;
+            if (coeffDim == 1) { m = (row == col) ? C(0,qc,ec) : 0.0; }
+            else if (coeffDim == dim)
+            {
+               m = (row == col) ? C(row,qc,ec) : 0.0;
+            }
+            else if (coeffDim == dim*dim) { m = C(col + dim*row,qc,ec); }
+            else { m = C(PADiffusionIndex(dim, true, row, col),qc,ec); }
+            M[row + dim*col] = m;
+         }
+      }
+      // D = W adj(J) M adj(J)^T / det(J)
+      const real_t w_detJ = W(q) / detJ;
+      for (int col = 0; col < dim; ++col)
+      {
+         for (int row = 0; row < dim; ++row)
+         {
+            real_t s = 0.0;
+            for (int l = 0; l < dim; ++l)
+            {
+               s += A[row + dim*l] * M[l + dim*col];
+            }
+            AM[row + dim*col] = s;
+         }
+      }
+      for (int col = 0; col < dim; ++col)
+      {
+         for (int row = (symmetric ? col : 0); row < dim; ++row)
+         {
+            real_t s = 0.0;
+            for (int l = 0; l < dim; ++l)
+            {
+               s += AM[row + dim*l] * A[col + dim*l];
+            }
+            D(q, PADiffusionIndex(dim, symmetric, row, col), e) = w_detJ * s;
+         }
+      }
+   });
+}
+
 template<>
 void PADiffusionSetup2D<2>(const int Q1D,
                            const int coeffDim,
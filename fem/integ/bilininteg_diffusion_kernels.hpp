@@ -1213,6 +1213,520 @@ inline void SmemPADiffusionApply3D(const int NE,
    });
 }
 
+// Reference gradient at the quadrature points of the scalar field x, given at
+// the D1D x D1D lexicographic dofs of one element.
+template<int MQ1>
+MFEM_HOST_DEVICE inline void MFDiffusionGrad2D(const int D1D,
+                                               const int Q1D,
+                                               const ConstDeviceMatrix &B,
+                                               const ConstDeviceMatrix &G,
+                                               const real_t *x,
+                                               real_t (&grad)[MQ1][MQ1][2])
+{
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         grad[qy][qx][0] = 0.0;
+         grad[qy][qx][1] = 0.0;
+      }
+   }
+   for (int dy = 0; dy < D1D; ++dy)
+   {
+      real_t gradX[MQ1][2];
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         gradX[qx][0] = 0.0;
+         gradX[qx][1] = 0.0;
+      }
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         const real_t s = x[dx + D1D*dy];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            gradX[qx][0] += s * B(qx,dx);
+            gradX[qx][1] += s * G(qx,dx);
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         const real_t wy  = B(qy,dy);
+         const real_t wDy = G(qy,dy);
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            grad[qy][qx][0] += gradX[qx][1] * wy;
+            grad[qy][qx][1] += gradX[qx][0] * wDy;
+         }
+      }
+   }
+}
+
+// Adds the transpose of MFDiffusionGrad2D applied to f to y.
+template<int MD1, int MQ1>
+MFEM_HOST_DEVICE inline void MFDiffusionGradT2D(const int D1D,
+                                                const int Q1D,
+                                                const ConstDeviceMatrix &B,
+                                                const ConstDeviceMatrix &G,
+                                                const real_t (&f)[MQ1][MQ1][2],
+                                                real_t *y)
+{
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      real_t gradX[MD1][2];
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         gradX[dx][0] = 0.0;
+         gradX[dx][1] = 0.0;
+      }
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         const real_t gX = f[qy][qx][0];
+         const real_t gY = f[qy][qx][1];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            gradX[dx][0] += gX * G(qx,dx);
+            gradX[dx][1] += gY * B(qx,dx);
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         const real_t wy  = B(qy,dy);
+         const real_t wDy = G(qy,dy);
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            y[dx + D1D*dy] += (gradX[dx][0] * wy) + (gradX[dx][1] * wDy);
+         }
+      }
+   }
+}
+
+// Reference gradient at the quadrature points of the scalar field x, given at
+// the D1D x D1D x D1D lexicographic dofs of one element.
+template<int MQ1>
+MFEM_HOST_DEVICE inline void MFDiffusionGrad3D(const int D1D,
+                                               const int Q1D,
+                                               const ConstDeviceMatrix &B,
+                                               const ConstDeviceMatrix &G,
+                                               const real_t *x,
+                                               real_t (&grad)[MQ1][MQ1][MQ1][3])
+{
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int k = 0; k < 3; ++k) { grad[qz][qy][qx][k] = 0.0; }
+         }
+      }
+   }
+   for (int dz = 0; dz < D1D; ++dz)
+   {
+      real_t gradXY[MQ1][MQ1][3];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int k = 0; k < 3; ++k) { gradXY[qy][qx][k] = 0.0; }
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         real_t gradX[MQ1][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            gradX[qx][0] = 0.0;
+            gradX[qx][1] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            const real_t s = x[dx + D1D*(dy + D1D*dz)];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradX[qx][0] += s * B(qx,dx);
+               gradX[qx][1] += s * G(qx,dx);
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const real_t wy  = B(qy,dy);
+            const real_t wDy = G(qy,dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradXY[qy][qx][0] += gradX[qx][1] * wy;
+               gradXY[qy][qx][1] += gradX[qx][0] * wDy;
+               gradXY[qy][qx][2] += gradX[qx][0] * wy;
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         const real_t wz  = B(qz,dz);
+         const real_t wDz = G(qz,dz);
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               grad[qz][qy][qx][0] += gradXY[qy][qx][0] * wz;
+               grad[qz][qy][qx][1] += gradXY[qy][qx][1] * wz;
+               grad[qz][qy][qx][2] += gradXY[qy][qx][2] * wDz;
+            }
+         }
+      }
+   }
+}
+
+// Adds the transpose of MFDiffusionGrad3D applied to f to y.
+template<int MD1, int MQ1>
+MFEM_HOST_DEVICE inline
+void MFDiffusionGradT3D(const int D1D,
+                        const int Q1D,
+                        const ConstDeviceMatrix &B,
+                        const ConstDeviceMatrix &G,
+                        const real_t (&f)[MQ1][MQ1][MQ1][3],
+                        real_t *y)
+{
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      real_t gradXY[MD1][MD1][3];
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            for (int k = 0; k < 3; ++k) { gradXY[dy][dx][k] = 0.0; }
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         real_t gradX[MD1][3];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            for (int k = 0; k < 3; ++k) { gradX[dx][k] = 0.0; }
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const real_t gX = f[qz][qy][qx][0];
+            const real_t gY = f[qz][qy][qx][1];
+            const real_t gZ = f[qz][qy][qx][2];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const real_t wx  = B(qx,dx);
+               const real_t wDx = G(qx,dx);
+               gradX[dx][0] += gX * wDx;
+               gradX[dx][1] += gY * wx;
+               gradX[dx][2] += gZ * wx;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            const real_t wy  = B(qy,dy);
+            const real_t wDy = G(qy,dy);
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradXY[dy][dx][0] += gradX[dx][0] * wy;
+               gradXY[dy][dx][1] += gradX[dx][1] * wDy;
+               gradXY[dy][dx][2] += gradX[dx][2] * wy;
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         const real_t wz  = B(qz,dz);
+         const real_t wDz = G(qz,dz);
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               y[dx + D1D*(dy + D1D*dz)] +=
+                  ((gradXY[dy][dx][0] * wz) +
+                   (gradXY[dy][dx][1] * wz) +
+                   (gradXY[dy][dx][2] * wDz));
+            }
+         }
+      }
+   }
+}
+
+// MF Diffusion Apply 2D kernel. The Jacobians at the quadrature points are
+// recomputed from the E-vector of the mesh nodes xn (with ND1D nodes in each
+// direction), and the scalar coefficient c is either constant (size 1) or
+// given at all quadrature points.
+template<int T_D1D = 0, int T_Q1D = 0>
+inline void MFDiffusionApply2D(const int NE,
+                               const int ND1D,
+                               const Array<real_t> &b_,
+                               const Array<real_t> &g_,
+                               const Array<real_t> &bn_,
+                               const Array<real_t> &gn_,
+                               const Array<real_t> &w_,
+                               const Vector &c_,
+                               const Vector &xn_,
+                               const Vector &x_,
+                               Vector &y_,
+                               const int d1d = 0,
+                               const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   MFEM_VERIFY(ND1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   const auto B = Reshape(b_.Read(), Q1D, D1D);
+   const auto G = Reshape(g_.Read(), Q1D, D1D);
+   const auto Bn = Reshape(bn_.Read(), Q1D, ND1D);
+   const auto Gn = Reshape(gn_.Read(), Q1D, ND1D);
+   const auto W = Reshape(w_.Read(), Q1D, Q1D);
+   const bool const_c = c_.Size() == 1;
+   const auto C = const_c ? Reshape(c_.Read(), 1, 1, 1) :
+                  Reshape(c_.Read(), Q1D, Q1D, NE);
+   const auto XN = Reshape(xn_.Read(), ND1D, ND1D, 2, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      // Rows of the Jacobian, J(c,k) = Jc[c][qy][qx][k]
+      real_t Jc[2][max_Q1D][max_Q1D][2];
+      MFDiffusionGrad2D(ND1D, Q1D, Bn, Gn, &XN(0,0,0,e), Jc[0]);
+      MFDiffusionGrad2D(ND1D, Q1D, Bn, Gn, &XN(0,0,1,e), Jc[1]);
+
+      real_t grad[max_Q1D][max_Q1D][2];
+      MFDiffusionGrad2D(D1D, Q1D, B, G, &X(0,0,e), grad);
+
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const real_t J11 = Jc[0][qy][qx][0];
+            const real_t J12 = Jc[0][qy][qx][1];
+            const real_t J21 = Jc[1][qy][qx][0];
+            const real_t J22 = Jc[1][qy][qx][1];
+            const real_t detJ = (J11 * J22) - (J21 * J12);
+            const real_t coeff = const_c ? C(0,0,0) : C(qx,qy,e);
+            const real_t wd = W(qx,qy) * coeff / detJ;
+            // D = w c adj(J) adj(J)^T / det(J)
+            const real_t D11 =  wd * (J12*J12 + J22*J22);
+            const real_t D21 = -wd * (J12*J11 + J22*J21);
+            const real_t D22 =  wd * (J11*J11 + J21*J21);
+
+            const real_t gradX = grad[qy][qx][0];
+            const real_t gradY = grad[qy][qx][1];
+            grad[qy][qx][0] = (D11 * gradX) + (D21 * gradY);
+            grad[qy][qx][1] = (D21 * gradX) + (D22 * gradY);
+         }
+      }
+      MFDiffusionGradT2D<max_D1D>(D1D, Q1D, B, G, grad, &Y(0,0,e));
+   });
+}
+
+// MF Diffusion Apply 3D kernel, see MFDiffusionApply2D.
+template<int T_D1D = 0, int T_Q1D = 0>
+inline void MFDiffusionApply3D(const int NE,
+                               const int ND1D,
+                               const Array<real_t> &b_,
+                               const Array<real_t> &g_,
+                               const Array<real_t> &bn_,
+                               const Array<real_t> &gn_,
+                               const Array<real_t> &w_,
+                               const Vector &c_,
+                               const Vector &xn_,
+                               const Vector &x_,
+                               Vector &y_,
+                               const int d1d = 0,
+                               const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   MFEM_VERIFY(ND1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   const auto B = Reshape(b_.Read(), Q1D, D1D);
+   const auto G = Reshape(g_.Read(), Q1D, D1D);
+   const auto Bn = Reshape(bn_.Read(), Q1D, ND1D);
+   const auto Gn = Reshape(gn_.Read(), Q1D, ND1D);
+   const auto W = Reshape(w_.Read(), Q1D, Q1D, Q1D);
+   const bool const_c = c_.Size() == 1;
+   const auto C = const_c ? Reshape(c_.Read(), 1, 1, 1, 1) :
+                  Reshape(c_.Read(), Q1D, Q1D, Q1D, NE);
+   const auto XN = Reshape(xn_.Read(), ND1D, ND1D, ND1D, 3, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      // Rows of the Jacobian, J(c,k) = Jc[c][qz][qy][qx][k]
+      real_t Jc[3][max_Q1D][max_Q1D][max_Q1D][3];
+      for (int c = 0; c < 3; ++c)
+      {
+         MFDiffusionGrad3D(ND1D, Q1D, Bn, Gn, &XN(0,0,0,c,e), Jc[c]);
+      }
+
+      real_t grad[max_Q1D][max_Q1D][max_Q1D][3];
+      MFDiffusionGrad3D(D1D, Q1D, B, G, &X(0,0,0,e), grad);
+
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const real_t (&J0)[3] = Jc[0][qz][qy][qx];
+               const real_t (&J1)[3] = Jc[1][qz][qy][qx];
+               const real_t (&J2)[3] = Jc[2][qz][qy][qx];
+               // A = adj(J)
+               const real_t A11 = (J1[1] * J2[2]) - (J1[2] * J2[1]);
+               const real_t A12 = (J0[2] * J2[1]) - (J0[1] * J2[2]);
+               const real_t A13 = (J0[1] * J1[2]) - (J0[2] * J1[1]);
+               const real_t A21 = (J1[2] * J2[0]) - (J1[0] * J2[2]);
+               const real_t A22 = (J0[0] * J2[2]) - (J0[2] * J2[0]);
+               const real_t A23 = (J0[2] * J1[0]) - (J0[0] * J1[2]);
+               const real_t A31 = (J1[0] * J2[1]) - (J1[1] * J2[0]);
+               const real_t A32 = (J0[1] * J2[0]) - (J0[0] * J2[1]);
+               const real_t A33 = (J0[0] * J1[1]) - (J0[1] * J1[0]);
+               const real_t detJ = (J0[0] * A11) + (J0[1] * A21) +
+                                   (J0[2] * A31);
+               const real_t coeff = const_c ? C(0,0,0,0) : C(qx,qy,qz,e);
+               const real_t wd = W(qx,qy,qz) * coeff / detJ;
+               // D = w c adj(J) adj(J)^T / det(J)
+               const real_t D11 = wd * (A11*A11 + A12*A12 + A13*A13);
+               const real_t D21 = wd * (A11*A21 + A12*A22 + A13*A23);
+               const real_t D31 = wd * (A11*A31 + A12*A32 + A13*A33);
+               const real_t D22 = wd * (A21*A21 + A22*A22 + A23*A23);
+               const real_t D32 = wd * (A21*A31 + A22*A32 + A23*A33);
+               const real_t D33 = wd * (A31*A31 + A32*A32 + A33*A33);
+
+               const real_t gradX = grad[qz][qy][qx][0];
+               const real_t gradY = grad[qz][qy][qx][1];
+               const real_t gradZ = grad[qz][qy][qx][2];
+               grad[qz][qy][qx][0] = (D11*gradX) + (D21*gradY) + (D31*gradZ);
+               grad[qz][qy][qx][1] = (D21*gradX) + (D22*gradY) + (D32*gradZ);
+               grad[qz][qy][qx][2] = (D31*gradX) + (D32*gradY) + (D33*gradZ);
+            }
+         }
+      }
+      MFDiffusionGradT3D<max_D1D>(D1D, Q1D, B, G, grad, &Y(0,0,0,e));
+   });
+}
+
+// Index of the entry (r,c) of the dim x dim PA data matrix at a quadrature
+// point, stored as the upper triangle by rows when symmetric, and by columns
+// otherwise.
+MFEM_HOST_DEVICE inline int PADiffusionIndex(const int dim,
+                                             const bool symmetric,
+                                             const int r, const int c)
+{
+   if (!symmetric) { return r + dim*c; }
+   const int i = (r <= c) ? r : c, j = (r <= c) ? c : r;
+   return i*dim - (i*(i-1))/2 + (j - i);
+}
+
+// PA Diffusion setup for non-tensor elements with dim == sdim, computing
+// D = W C adj(J) M adj(J)^T / det(J) at all quadrature points.
+void PADiffusionSetupNonTensor(const int dim,
+                               const int NQ,
+                               const int coeffDim,
+                               const int NE,
+                               const Array<real_t> &W,
+                               const Vector &J,
+                               const Vector &C,
+                               Vector &D);
+
+// PA Diffusion Apply kernel for non-tensor (e.g. simplex) elements, using the
+// full NQ x dim x ND gradient matrix G.
+inline void PADiffusionApplyNonTensor(const int dim,
+                                      const int NE,
+                                      const int ND,
+                                      const int NQ,
+                                      const bool symmetric,
+                                      const Array<real_t> &g,
+                                      const Vector &d,
+                                      const Vector &x,
+                                      Vector &y)
+{
+   const int max_nq = DeviceDofQuadLimits::Get().MAX_Q1D *
+                      DeviceDofQuadLimits::Get().MAX_Q1D;
+   MFEM_VERIFY(NQ <= max_nq, "Too many quadrature points: " << NQ);
+   const int NC = symmetric ? (dim*(dim+1))/2 : dim*dim;
+   const auto G = Reshape(g.Read(), NQ, dim, ND);
+   const auto D = Reshape(d.Read(), NQ, NC, NE);
+   const auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall_2D(NE, std::max(ND, NQ), 1, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MAX_NQ = DofQuadLimits::MAX_Q1D*DofQuadLimits::MAX_Q1D;
+      MFEM_SHARED real_t u[3*MAX_NQ];
+      MFEM_FOREACH_THREAD(q,x,NQ)
+      {
+         real_t grad[3] = {0.0, 0.0, 0.0};
+         for (int i = 0; i < ND; ++i)
+         {
+            const real_t xi = X(i,e);
+            for (int c = 0; c < dim; ++c) { grad[c] += G(q,c,i) * xi; }
+         }
+         for (int r = 0; r < dim; ++r)
+         {
+            real_t ur = 0.0;
+            for (int c = 0; c < dim; ++c)
+            {
+               ur += D(q, PADiffusionIndex(dim, symmetric, r, c), e) * grad[c];
+            }
+            u[r + 3*q] = ur;
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(i,x,ND)
+      {
+         real_t yi = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            for (int r = 0; r < dim; ++r) { yi += G(q,r,i) * u[r + 3*q]; }
+         }
+         Y(i,e) += yi;
+      }
+   });
+}
+
+// PA Diffusion Diagonal kernel for non-tensor elements
+inline void PADiffusionDiagonalNonTensor(const int dim,
+                                         const int NE,
+                                         const int ND,
+                                         const int NQ,
+                                         const bool symmetric,
+                                         const Array<real_t> &g,
+                                         const Vector &d,
+                                         Vector &y)
+{
+   const int NC = symmetric ? (dim*(dim+1))/2 : dim*dim;
+   const auto G = Reshape(g.Read(), NQ, dim, ND);
+   const auto D = Reshape(d.Read(), NQ, NC, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(ND*NE, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = k % ND, e = k / ND;
+      real_t yi = 0.0;
+      for (int q = 0; q < NQ; ++q)
+      {
+         for (int r = 0; r < dim; ++r)
+         {
+            for (int c = 0; c < dim; ++c)
+            {
+               yi += G(q,r,i) * G(q,c,i) *
+                     D(q, PADiffusionIndex(dim, symmetric, r, c), e);
+            }
+         }
+      }
+      Y(i,e) += yi;
+   });
+}
+
 } // namespace internal
 
 namespace
@@ -11,7 +11,9 @@
 
 #include "../bilininteg.hpp"
 #include "../gridfunc.hpp"
+#include "../qfunction.hpp"
 #include "../ceed/integrators/diffusion/diffusion.hpp"
+#include "bilininteg_diffusion_kernels.hpp"
 
 namespace mfem
 {
@@ -41,8 +43,38 @@ void DiffusionIntegrator::AssembleMF(const FiniteElementSpace &fes)
       }
       return;
    }
-   MFEM_ABORT("Error: DiffusionIntegrator::AssembleMF only implemented with"
-              " libCEED");
+   MFEM_VERIFY(!VQ && !MQ, "Only scalar coefficient supported for "
+               "DiffusionIntegrator::AssembleMF");
+   dim = mesh->Dimension();
+   ne = fes.GetNE();
+   MFEM_VERIFY(dim == 2 || dim == 3, "Unsupported dimension: " << dim);
+   MFEM_VERIFY(mesh->SpaceDimension() == dim, "AssembleMF requires dim == sdim");
+   MFEM_VERIFY(mesh->GetNumGeometries(dim) <= 1 && UsesTensorBasis(fes),
+               "AssembleMF requires tensor-product elements of a single "
+               "geometry");
+   mf_ir = ir;
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+
+   // Only the E-vector of the nodes is stored: the Jacobians are recomputed
+   // at the quadrature points in AddMultMF.
+   mesh->EnsureNodes();
+   const GridFunction &nodes = *mesh->GetNodes();
+   const FiniteElementSpace &nodes_fes = *nodes.FESpace();
+   mf_nodes_maps = &nodes_fes.GetTypicalFE()->GetDofToQuad(*ir,
+                                                            DofToQuad::TENSOR);
+   const Operator *nodes_restr =
+      nodes_fes.GetElementRestriction(ElementDofOrdering::LEXICOGRAPHIC);
+   mf_nodes.SetSize(nodes_restr->Height(), Device::GetDeviceMemoryType());
+   nodes_restr->Mult(nodes, mf_nodes);
+
+   QuadratureSpace qs(*mesh, *ir);
+   CoefficientVector coeff(qs, CoefficientStorage::COMPRESSED);
+   if (Q) { coeff.Project(*Q); }
+   else { coeff.SetConstant(1.0); }
+   mf_coeff.SetSize(coeff.Size(), Device::GetDeviceMemoryType());
+   mf_coeff = coeff;
 }
 
 void DiffusionIntegrator::AssembleDiagonalMF(Vector &diag)
@@ -53,8 +85,17 @@ void DiffusionIntegrator::AssembleDiagonalMF(Vector &diag)
    }
    else
    {
-      MFEM_ABORT("Error: DiffusionIntegrator::AssembleDiagonalMF only"
-                 " implemented with libCEED");
+      // The diagonal is only needed once, so the quadrature data is assembled
+      // in a temporary vector, from geometric factors not cached by the mesh.
+      const GeometricFactors mf_geom(*fespace->GetMesh()->GetNodes(), *mf_ir,
+                                     GeometricFactors::JACOBIANS);
+      const int nq = mf_ir->GetNPoints();
+      Vector qdata(((dim*(dim+1))/2) * nq * ne, Device::GetDeviceMemoryType());
+      internal::PADiffusionSetup(dim, dim, dofs1D, quad1D, 1, ne,
+                                 mf_ir->GetWeights(), mf_geom.J, mf_coeff,
+                                 qdata);
+      DiagonalPAKernels::Run(dim, dofs1D, quad1D, ne, true, maps->B, maps->G,
+                             qdata, diag, dofs1D, quad1D);
    }
 }
 
@@ -66,8 +107,36 @@ void DiffusionIntegrator::AddMultMF(const Vector &x, Vector &y) const
    }
    else
    {
-      MFEM_ABORT("Error: DiffusionIntegrator::AddMultMF only implemented with"
-                 " libCEED");
+      const int nd1d = mf_nodes_maps->ndof;
+      const Array<real_t> &B = maps->B, &G = maps->G;
+      const Array<real_t> &Bn = mf_nodes_maps->B, &Gn = mf_nodes_maps->G;
+      const Array<real_t> &W = mf_ir->GetWeights();
+      if (dim == 2)
+      {
+         auto kernel = internal::MFDiffusionApply2D<0,0>;
+         switch ((dofs1D << 4 ) | quad1D)
+         {
+            case 0x22: kernel = internal::MFDiffusionApply2D<2,2>; break;
+            case 0x33: kernel = internal::MFDiffusionApply2D<3,3>; break;
+            case 0x44: kernel = internal::MFDiffusionApply2D<4,4>; break;
+            case 0x55: kernel = internal::MFDiffusionApply2D<5,5>; break;
+         }
+         kernel(ne, nd1d, B, G, Bn, Gn, W, mf_coeff, mf_nodes, x, y, dofs1D,
+                quad1D);
+      }
+      else
+      {
+         auto kernel = internal::MFDiffusionApply3D<0,0>;
+         switch ((dofs1D << 4 ) | quad1D)
+         {
+            case 0x23: kernel = internal::MFDiffusionApply3D<2,3>; break;
+            case 0x34: kernel = internal::MFDiffusionApply3D<3,4>; break;
+            case 0x45: kernel = internal::MFDiffusionApply3D<4,5>; break;
+            case 0x56: kernel = internal::MFDiffusionApply3D<5,6>; break;
+         }
+         kernel(ne, nd1d, B, G, Bn, Gn, W, mf_coeff, mf_nodes, x, y, dofs1D,
+                quad1D);
+      }
    }
 }
 
@@ -25,9 +25,27 @@ void DiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
    {
       ceedOp->GetDiagonal(diag);
    }
+   else if (!pa_groups.empty())
+   {
+      for (const PAElementGroup &g : pa_groups)
+      {
+         g.ye = 0.0;
+         internal::PADiffusionDiagonalNonTensor(dim, g.ne, g.nd, g.nq,
+                                                symmetric, g.maps->G,
+                                                g.pa_data, g.ye);
+         ScatterAddPAElementGroup(g, diag, false);
+      }
+   }
    else
    {
       if (pa_data.Size() == 0) { AssemblePA(*fespace); }
+      if (maps->mode == DofToQuad::FULL)
+      {
+         internal::PADiffusionDiagonalNonTensor(dim, ne, dofs1D, quad1D,
+                                                symmetric, maps->G, pa_data,
+                                                diag);
+         return;
+      }
       const Array<real_t> &B = maps->B;
       const Array<real_t> &G = maps->G;
       const Vector &Dv = pa_data;
@@ -36,6 +54,27 @@ void DiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
    }
 }
 
+OperatorCostModel DiffusionIntegrator::GetCostModelPA() const
+{
+   if (DeviceCanUseCeed() || (pa_data.Size() == 0 && pa_groups.empty()))
+   {
+      return BilinearFormIntegrator::GetCostModelPA();
+   }
+   // The gradients are multiplied by a dim x dim matrix at each point.
+   const real_t qflops = 2.0*dim*dim;
+   OperatorCostModel cost;
+   if (!pa_groups.empty())
+   {
+      for (const PAElementGroup &g : pa_groups)
+      {
+         cost += PACostModel(*g.maps, dim, g.ne, 1, dim, dim, qflops,
+                             g.pa_data);
+      }
+      return cost;
+   }
+   return PACostModel(*maps, dim, ne, 1, dim, dim, qflops, pa_data);
+}
+
 // PA Diffusion Apply kernel
 void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
@@ -43,6 +82,15 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    {
       ceedOp->AddMult(x, y);
    }
+   else if (!pa_groups.empty())
+   {
+      AddMultPAMixed(x, y);
+   }
+   else if (maps->mode == DofToQuad::FULL)
+   {
+      internal::PADiffusionApplyNonTensor(dim, ne, dofs1D, quad1D, symmetric,
+                                          maps->G, pa_data, x, y);
+   }
    else
    {
       const Array<real_t> &B = maps->B;
@@ -118,9 +166,18 @@ void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    const int nq = ir->GetNPoints();
    dim = mesh->Dimension();
    ne = fes.GetNE();
+   if (mesh->GetNumGeometries(dim) > 1)
+   {
+      AssemblePAMixed(fes);
+      return;
+   }
+   pa_groups.clear();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS, mt);
    const int sdim = mesh->SpaceDimension();
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   // Non-tensor elements (e.g. simplices) use the full basis matrices, in
+   // which case dofs1D and quad1D are the total numbers of dofs and points.
+   const bool tensor = UsesTensorBasis(fes);
+   maps = &el.GetDofToQuad(*ir, tensor ? DofToQuad::TENSOR : DofToQuad::FULL);
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
 
@@ -137,10 +194,91 @@ void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    const int pa_size = symmetric ? symmDims : dims*dims;
 
    pa_data.SetSize(pa_size * nq * ne, mt);
+   if (!tensor)
+   {
+      MFEM_VERIFY(sdim == dim, "Non-tensor PA requires dim == sdim");
+      internal::PADiffusionSetupNonTensor(dim, nq, coeff_dim, ne,
+                                          ir->GetWeights(), geom->J, coeff,
+                                          pa_data);
+      return;
+   }
    internal::PADiffusionSetup(dim, sdim, dofs1D, quad1D, coeff_dim, ne,
                               ir->GetWeights(), geom->J, coeff, pa_data);
 }
 
+void DiffusionIntegrator::AssemblePAMixed(const FiniteElementSpace &fes)
+{
+   SetupPAElementGroups(fes);
+   Mesh &mesh = *fes.GetMesh();
+   MFEM_VERIFY(mesh.SpaceDimension() == dim,
+               "Mixed-geometry PA requires dim == sdim");
+   symmetric = !(MQ && !MQ->IsSymmetric());
+   const int nc = symmetric ? (dim*(dim+1))/2 : dim*dim;
+   DenseMatrix Jinv(dim), M(dim), JinvM(dim), Dq(dim);
+   Vector Vq(dim);
+   for (PAElementGroup &g : pa_groups)
+   {
+      g.pa_data.SetSize(g.nq*nc*g.ne);
+      auto D = Reshape(g.pa_data.HostWrite(), g.nq, nc, g.ne);
+      for (int k = 0; k < g.ne; k++)
+      {
+         const int e = g.elements[k];
+         ElementTransformation &T = *mesh.GetElementTransformation(e);
+         for (int q = 0; q < g.nq; q++)
+         {
+            const IntegrationPoint &ip = g.ir->IntPoint(q);
+            T.SetIntPoint(&ip);
+            // D = w det(J) J^{-1} M J^{-T}
+            if (MQ) { MQ->Eval(M, T, ip); }
+            else if (VQ)
+            {
+               VQ->Eval(Vq, T, ip);
+               M.Diag(Vq.GetData(), dim);
+            }
+            else { M.Diag(Q ? Q->Eval(T, ip) : 1.0, dim); }
+            CalcInverse(T.Jacobian(), Jinv);
+            Mult(Jinv, M, JinvM);
+            MultABt(JinvM, Jinv, Dq);
+            Dq *= ip.weight * T.Weight();
+            for (int c = 0; c < dim; c++)
+            {
+               for (int r = (symmetric ? c : 0); r < dim; r++)
+               {
+                  D(q, internal::PADiffusionIndex(dim, symmetric, r, c), k) =
+                     Dq(r, c);
+               }
+            }
+         }
+      }
+   }
+}
+
+void DiffusionIntegrator::AddMultPAMixed(const Vector &x, Vector &y,
+                                         bool abs) const
+{
+   for (const PAElementGroup &g : pa_groups)
+   {
+      GatherPAElementGroup(g, x);
+      g.ye = 0.0;
+      if (abs)
+      {
+         Vector abs_pa_data(g.pa_data);
+         abs_pa_data.Abs();
+         Array<real_t> absG(g.maps->G);
+         absG.Abs();
+         internal::PADiffusionApplyNonTensor(dim, g.ne, g.nd, g.nq, symmetric,
+                                             absG, abs_pa_data, g.xe, g.ye);
+      }
+      else
+      {
+         internal::PADiffusionApplyNonTensor(dim, g.ne, g.nd, g.nq, symmetric,
+                                             g.maps->G, g.pa_data, g.xe,
+                                             g.ye);
+      }
+      ScatterAddPAElementGroup(g, y);
+   }
+}
+
 void DiffusionIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
 {
    fespace = &fes;
@@ -170,10 +308,21 @@ void DiffusionIntegrator::AddAbsMultPA(const Vector &x, Vector &y) const
    {
       MFEM_ABORT("Ceed AbsMult not implemented yet");
    }
+   if (!pa_groups.empty())
+   {
+      AddMultPAMixed(x, y, true);
+      return;
+   }
    Vector abs_pa_data(pa_data);
    abs_pa_data.Abs();
    auto abs_maps = maps->Abs();
 
+   if (maps->mode == DofToQuad::FULL)
+   {
+      internal::PADiffusionApplyNonTensor(dim, ne, dofs1D, quad1D, symmetric,
+                                          abs_maps.G, abs_pa_data, x, y);
+      return;
+   }
    ApplyPAKernels::Run(dim, dofs1D, quad1D, ne, symmetric,
                        abs_maps.B, abs_maps.G, abs_maps.Bt, abs_maps.Gt,
                        abs_pa_data, x, y, dofs1D, quad1D);
@@ -106,6 +106,28 @@ void ElasticityAssembleDiagonalPA(const int dim, const int nDofs,
    }
 }
 
+void ElasticityAssembleBlockDiagonalPA(const int dim, const int nDofs,
+                                       const CoefficientVector &lambda,
+                                       const CoefficientVector &mu,
+                                       const GeometricFactors &geom,
+                                       const DofToQuad &maps,
+                                       QuadratureFunction &QVec, Vector &blocks)
+{
+   switch (dim)
+   {
+      case 2:
+         ElasticityAssembleBlockDiagonalPA_<2>(nDofs, lambda, mu, geom, maps,
+                                               QVec, blocks);
+         break;
+      case 3:
+         ElasticityAssembleBlockDiagonalPA_<3>(nDofs, lambda, mu, geom, maps,
+                                               QVec, blocks);
+         break;
+      default:
+         MFEM_ABORT("Only dimensions 2 and 3 supported.");
+   }
+}
+
 void ElasticityAssembleEA(const int dim, const int i_block, const int j_block,
                           const int nDofs, const IntegrationRule &ir,
                           const CoefficientVector &lambda,
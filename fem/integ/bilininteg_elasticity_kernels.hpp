@@ -140,6 +140,26 @@ void ElasticityAssembleDiagonalPA(const int dim, const int nDofs,
                                   const CoefficientVector &mu, const GeometricFactors &geom,
                                   const DofToQuad &maps, QuadratureFunction &QVec, Vector &diag);
 
+/// @brief Elasticity kernel for AssembleBlockDiagonalPA.
+///
+/// Adds the dim x dim blocks coupling the displacement components of each dof.
+///
+/// @param[in] dim 2 or 3
+/// @param[in] nDofs Number of scalar dofs per element.
+/// @param[in] lambda Quadrature function for first Lame param.
+/// @param[in] mu Quadrature function for second Lame param.
+/// @param[in] geom Geometric factors corresponding to fespace.
+/// @param[in] maps DofToQuad maps for one element (assume elements all same).
+/// @param QVec Scratch Q-Vector. nQuad x dim x dim x dim x dim x numEls.
+/// @param[in,out] blocks Blocks of A. nDofs x dim x dim x numEls.
+void ElasticityAssembleBlockDiagonalPA(const int dim, const int nDofs,
+                                       const CoefficientVector &lambda,
+                                       const CoefficientVector &mu,
+                                       const GeometricFactors &geom,
+                                       const DofToQuad &maps,
+                                       QuadratureFunction &QVec,
+                                       Vector &blocks);
+
 /// Templated implementation of ElasticityAddMultPA.
 template<int dim, int i_block = -1, int j_block = -1>
 void ElasticityAddMultPA_(const int nDofs, const FiniteElementSpace &fespace,
@@ -360,6 +380,95 @@ void ElasticityAssembleDiagonalPA_(const int nDofs,
    });
 }
 
+/// Templated implementation of ElasticityAssembleBlockDiagonalPA.
+template<int dim>
+void ElasticityAssembleBlockDiagonalPA_(const int nDofs,
+                                        const CoefficientVector &lambda,
+                                        const CoefficientVector &mu,
+                                        const GeometricFactors &geom,
+                                        const DofToQuad &maps,
+                                        QuadratureFunction &QVec,
+                                        Vector &blocks)
+{
+   using future::tensor;
+   using future::make_tensor;
+   using future::det;
+   using future::inv;
+
+   // Assuming all elements are the same
+   const auto &ir = QVec.GetIntRule(0);
+   static constexpr int d = dim;
+   const int numPoints = ir.GetNPoints();
+   const int numEls = lambda.Size()/numPoints;
+   const auto lamDev = Reshape(lambda.Read(), numPoints, numEls);
+   const auto muDev = Reshape(mu.Read(), numPoints, numEls);
+   const auto J = Reshape(geom.J.Read(), numPoints, d, d, numEls);
+   auto Q = Reshape(QVec.ReadWrite(), numPoints, d, d, d, d, numEls);
+   const real_t *ipWeights = ir.GetWeights().Read();
+   mfem::forall_2D(numEls, numPoints, 1, [=] MFEM_HOST_DEVICE (int e)
+   {
+      MFEM_FOREACH_THREAD(p, x, numPoints)
+      {
+         auto invJ = inv(make_tensor<d, d>(
+         [&](int i, int j) { return J(p, i, j, e); }));
+         const real_t w = ipWeights[p] / det(invJ);
+         for (int r = 0; r < d; r++)
+         {
+            for (int c = 0; c < d; c++)
+            {
+               for (int n = 0; n < d; n++)
+               {
+                  for (int m = 0; m < d; m++)
+                  {
+                     // contraction of 4*sym(grad(u))sym(grad(v)) for the
+                     // components r of v and c of u
+                     real_t contraction = 0.;
+                     for (int a = 0; a < d; a++)
+                     {
+                        for (int b = 0; b < d; b++)
+                        {
+                           contraction +=
+                              ((a == r)*invJ(m,b) + (b == r)*invJ(m,a)) *
+                              ((a == c)*invJ(n,b) + (b == c)*invJ(n,a));
+                        }
+                     }
+                     Q(p,m,n,r,c,e) = w*(lamDev(p, e)*invJ(m,r)*invJ(n,c)
+                                         + 0.5*muDev(p, e)*contraction);
+                  }
+               }
+            }
+         }
+      }
+   });
+
+   // Reduce quadrature function to the blocks of each dof
+   const auto QRead = Reshape(QVec.Read(), numPoints, d, d, d, d, numEls);
+   auto blocksDev = Reshape(blocks.ReadWrite(), nDofs, d, d, numEls);
+   const auto G = Reshape(maps.G.Read(), numPoints, d, nDofs);
+   mfem::forall_2D(numEls, d*d, nDofs, [=] MFEM_HOST_DEVICE (int e)
+   {
+      MFEM_FOREACH_THREAD(i, y, nDofs)
+      {
+         MFEM_FOREACH_THREAD(rc, x, d*d)
+         {
+            const int r = rc % d, c = rc / d;
+            real_t sum = 0.;
+            for (int n = 0; n < d; n++)
+            {
+               for (int m = 0; m < d; m++)
+               {
+                  for (int p = 0; p < numPoints; p++)
+                  {
+                     sum += QRead(p,m,n,r,c,e)*G(p,m,i)*G(p,n,i);
+                  }
+               }
+            }
+            blocksDev(i, r, c, e) += sum;
+         }
+      }
+   });
+}
+
 // Templated implementation of ElasticityAssembleEA.
 template<int dim>
 void ElasticityAssembleEA_(const int i_block,
@@ -9,6 +9,7 @@
 // terms of the BSD-3 license. We welcome feedback and contributions, see file
 // CONTRIBUTING.md for details.
 
+#include "../../general/forall.hpp"
 #include "../bilininteg.hpp"
 #include "../gridfunc.hpp"
 #include "../qfunction.hpp"
@@ -64,6 +65,14 @@ void ElasticityIntegrator::AssembleDiagonalPA(Vector &diag)
                                           *geom, *maps, *q_vec, diag);
 }
 
+void ElasticityIntegrator::AssembleBlockDiagonalPA(Vector &blocks)
+{
+   q_vec->SetVDim(vdim*vdim*vdim*vdim);
+   internal::ElasticityAssembleBlockDiagonalPA(vdim, ndofs, *lambda_quad,
+                                               *mu_quad, *geom, *maps, *q_vec,
+                                               blocks);
+}
+
 void ElasticityIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
    internal::ElasticityAddMultPA(vdim, ndofs, *fespace, *lambda_quad, *mu_quad,
@@ -98,6 +107,29 @@ void ElasticityComponentIntegrator::AssemblePA(const FiniteElementSpace &fes)
    maps = &fespace->GetTypicalFE()->GetDofToQuad(*IntRule, mode);
 }
 
+void ElasticityComponentIntegrator::AssembleDiagonalPA(Vector &diag)
+{
+   MFEM_VERIFY(i_block == j_block,
+               "The diagonal is only defined for the diagonal blocks.");
+   const int vdim = parent.vdim, ndofs = parent.ndofs;
+   const int ne = fespace->GetNE();
+   Vector blocks(ndofs * vdim * vdim * ne);
+   blocks.UseDevice(true);
+   blocks = 0.0;
+   parent.q_vec->SetVDim(vdim*vdim*vdim*vdim);
+   internal::ElasticityAssembleBlockDiagonalPA(vdim, ndofs, *parent.lambda_quad,
+                                               *parent.mu_quad, *geom, *maps,
+                                               *parent.q_vec, blocks);
+   const int b = i_block;
+   const auto B = Reshape(blocks.Read(), ndofs, vdim, vdim, ne);
+   auto D = Reshape(diag.ReadWrite(), ndofs, ne);
+   mfem::forall(ndofs * ne, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int i = idx % ndofs, e = idx / ndofs;
+      D(i, e) += B(i, b, b, e);
+   });
+}
+
 void ElasticityComponentIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
    internal::ElasticityComponentAddMultPA(
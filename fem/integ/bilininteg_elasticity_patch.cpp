@@ -0,0 +1,150 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../fem.hpp"
+#include "../../mesh/nurbs.hpp"
+
+namespace mfem
+{
+
+// The quadrature data of a point has the layout (11): lambda w det(J),
+// mu w det(J), and the inverse Jacobian J^{-1}(k,c) at the entry 2 + k + 3c.
+void ElasticityIntegrator::SetupPatchQData(const int patch, bool unitWeights,
+                                           Vector &qdata)
+{
+   Mesh &mesh = *fespace->GetMesh();
+   const internal::PatchBasisInfo &pb = patch_assembly.GetBasis(patch);
+   const int nq = pb.NumPoints();
+
+   Vector weights, jac, lcoeff, mcoeff;
+   internal::GetPatchGeometry(mesh, patch, *patchRules, pb, unitWeights,
+                              weights, jac);
+   internal::GetPatchCoefficient(lambda ? lambda : mu, mesh, patch,
+                                 *patchRules, pb, lcoeff);
+   internal::GetPatchCoefficient(mu, mesh, patch, *patchRules, pb, mcoeff);
+   if (!lambda)
+   {
+      lcoeff *= q_lambda;
+      mcoeff *= q_mu;
+   }
+
+   qdata.SetSize(11*nq);
+   DenseMatrix J(3), Ji(3);
+   for (int q = 0; q < nq; q++)
+   {
+      for (int i = 0; i < 9; i++) { J.GetData()[i] = jac[q + nq*i]; }
+      CalcInverse(J, Ji);
+      const real_t wdet = weights[q] * J.Det();
+      real_t *D = qdata.GetData() + 11*q;
+      D[0] = wdet * (lcoeff.Size() == 1 ? lcoeff[0] : lcoeff[q]);
+      D[1] = wdet * (mcoeff.Size() == 1 ? mcoeff[0] : mcoeff[q]);
+      for (int i = 0; i < 9; i++) { D[2 + i] = Ji.GetData()[i]; }
+   }
+}
+
+void ElasticityIntegrator::ApplyPatchQFunction(const Vector &qdata, int q0,
+                                               int nq, const real_t *in,
+                                               real_t *out) const
+{
+   const real_t *qd = qdata.HostRead() + 11*q0;
+   for (int i = 0; i < nq; i++)
+   {
+      const real_t *D = qd + 11*i;
+      const real_t L = D[0], M = D[1];
+      const real_t *Ji = D + 2;
+
+      // Physical gradient Gr(b,c) = du_b/dx_c.
+      real_t Gr[3][3];
+      for (int b = 0; b < 3; b++)
+      {
+         for (int c = 0; c < 3; c++)
+         {
+            Gr[b][c] = 0.0;
+            for (int k = 0; k < 3; k++)
+            {
+               Gr[b][c] += in[i + nq*(1 + k + 4*b)] * Ji[k + 3*c];
+            }
+         }
+      }
+      const real_t div = Gr[0][0] + Gr[1][1] + Gr[2][2];
+
+      for (int a = 0; a < 3; a++)
+      {
+         real_t sigma[3];
+         for (int c = 0; c < 3; c++)
+         {
+            sigma[c] = M*(Gr[a][c] + Gr[c][a]) + (a == c ? L*div : 0.0);
+         }
+         for (int k = 0; k < 3; k++)
+         {
+            out[i + nq*(1 + k + 4*a)] = Ji[k]*sigma[0] + Ji[k + 3]*sigma[1] +
+                                        Ji[k + 6]*sigma[2];
+         }
+      }
+   }
+}
+
+void ElasticityIntegrator::SetupPatchAssembly(const FiniteElementSpace &fes)
+{
+   fespace = &fes;
+   MFEM_VERIFY(patchRules, "Patch-wise integration requires NURBSMeshRules");
+   MFEM_VERIFY(fes.GetVDim() == 3, "The vector dimension must be 3");
+   patch_assembly.Setup(fes, *patchRules,
+                        internal::NURBSPatchAssembly::GRADIENTS);
+}
+
+void ElasticityIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
+{
+   SetupPatchAssembly(fes);
+
+   const int np = patch_assembly.GetNPatches();
+   patch_qdata.resize(np);
+   for (int p = 0; p < np; p++)
+   {
+      SetupPatchQData(p, false, patch_qdata[p]);
+   }
+}
+
+void ElasticityIntegrator::AddMultNURBSPA(const Vector &x, Vector &y) const
+{
+   patch_assembly.AddMult([this](int p, int q0, int nq, const real_t *in,
+                                 real_t *out)
+   {
+      ApplyPatchQFunction(patch_qdata[p], q0, nq, in, out);
+   }, x, y);
+}
+
+void ElasticityIntegrator::AssembleDiagonalNURBSPA(Vector &diag)
+{
+   patch_assembly.AssembleDiagonal([this](int p, int q0, int nq,
+                                          const real_t *in, real_t *out)
+   {
+      ApplyPatchQFunction(patch_qdata[p], q0, nq, in, out);
+   }, diag);
+}
+
+void ElasticityIntegrator::AssemblePatchMatrix(const int patch,
+                                               const FiniteElementSpace &fes,
+                                               SparseMatrix*& smat)
+{
+   SetupPatchAssembly(fes);
+
+   const bool reduced = integrationMode == Mode::PATCHWISE_REDUCED;
+   Vector qdata;
+   SetupPatchQData(patch, reduced, qdata);
+   smat = patch_assembly.AssemblePatchMatrix(
+             patch, [&](int, int q0, int nq, const real_t *in, real_t *out)
+   {
+      ApplyPatchQFunction(qdata, q0, nq, in, out);
+   }, true, reduced);
+}
+
+} // namespace mfem
@@ -0,0 +1,430 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../bilininteg.hpp"
+#include "../gridfunc.hpp"
+#include "bilininteg_hcurl_kernels.hpp"
+
+namespace mfem
+{
+
+// The vector component a of the lexicographic Nedelec basis function of
+// component c (or of its curl, if curl is true) is sign times the tensor
+// product of the 1D factors f[0] (x), f[1] (y) and f[2] (z), where 0 is the
+// open basis, 1 is the closed basis and 2 is the derivative of the closed
+// basis. The sign is 0 if the component vanishes.
+//
+// In 2D, the curl is a scalar (a = 0): curl u = (u_1)_{x_0} - (u_0)_{x_1}.
+template <int DIM>
+static MFEM_HOST_DEVICE inline
+int HcurlBasisFactors(const bool curl, const int c, const int a, int (&f)[3])
+{
+   for (int k = 0; k < DIM; ++k) { f[k] = (k == c) ? 0 : 1; }
+   if (!curl) { return (a == c) ? 1 : 0; }
+   if (DIM == 2)
+   {
+      f[1 - c] = 2;
+      return (c == 0) ? -1 : 1;
+   }
+   if (a == c) { return 0; }
+   // (curl u)_a = eps_{akc} (u_c)_{x_k}
+   const int k = 3 - a - c;
+   f[k] = 2;
+   return (k == (a + 1) % 3) ? 1 : -1;
+}
+
+// Index of the entry (a,b) of the quadrature data, following the PA kernels.
+template <int DIM>
+static MFEM_HOST_DEVICE inline
+int HcurlCoeffIndex(const bool curl, const bool symmetric, const int a,
+                    const int b)
+{
+   if (DIM == 2)
+   {
+      if (curl) { return 0; }
+      if (symmetric) { return a + b; } // (0,0), (0,1) = (1,0), (1,1)
+      return a + 2*b;
+   }
+   if (symmetric)
+   {
+      const int i = (a < b) ? a : b, j = (a < b) ? b : a;
+      return (i == 0) ? j : i + j + 1; // 00, 01, 02, 11, 12, 22
+   }
+   return 3*a + b;
+}
+
+// The element matrices are assembled one row (test function) at a time: the
+// quadrature data is first applied to the test function, and the result is
+// then contracted with the trial functions dimension by dimension.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void EAHcurlAssemble2D(const int NE,
+                              const Array<real_t> &bo,
+                              const Array<real_t> &bc,
+                              const Array<real_t> &gc,
+                              const bool curl,
+                              const bool symmetric,
+                              const Vector &pa_data,
+                              Vector &ea_data,
+                              const bool add,
+                              const int d1d = 0,
+                              const int q1d = 0)
+{
+   constexpr int DIM = 2;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().HCURL_MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().HCURL_MAX_Q1D, "");
+   const int NDOF_C = (D1D-1)*D1D;
+   const int NDOF = 2*NDOF_C;
+   const int NCOMP = curl ? 1 : 2;
+   const int NCOEFF = curl ? 1 : (symmetric ? 3 : 4);
+   const auto Bo = Reshape(bo.Read(), Q1D, D1D-1);
+   const auto Bc = Reshape(bc.Read(), Q1D, D1D);
+   const auto Gc = Reshape(gc.Read(), Q1D, D1D);
+   const auto D = Reshape(pa_data.Read(), Q1D, Q1D, NCOEFF, NE);
+   auto M = Reshape(add ? ea_data.ReadWrite() : ea_data.Write(), NDOF, NDOF, NE);
+   mfem::forall_2D(NE, NDOF, 1, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::HCURL_MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::HCURL_MAX_Q1D;
+      // Open basis, closed basis and closed derivative
+      MFEM_SHARED real_t s_B[3][MQ1][MD1];
+      MFEM_SHARED real_t s_D[DIM][DIM][MQ1][MQ1];
+      MFEM_FOREACH_THREAD(q, x, Q1D)
+      {
+         for (int d = 0; d < D1D; ++d)
+         {
+            s_B[0][q][d] = (d < D1D-1) ? Bo(q,d) : 0.0;
+            s_B[1][q][d] = Bc(q,d);
+            s_B[2][q][d] = Gc(q,d);
+         }
+      }
+      MFEM_FOREACH_THREAD(idx_q, x, Q1D*Q1D)
+      {
+         const int qx = idx_q % Q1D;
+         const int qy = idx_q / Q1D;
+         for (int a = 0; a < NCOMP; ++a)
+         {
+            for (int b = 0; b < NCOMP; ++b)
+            {
+               const int k = HcurlCoeffIndex<DIM>(curl, symmetric, a, b);
+               s_D[a][b][qy][qx] = D(qx,qy,k,e);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(i, x, NDOF)
+      {
+         const int ic = i / NDOF_C;
+         const int ii = i - ic*NDOF_C;
+         const int nx_i = (ic == 0) ? D1D-1 : D1D;
+         const int iy = ii / nx_i;
+         const int ix = ii - iy*nx_i;
+
+         // w_b = sum_a v_a O_ab, where v is the test function
+         real_t w[DIM][MQ1][MQ1];
+         for (int b = 0; b < NCOMP; ++b)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx) { w[b][qy][qx] = 0.0; }
+            }
+         }
+         for (int a = 0; a < NCOMP; ++a)
+         {
+            int f[3];
+            const int sign = HcurlBasisFactors<DIM>(curl, ic, a, f);
+            if (sign == 0) { continue; }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const real_t v = sign*s_B[f[0]][qx][ix]*s_B[f[1]][qy][iy];
+                  for (int b = 0; b < NCOMP; ++b)
+                  {
+                     w[b][qy][qx] += v*s_D[a][b][qy][qx];
+                  }
+               }
+            }
+         }
+
+         if (!add)
+         {
+            for (int j = 0; j < NDOF; ++j) { M(j,i,e) = 0.0; }
+         }
+         for (int jc = 0; jc < 2; ++jc)
+         {
+            const int nx_j = (jc == 0) ? D1D-1 : D1D;
+            const int ny_j = (jc == 1) ? D1D-1 : D1D;
+            for (int b = 0; b < NCOMP; ++b)
+            {
+               int f[3];
+               const int sign = HcurlBasisFactors<DIM>(curl, jc, b, f);
+               if (sign == 0) { continue; }
+               real_t t[MD1][MQ1];
+               for (int jx = 0; jx < nx_j; ++jx)
+               {
+                  for (int qy = 0; qy < Q1D; ++qy)
+                  {
+                     real_t val = 0.0;
+                     for (int qx = 0; qx < Q1D; ++qx)
+                     {
+                        val += s_B[f[0]][qx][jx]*w[b][qy][qx];
+                     }
+                     t[jx][qy] = val;
+                  }
+               }
+               for (int jy = 0; jy < ny_j; ++jy)
+               {
+                  for (int jx = 0; jx < nx_j; ++jx)
+                  {
+                     real_t val = 0.0;
+                     for (int qy = 0; qy < Q1D; ++qy)
+                     {
+                        val += s_B[f[1]][qy][jy]*t[jx][qy];
+                     }
+                     M(jc*NDOF_C + jx + nx_j*jy, i, e) += sign*val;
+                  }
+               }
+            }
+         }
+      }
+   });
+}
+
+template<int T_D1D = 0, int T_Q1D = 0>
+static void EAHcurlAssemble3D(const int NE,
+                              const Array<real_t> &bo,
+                              const Array<real_t> &bc,
+                              const Array<real_t> &gc,
+                              const bool curl,
+                              const bool symmetric,
+                              const Vector &pa_data,
+                              Vector &ea_data,
+                              const bool add,
+                              const int d1d = 0,
+                              const int q1d = 0)
+{
+   constexpr int DIM = 3;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().HCURL_MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().HCURL_MAX_Q1D, "");
+   const int NDOF_C = (D1D-1)*D1D*D1D;
+   const int NDOF = 3*NDOF_C;
+   const int NCOEFF = symmetric ? 6 : 9;
+   const auto Bo = Reshape(bo.Read(), Q1D, D1D-1);
+   const auto Bc = Reshape(bc.Read(), Q1D, D1D);
+   const auto Gc = Reshape(gc.Read(), Q1D, D1D);
+   const auto D = Reshape(pa_data.Read(), Q1D, Q1D, Q1D, NCOEFF, NE);
+   auto M = Reshape(add ? ea_data.ReadWrite() : ea_data.Write(), NDOF, NDOF, NE);
+   mfem::forall_2D(NE, NDOF, 1, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::HCURL_MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::HCURL_MAX_Q1D;
+      // Open basis, closed basis and closed derivative
+      MFEM_SHARED real_t s_B[3][MQ1][MD1];
+      MFEM_SHARED real_t s_D[DIM][DIM][MQ1][MQ1][MQ1];
+      MFEM_FOREACH_THREAD(q, x, Q1D)
+      {
+         for (int d = 0; d < D1D; ++d)
+         {
+            s_B[0][q][d] = (d < D1D-1) ? Bo(q,d) : 0.0;
+            s_B[1][q][d] = Bc(q,d);
+            s_B[2][q][d] = Gc(q,d);
+         }
+      }
+      MFEM_FOREACH_THREAD(idx_q, x, Q1D*Q1D*Q1D)
+      {
+         const int qx = idx_q % Q1D;
+         const int qy = (idx_q / Q1D) % Q1D;
+         const int qz = (idx_q / Q1D) / Q1D;
+         for (int a = 0; a < DIM; ++a)
+         {
+            for (int b = 0; b < DIM; ++b)
+            {
+               const int k = HcurlCoeffIndex<DIM>(curl, symmetric, a, b);
+               s_D[a][b][qz][qy][qx] = D(qx,qy,qz,k,e);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(i, x, NDOF)
+      {
+         const int ic = i / NDOF_C;
+         const int ii = i - ic*NDOF_C;
+         const int nx_i = (ic == 0) ? D1D-1 : D1D;
+         const int ny_i = (ic == 1) ? D1D-1 : D1D;
+         const int iyz = ii / nx_i;
+         const int ix = ii - iyz*nx_i;
+         const int iz = iyz / ny_i;
+         const int iy = iyz - iz*ny_i;
+
+         // w_b = sum_a v_a O_ab, where v is the test function
+         real_t w[DIM][MQ1][MQ1][MQ1];
+         for (int b = 0; b < DIM; ++b)
+         {
+            for (int qz = 0; qz < Q1D; ++qz)
+            {
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  for (int qx = 0; qx < Q1D; ++qx) { w[b][qz][qy][qx] = 0.0; }
+               }
+            }
+         }
+         for (int a = 0; a < DIM; ++a)
+         {
+            int f[3];
+            const int sign = HcurlBasisFactors<DIM>(curl, ic, a, f);
+            if (sign == 0) { continue; }
+            for (int qz = 0; qz < Q1D; ++qz)
+            {
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  const real_t v_yz = sign*s_B[f[1]][qy][iy]*s_B[f[2]][qz][iz];
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     const real_t v = v_yz*s_B[f[0]][qx][ix];
+                     for (int b = 0; b < DIM; ++b)
+                     {
+                        w[b][qz][qy][qx] += v*s_D[a][b][qz][qy][qx];
+                     }
+                  }
+               }
+            }
+         }
+
+         if (!add)
+         {
+            for (int j = 0; j < NDOF; ++j) { M(j,i,e) = 0.0; }
+         }
+         for (int jc = 0; jc < DIM; ++jc)
+         {
+            const int nx_j = (jc == 0) ? D1D-1 : D1D;
+            const int ny_j = (jc == 1) ? D1D-1 : D1D;
+            const int nz_j = (jc == 2) ? D1D-1 : D1D;
+            for (int b = 0; b < DIM; ++b)
+            {
+               int f[3];
+               const int sign = HcurlBasisFactors<DIM>(curl, jc, b, f);
+               if (sign == 0) { continue; }
+               real_t t1[MD1][MQ1][MQ1];
+               for (int jx = 0; jx < nx_j; ++jx)
+               {
+                  for (int qz = 0; qz < Q1D; ++qz)
+                  {
+                     for (int qy = 0; qy < Q1D; ++qy)
+                     {
+                        real_t val = 0.0;
+                        for (int qx = 0; qx < Q1D; ++qx)
+                        {
+                           val += s_B[f[0]][qx][jx]*w[b][qz][qy][qx];
+                        }
+                        t1[jx][qz][qy] = val;
+                     }
+                  }
+               }
+               real_t t2[MD1][MD1][MQ1];
+               for (int jy = 0; jy < ny_j; ++jy)
+               {
+                  for (int jx = 0; jx < nx_j; ++jx)
+                  {
+                     for (int qz = 0; qz < Q1D; ++qz)
+                     {
+                        real_t val = 0.0;
+                        for (int qy = 0; qy < Q1D; ++qy)
+                        {
+                           val += s_B[f[1]][qy][jy]*t1[jx][qz][qy];
+                        }
+                        t2[jy][jx][qz] = val;
+                     }
+                  }
+               }
+               for (int jz = 0; jz < nz_j; ++jz)
+               {
+                  for (int jy = 0; jy < ny_j; ++jy)
+                  {
+                     for (int jx = 0; jx < nx_j; ++jx)
+                     {
+                        real_t val = 0.0;
+                        for (int qz = 0; qz < Q1D; ++qz)
+                        {
+                           val += s_B[f[2]][qz][jz]*t2[jy][jx][qz];
+                        }
+                        const int j = jc*NDOF_C + jx + nx_j*(jy + ny_j*jz);
+                        M(j,i,e) += sign*val;
+                     }
+                  }
+               }
+            }
+         }
+      }
+   });
+}
+
+namespace internal
+{
+
+void EAHcurlAssemble(const int dim,
+                     const int D1D,
+                     const int Q1D,
+                     const int NE,
+                     const bool curl,
+                     const bool symmetric,
+                     const Array<real_t> &bo,
+                     const Array<real_t> &bc,
+                     const Array<real_t> &gc,
+                     const Vector &pa_data,
+                     Vector &ea_data,
+                     const bool add)
+{
+   if (dim == 2)
+   {
+      auto kernel = EAHcurlAssemble2D<0,0>;
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x23: kernel = EAHcurlAssemble2D<2,3>; break;
+         case 0x34: kernel = EAHcurlAssemble2D<3,4>; break;
+         case 0x45: kernel = EAHcurlAssemble2D<4,5>; break;
+         case 0x56: kernel = EAHcurlAssemble2D<5,6>; break;
+      }
+      return kernel(NE,bo,bc,gc,curl,symmetric,pa_data,ea_data,add,D1D,Q1D);
+   }
+   else if (dim == 3)
+   {
+      auto kernel = EAHcurlAssemble3D<0,0>;
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x23: kernel = EAHcurlAssemble3D<2,3>; break;
+         case 0x34: kernel = EAHcurlAssemble3D<3,4>; break;
+         case 0x45: kernel = EAHcurlAssemble3D<4,5>; break;
+         case 0x56: kernel = EAHcurlAssemble3D<5,6>; break;
+      }
+      return kernel(NE,bo,bc,gc,curl,symmetric,pa_data,ea_data,add,D1D,Q1D);
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+} // namespace internal
+
+void CurlCurlIntegrator::AssembleEA(const FiniteElementSpace &fes,
+                                    Vector &ea_data,
+                                    const bool add)
+{
+   AssemblePA(fes);
+   if (ne == 0) { return; }
+   internal::EAHcurlAssemble(dim, dofs1D, quad1D, ne, true, symmetric,
+                             mapsO->B, mapsC->B, mapsC->G, pa_data, ea_data,
+                             add);
+}
+
+}
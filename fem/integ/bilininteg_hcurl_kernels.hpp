@@ -406,6 +406,21 @@ inline void SmemPAHcurlMassApply3D(const int d1d,
    }); // end of element loop
 }
 
+// EA H(curl) Mass (curl == false) or curl-curl (curl == true) 2D and 3D
+// kernels, using the same quadrature data as the corresponding PA kernels.
+void EAHcurlAssemble(const int dim,
+                     const int D1D,
+                     const int Q1D,
+                     const int NE,
+                     const bool curl,
+                     const bool symmetric,
+                     const Array<real_t> &bo,
+                     const Array<real_t> &bc,
+                     const Array<real_t> &gc,
+                     const Vector &pa_data,
+                     Vector &ea_data,
+                     const bool add);
+
 // PA H(curl) curl-curl Assemble 2D kernel
 void PACurlCurlSetup2D(const int Q1D,
                        const int NE,
@@ -12,6 +12,7 @@
 #include "../../general/forall.hpp"
 #include "../bilininteg.hpp"
 #include "../gridfunc.hpp"
+#include "bilininteg_hcurl_kernels.hpp"
 
 namespace mfem
 {
@@ -269,6 +270,15 @@ void VectorFEMassIntegrator::AssembleEA(const FiniteElementSpace &fes,
 {
    AssemblePA(fes);
 
+   if (trial_fetype == mfem::FiniteElement::CURL &&
+       test_fetype == mfem::FiniteElement::CURL)
+   {
+      if (ne == 0) { return; }
+      internal::EAHcurlAssemble(dim, dofs1D, quad1D, ne, false, symmetric,
+                                mapsO->B, mapsC->B, mapsC->G, pa_data, ea_data,
+                                add);
+      return;
+   }
    if (trial_fetype != mfem::FiniteElement::DIV ||
        test_fetype != mfem::FiniteElement::DIV)
    {
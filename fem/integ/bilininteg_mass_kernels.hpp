@@ -1400,6 +1400,64 @@ inline void EAMassAssemble3D(const int NE,
    });
 }
 
+// PA Mass Apply kernel for non-tensor (e.g. simplex) elements, using the full
+// NQ x ND basis matrix B: y_e += B^T diag(D_e) B x_e. Each element is processed
+// as a pair of small dense matrix-vector products.
+inline void PAMassApplyNonTensor(const int NE,
+                                 const int ND,
+                                 const int NQ,
+                                 const Array<real_t> &b,
+                                 const Vector &d,
+                                 const Vector &x,
+                                 Vector &y)
+{
+   const int max_nq = DeviceDofQuadLimits::Get().MAX_Q1D *
+                      DeviceDofQuadLimits::Get().MAX_Q1D;
+   MFEM_VERIFY(NQ <= max_nq, "Too many quadrature points: " << NQ);
+   const auto B = Reshape(b.Read(), NQ, ND);
+   const auto D = Reshape(d.Read(), NQ, NE);
+   const auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall_2D(NE, std::max(ND, NQ), 1, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MAX_NQ = DofQuadLimits::MAX_Q1D*DofQuadLimits::MAX_Q1D;
+      MFEM_SHARED real_t u[MAX_NQ];
+      MFEM_FOREACH_THREAD(q,x,NQ)
+      {
+         real_t uq = 0.0;
+         for (int i = 0; i < ND; ++i) { uq += B(q,i) * X(i,e); }
+         u[q] = D(q,e) * uq;
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(i,x,ND)
+      {
+         real_t yi = 0.0;
+         for (int q = 0; q < NQ; ++q) { yi += B(q,i) * u[q]; }
+         Y(i,e) += yi;
+      }
+   });
+}
+
+// PA Mass Diagonal kernel for non-tensor elements
+inline void PAMassAssembleDiagonalNonTensor(const int NE,
+                                            const int ND,
+                                            const int NQ,
+                                            const Array<real_t> &b,
+                                            const Vector &d,
+                                            Vector &y)
+{
+   const auto B = Reshape(b.Read(), NQ, ND);
+   const auto D = Reshape(d.Read(), NQ, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(ND*NE, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = k % ND, e = k / ND;
+      real_t yi = 0.0;
+      for (int q = 0; q < NQ; ++q) { yi += B(q,i) * B(q,i) * D(q,e); }
+      Y(i,e) += yi;
+   });
+}
+
 } // namespace internal
 
 namespace
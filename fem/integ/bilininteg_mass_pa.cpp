@@ -50,9 +50,18 @@ void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    int map_type = el.GetMapType();
    dim = mesh->Dimension();
    ne = fes.GetMesh()->GetNE();
+   if (mesh->GetNumGeometries(dim) > 1)
+   {
+      AssemblePAMixed(fes);
+      return;
+   }
+   pa_groups.clear();
    nq = ir->GetNPoints();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::DETERMINANTS, mt);
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   // Non-tensor elements (e.g. simplices) use the full basis matrices, in
+   // which case dofs1D and quad1D are the total numbers of dofs and points.
+   maps = &el.GetDofToQuad(*ir, UsesTensorBasis(fes) ? DofToQuad::TENSOR :
+                           DofToQuad::FULL);
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
    pa_data.SetSize(ne*nq, mt);
@@ -78,6 +87,57 @@ void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    }
 }
 
+void MassIntegrator::AssemblePAMixed(const FiniteElementSpace &fes)
+{
+   SetupPAElementGroups(fes);
+   Mesh &mesh = *fes.GetMesh();
+   for (PAElementGroup &g : pa_groups)
+   {
+      const bool by_val =
+         fes.GetFE(g.elements[0])->GetMapType() == FiniteElement::VALUE;
+      g.pa_data.SetSize(g.nq*g.ne);
+      auto v = Reshape(g.pa_data.HostWrite(), g.nq, g.ne);
+      for (int k = 0; k < g.ne; k++)
+      {
+         const int e = g.elements[k];
+         ElementTransformation &T = *mesh.GetElementTransformation(e);
+         for (int q = 0; q < g.nq; q++)
+         {
+            const IntegrationPoint &ip = g.ir->IntPoint(q);
+            T.SetIntPoint(&ip);
+            const real_t detJ = T.Weight();
+            const real_t coeff = Q ? Q->Eval(T, ip) : 1.0;
+            v(q, k) = ip.weight * coeff * (by_val ? detJ : 1.0 / detJ);
+         }
+      }
+   }
+}
+
+void MassIntegrator::AddMultPAMixed(const Vector &x, Vector &y,
+                                    bool abs) const
+{
+   for (const PAElementGroup &g : pa_groups)
+   {
+      GatherPAElementGroup(g, x);
+      g.ye = 0.0;
+      if (abs)
+      {
+         Vector abs_pa_data(g.pa_data);
+         abs_pa_data.Abs();
+         Array<real_t> absB(g.maps->B);
+         absB.Abs();
+         internal::PAMassApplyNonTensor(g.ne, g.nd, g.nq, absB, abs_pa_data,
+                                        g.xe, g.ye);
+      }
+      else
+      {
+         internal::PAMassApplyNonTensor(g.ne, g.nd, g.nq, g.maps->B,
+                                        g.pa_data, g.xe, g.ye);
+      }
+      ScatterAddPAElementGroup(g, y);
+   }
+}
+
 void MassIntegrator::AssemblePABoundary(const FiniteElementSpace &fes)
 {
    const MemoryType mt = (pa_mt == MemoryType::DEFAULT) ?
@@ -130,6 +190,21 @@ void MassIntegrator::AssembleDiagonalPA(Vector &diag)
    {
       ceedOp->GetDiagonal(diag);
    }
+   else if (!pa_groups.empty())
+   {
+      for (const PAElementGroup &g : pa_groups)
+      {
+         g.ye = 0.0;
+         internal::PAMassAssembleDiagonalNonTensor(g.ne, g.nd, g.nq,
+                                                   g.maps->B, g.pa_data, g.ye);
+         ScatterAddPAElementGroup(g, diag, false);
+      }
+   }
+   else if (maps->mode == DofToQuad::FULL)
+   {
+      internal::PAMassAssembleDiagonalNonTensor(ne, dofs1D, quad1D, maps->B,
+                                                pa_data, diag);
+   }
    else
    {
       DiagonalPAKernels::Run(dim, dofs1D, quad1D, ne, maps->B, pa_data,
@@ -137,12 +212,36 @@ void MassIntegrator::AssembleDiagonalPA(Vector &diag)
    }
 }
 
+OperatorCostModel MassIntegrator::GetCostModelPA() const
+{
+   if (DeviceCanUseCeed()) { return BilinearFormIntegrator::GetCostModelPA(); }
+   OperatorCostModel cost;
+   if (!pa_groups.empty())
+   {
+      for (const PAElementGroup &g : pa_groups)
+      {
+         cost += PACostModel(*g.maps, dim, g.ne, 1, 1, 1, 1.0, g.pa_data);
+      }
+      return cost;
+   }
+   return PACostModel(*maps, dim, ne, 1, 1, 1, 1.0, pa_data);
+}
+
 void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
    if (DeviceCanUseCeed())
    {
       ceedOp->AddMult(x, y);
    }
+   else if (!pa_groups.empty())
+   {
+      AddMultPAMixed(x, y);
+   }
+   else if (maps->mode == DofToQuad::FULL)
+   {
+      internal::PAMassApplyNonTensor(ne, dofs1D, quad1D, maps->B, pa_data,
+                                     x, y);
+   }
    else
    {
       const int D1D = dofs1D;
@@ -175,6 +274,10 @@ void MassIntegrator::AddAbsMultPA(const Vector &x, Vector &y) const
       MFEM_ABORT("AddAbsMultPA not implemented with CEED!");
       ceedOp->AddMult(x, y);
    }
+   else if (!pa_groups.empty())
+   {
+      AddMultPAMixed(x, y, true);
+   }
    else
    {
       Vector abs_pa_data(pa_data);
@@ -184,6 +287,12 @@ void MassIntegrator::AddAbsMultPA(const Vector &x, Vector &y) const
       absB.Abs();
       absBt.Abs();
 
+      if (maps->mode == DofToQuad::FULL)
+      {
+         internal::PAMassApplyNonTensor(ne, dofs1D, quad1D, absB, abs_pa_data,
+                                        x, y);
+         return;
+      }
       ApplyPAKernels::Run(dim, dofs1D, quad1D, ne, absB, absBt, abs_pa_data,
                           x, y, dofs1D, quad1D);
    }
@@ -0,0 +1,105 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../fem.hpp"
+#include "../../mesh/nurbs.hpp"
+
+namespace mfem
+{
+
+void MassIntegrator::SetupPatchQData(const int patch, bool unitWeights,
+                                     Vector &qdata)
+{
+   Mesh &mesh = *fespace->GetMesh();
+   const internal::PatchBasisInfo &pb = patch_assembly.GetBasis(patch);
+   const int nq = pb.NumPoints();
+
+   Vector weights, jac, coeff;
+   internal::GetPatchGeometry(mesh, patch, *patchRules, pb, unitWeights,
+                              weights, jac);
+   internal::GetPatchCoefficient(Q, mesh, patch, *patchRules, pb, coeff);
+   const bool const_coeff = coeff.Size() == 1;
+
+   qdata.SetSize(nq);
+   DenseMatrix J(3);
+   for (int q = 0; q < nq; q++)
+   {
+      for (int i = 0; i < 9; i++) { J.GetData()[i] = jac[q + nq*i]; }
+      qdata[q] = weights[q] * J.Det() * (const_coeff ? coeff[0] : coeff[q]);
+   }
+}
+
+void MassIntegrator::ApplyPatchQFunction(const Vector &qdata, int q0, int nq,
+                                         const real_t *in, real_t *out) const
+{
+   const real_t *D = qdata.HostRead() + q0;
+   for (int c = 0; c < fespace->GetVDim(); c++)
+   {
+      for (int i = 0; i < nq; i++)
+      {
+         out[i + 4*c*nq] = D[i] * in[i + 4*c*nq];
+      }
+   }
+}
+
+void MassIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
+{
+   fespace = &fes;
+   MFEM_VERIFY(patchRules, "Patch-wise integration requires NURBSMeshRules");
+   patch_assembly.Setup(fes, *patchRules,
+                        internal::NURBSPatchAssembly::VALUES);
+
+   const int np = patch_assembly.GetNPatches();
+   patch_qdata.resize(np);
+   for (int p = 0; p < np; p++)
+   {
+      SetupPatchQData(p, false, patch_qdata[p]);
+   }
+}
+
+void MassIntegrator::AddMultNURBSPA(const Vector &x, Vector &y) const
+{
+   patch_assembly.AddMult([this](int p, int q0, int nq, const real_t *in,
+                                 real_t *out)
+   {
+      ApplyPatchQFunction(patch_qdata[p], q0, nq, in, out);
+   }, x, y);
+}
+
+void MassIntegrator::AssembleDiagonalNURBSPA(Vector &diag)
+{
+   patch_assembly.AssembleDiagonal([this](int p, int q0, int nq,
+                                          const real_t *in, real_t *out)
+   {
+      ApplyPatchQFunction(patch_qdata[p], q0, nq, in, out);
+   }, diag);
+}
+
+void MassIntegrator::AssemblePatchMatrix(const int patch,
+                                         const FiniteElementSpace &fes,
+                                         SparseMatrix*& smat)
+{
+   fespace = &fes;
+   MFEM_VERIFY(patchRules, "Patch-wise integration requires NURBSMeshRules");
+   patch_assembly.Setup(fes, *patchRules,
+                        internal::NURBSPatchAssembly::VALUES);
+
+   const bool reduced = integrationMode == Mode::PATCHWISE_REDUCED;
+   Vector qdata;
+   SetupPatchQData(patch, reduced, qdata);
+   smat = patch_assembly.AssemblePatchMatrix(
+             patch, [&](int, int q0, int nq, const real_t *in, real_t *out)
+   {
+      ApplyPatchQFunction(qdata, q0, nq, in, out);
+   }, false, reduced);
+}
+
+} // namespace mfem
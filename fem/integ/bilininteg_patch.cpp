@@ -0,0 +1,891 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bilininteg_patch.hpp"
+#include "../fem.hpp"
+#include "../../mesh/nurbs.hpp"
+
+namespace mfem
+{
+
+namespace internal
+{
+
+PatchBasisInfo::PatchBasisInfo(Mesh &mesh, int patch,
+                               const NURBSMeshRules &rules)
+   : dim(rules.GetDim()), Q1D(dim), D1D(dim), B(dim), G(dim), minD(dim),
+     maxD(dim), minQ(dim), maxQ(dim), minDD(dim), maxDD(dim), ir1d(dim),
+     X(dim)
+{
+   Array<const KnotVector*> pkv;
+   mesh.NURBSext->GetPatchKnotVectors(patch, pkv);
+   MFEM_VERIFY(pkv.Size() == dim, "");
+
+   for (int d=0; d<dim; ++d)
+   {
+      ir1d[d] = rules.GetPatchRule1D(patch, d);
+
+      Q1D[d] = ir1d[d]->GetNPoints();
+
+      const int order = pkv[d]->GetOrder();
+      D1D[d] = pkv[d]->GetNCP();
+
+      Vector shapeKV(order+1);
+      Vector dshapeKV(order+1);
+
+      B[d].SetSize(Q1D[d], D1D[d]);
+      G[d].SetSize(Q1D[d], D1D[d]);
+      X[d].SetSize(Q1D[d]);
+
+      minD[d].assign(D1D[d], Q1D[d]);
+      maxD[d].assign(D1D[d], 0);
+
+      minQ[d].assign(Q1D[d], D1D[d]);
+      maxQ[d].assign(Q1D[d], 0);
+
+      B[d] = 0.0;
+      G[d] = 0.0;
+
+      const Array<int>& knotSpan1D = rules.GetPatchRule1D_KnotSpan(patch, d);
+      MFEM_VERIFY(knotSpan1D.Size() == Q1D[d], "");
+
+      for (int i = 0; i < Q1D[d]; i++)
+      {
+         const IntegrationPoint &ip = ir1d[d]->IntPoint(i);
+         const int ijk = knotSpan1D[i];
+         const real_t kv0 = (*pkv[d])[order + ijk];
+         real_t kv1 = (*pkv[d])[0];
+         for (int j = order + ijk + 1; j < pkv[d]->Size(); ++j)
+         {
+            if ((*pkv[d])[j] > kv0)
+            {
+               kv1 = (*pkv[d])[j];
+               break;
+            }
+         }
+
+         MFEM_VERIFY(kv1 > kv0, "");
+
+         X[d][i] = (ip.x - kv0) / (kv1 - kv0);
+         pkv[d]->CalcShape(shapeKV, ijk, X[d][i]);
+         pkv[d]->CalcDShape(dshapeKV, ijk, X[d][i]);
+
+         // Put shapeKV into array B storing shapes for all points.
+         // TODO: This should be based on NURBS3DFiniteElement::CalcShape and
+         // CalcDShape. For now, it works under the assumption that all NURBS
+         // weights are 1.
+         for (int j=0; j<order+1; ++j)
+         {
+            B[d](i,ijk + j) = shapeKV[j];
+            G[d](i,ijk + j) = dshapeKV[j];
+
+            minD[d][ijk + j] = std::min(minD[d][ijk + j], i);
+            maxD[d][ijk + j] = std::max(maxD[d][ijk + j], i);
+         }
+
+         minQ[d][i] = std::min(minQ[d][i], ijk);
+         maxQ[d][i] = std::max(maxQ[d][i], ijk + order);
+      }
+
+      // Determine which DOFs each DOF interacts with, in 1D.
+      minDD[d].resize(D1D[d]);
+      maxDD[d].resize(D1D[d]);
+      for (int i=0; i<D1D[d]; ++i)
+      {
+         const int qmin = minD[d][i];
+         minDD[d][i] = minQ[d][qmin];
+
+         const int qmax = maxD[d][i];
+         maxDD[d][i] = maxQ[d][qmax];
+      }
+   }
+}
+
+void PatchBasisInfo::GetElementPoint(int qx, int qy, int qz,
+                                     IntegrationPoint &ip) const
+{
+   MFEM_ASSERT(dim == 3, "Only 3D so far");
+   ip.Set(X[0][qx], X[1][qy], X[2][qz], ir1d[0]->IntPoint(qx).weight *
+          ir1d[1]->IntPoint(qy).weight * ir1d[2]->IntPoint(qz).weight);
+}
+
+PatchReducedRules::PatchReducedRules(const PatchBasisInfo &pb)
+{
+   MFEM_VERIFY(pb.dim == 3, "Only 3D so far");
+   for (int d=0; d<pb.dim; ++d)
+   {
+      for (int t=0; t<2; ++t)
+      {
+         GetReducedRule(pb.Q1D[d], pb.D1D[d], pb.B[d], pb.G[d],
+                        pb.minQ[d], pb.maxQ[d],
+                        pb.minD[d], pb.maxD[d],
+                        pb.minDD[d], pb.maxDD[d], pb.ir1d[d], t == 0,
+                        weights[t][d], ids[t][d]);
+      }
+   }
+}
+
+// Compute a reduced integration rule, using NNLSSolver, for DiffusionIntegrator
+// on a NURBS patch with partial assembly.
+void GetReducedRule(const int nq, const int nd,
+                    Array2D<real_t> const& B,
+                    Array2D<real_t> const& G,
+                    std::vector<int> minQ,
+                    std::vector<int> maxQ,
+                    std::vector<int> minD,
+                    std::vector<int> maxD,
+                    std::vector<int> minDD,
+                    std::vector<int> maxDD,
+                    const IntegrationRule *ir,
+                    const bool zeroOrder,
+                    std::vector<Vector> & reducedWeights,
+                    std::vector<std::vector<int>> & reducedIDs)
+{
+   MFEM_VERIFY(B.NumRows() == nq, "");
+   MFEM_VERIFY(B.NumCols() == nd, "");
+   MFEM_VERIFY(G.NumRows() == nq, "");
+   MFEM_VERIFY(G.NumCols() == nd, "");
+   MFEM_VERIFY(ir->GetNPoints() == nq, "");
+
+   for (int dof=0; dof<nd; ++dof)
+   {
+      // Integrate diffusion for B(:,dof) against all other B(:,i)
+
+      const int nc_dof = maxDD[dof] - minDD[dof] + 1;
+      const int nw_dof = maxD[dof] - minD[dof] + 1;
+
+      // G is of size nc_dof x nw_dof
+      MFEM_VERIFY(nc_dof <= nw_dof, "The NNLS system for the reduced "
+                  "integration rule requires more full integration points. Try"
+                  " increasing the order of the full integration rule.");
+      DenseMatrix Gmat(nc_dof, nw_dof);
+      Gmat = 0.0;
+
+      Vector w(nw_dof);
+      w = 0.0;
+
+      for (int qx = minD[dof]; qx <= maxD[dof]; ++qx)
+      {
+         const real_t Bq = zeroOrder ? B(qx,dof) : G(qx,dof);
+
+         const IntegrationPoint &ip = ir->IntPoint(qx);
+         const real_t w_qx = ip.weight;
+         w[qx - minD[dof]] = w_qx;
+
+         for (int dx = minQ[qx]; dx <= maxQ[qx]; ++dx)
+         {
+            const real_t Bd = zeroOrder ? B(qx,dx) : G(qx,dx);
+
+            Gmat(dx - minDD[dof], qx - minD[dof]) = Bq * Bd;
+         }
+      }
+
+      Vector sol(Gmat.NumCols());
+
+#ifdef MFEM_USE_LAPACK
+      NNLSSolver nnls;
+      nnls.SetOperator(Gmat);
+
+      nnls.Mult(w, sol);
+#else
+      MFEM_ABORT("NNLSSolver requires building with LAPACK");
+#endif
+
+      int nnz = 0;
+      for (int i=0; i<sol.Size(); ++i)
+      {
+         if (sol(i) != 0.0)
+         {
+            nnz++;
+         }
+      }
+
+      MFEM_VERIFY(nnz > 0, "");
+
+      Vector wred(nnz);
+      std::vector<int> idnnz(nnz);
+      nnz = 0;
+      for (int i=0; i<sol.Size(); ++i)
+      {
+         if (sol(i) != 0.0)
+         {
+            wred[nnz] = sol[i];
+            idnnz[nnz] = i;
+            nnz++;
+         }
+      }
+
+      reducedWeights.push_back(wred);
+      reducedIDs.push_back(idnnz);
+   }
+}
+
+// Basis functions (k != d + 1) or their derivatives (k == d + 1) in the
+// dimension d, for the quantity k: 0 for the values and 1 + d for the
+// derivatives in the dimension d.
+static inline const Array2D<real_t> &PatchBasis1D(const PatchBasisInfo &pb,
+                                                  int k, int d)
+{
+   return (k == d + 1) ? pb.G[d] : pb.B[d];
+}
+
+// Values U(q, 0) and reference gradients U(q, 1 + d) at the points of the
+// patch of the scalar field X, adapted from
+// DiffusionIntegrator::AddMultPatchPA.
+static void PatchInterp3D(const PatchBasisInfo &pb, int types,
+                          const real_t *x, real_t *u)
+{
+   const bool values = types & NURBSPatchAssembly::VALUES;
+   const bool grads = types & NURBSPatchAssembly::GRADIENTS;
+   const Array<int> &Q1D = pb.Q1D, &D1D = pb.D1D;
+   const int nq = pb.NumPoints();
+   const auto &B = pb.B, &G = pb.G;
+   const auto &minD = pb.minD, &maxD = pb.maxD;
+
+   for (int k = values ? 0 : 1; k < (grads ? 4 : 1); k++)
+   {
+      for (int q = 0; q < nq; q++) { u[q + k*nq] = 0.0; }
+   }
+
+   // sX(0) = B X and sX(1) = G X in x. sXY(0), sXY(1) and sXY(2) are the
+   // products with (G, B), (B, G) and (B, B) in (x, y).
+   Array2D<real_t> sX(2, Q1D[0]);
+   Array3D<real_t> sXY(3, Q1D[0], Q1D[1]);
+
+   for (int dz = 0; dz < D1D[2]; ++dz)
+   {
+      sXY = 0.0;
+      for (int dy = 0; dy < D1D[1]; ++dy)
+      {
+         sX = 0.0;
+         for (int dx = 0; dx < D1D[0]; ++dx)
+         {
+            const real_t s = x[dx + D1D[0]*(dy + D1D[1]*dz)];
+            for (int qx = minD[0][dx]; qx <= maxD[0][dx]; ++qx)
+            {
+               sX(0,qx) += s * B[0](qx,dx);
+               if (grads) { sX(1,qx) += s * G[0](qx,dx); }
+            }
+         }
+         for (int qy = minD[1][dy]; qy <= maxD[1][dy]; ++qy)
+         {
+            const real_t wy  = B[1](qy,dy);
+            const real_t wDy = G[1](qy,dy);
+            for (int qx = 0; qx < Q1D[0]; ++qx)
+            {
+               sXY(2,qx,qy) += sX(0,qx) * wy;
+               if (grads)
+               {
+                  sXY(0,qx,qy) += sX(1,qx) * wy;
+                  sXY(1,qx,qy) += sX(0,qx) * wDy;
+               }
+            }
+         }
+      }
+      for (int qz = minD[2][dz]; qz <= maxD[2][dz]; ++qz)
+      {
+         const real_t wz  = B[2](qz,dz);
+         const real_t wDz = G[2](qz,dz);
+         for (int qy = 0; qy < Q1D[1]; ++qy)
+         {
+            for (int qx = 0; qx < Q1D[0]; ++qx)
+            {
+               const int q = qx + Q1D[0]*(qy + Q1D[1]*qz);
+               if (values) { u[q] += sXY(2,qx,qy) * wz; }
+               if (grads)
+               {
+                  u[q + nq]   += sXY(0,qx,qy) * wz;
+                  u[q + 2*nq] += sXY(1,qx,qy) * wz;
+                  u[q + 3*nq] += sXY(2,qx,qy) * wDz;
+               }
+            }
+         }
+      }
+   }
+}
+
+// Transpose of PatchInterp3D: add to Y the integrals of U(q, 0) against the
+// basis functions and of U(q, 1 + d) against their reference derivatives.
+static void PatchInterpTranspose3D(const PatchBasisInfo &pb, int types,
+                                   const real_t *u, real_t *y)
+{
+   const bool values = types & NURBSPatchAssembly::VALUES;
+   const bool grads = types & NURBSPatchAssembly::GRADIENTS;
+   const Array<int> &Q1D = pb.Q1D, &D1D = pb.D1D;
+   const int nq = pb.NumPoints();
+   const auto &B = pb.B, &G = pb.G;
+   const auto &minQ = pb.minQ, &maxQ = pb.maxQ;
+
+   // The quantity k is integrated against the basis functions in x, y and z
+   // given by PatchBasis1D(pb, k, d).
+   Array2D<real_t> sX(4, D1D[0]);
+   Array3D<real_t> sXY(4, D1D[0], D1D[1]);
+
+   for (int qz = 0; qz < Q1D[2]; ++qz)
+   {
+      sXY = 0.0;
+      for (int qy = 0; qy < Q1D[1]; ++qy)
+      {
+         sX = 0.0;
+         for (int qx = 0; qx < Q1D[0]; ++qx)
+         {
+            const int q = qx + Q1D[0]*(qy + Q1D[1]*qz);
+            for (int dx = minQ[0][qx]; dx <= maxQ[0][qx]; ++dx)
+            {
+               const real_t wx  = B[0](qx,dx);
+               if (values) { sX(0,dx) += u[q] * wx; }
+               if (grads)
+               {
+                  sX(1,dx) += u[q + nq] * G[0](qx,dx);
+                  sX(2,dx) += u[q + 2*nq] * wx;
+                  sX(3,dx) += u[q + 3*nq] * wx;
+               }
+            }
+         }
+         for (int dy = minQ[1][qy]; dy <= maxQ[1][qy]; ++dy)
+         {
+            const real_t wy  = B[1](qy,dy);
+            const real_t wDy = G[1](qy,dy);
+            for (int dx = 0; dx < D1D[0]; ++dx)
+            {
+               if (values) { sXY(0,dx,dy) += sX(0,dx) * wy; }
+               if (grads)
+               {
+                  sXY(1,dx,dy) += sX(1,dx) * wy;
+                  sXY(2,dx,dy) += sX(2,dx) * wDy;
+                  sXY(3,dx,dy) += sX(3,dx) * wy;
+               }
+            }
+         }
+      }
+      for (int dz = minQ[2][qz]; dz <= maxQ[2][qz]; ++dz)
+      {
+         const real_t wz  = B[2](qz,dz);
+         const real_t wDz = G[2](qz,dz);
+         for (int dy = 0; dy < D1D[1]; ++dy)
+         {
+            for (int dx = 0; dx < D1D[0]; ++dx)
+            {
+               y[dx + D1D[0]*(dy + D1D[1]*dz)] +=
+                  (sXY(0,dx,dy) + sXY(1,dx,dy) + sXY(2,dx,dy)) * wz +
+                  sXY(3,dx,dy) * wDz;
+            }
+         }
+      }
+   }
+}
+
+// Add to diag(i) the sum over the points of D(q) psi_k(q) psi_l(q), where psi_k
+// is the quantity k of the basis function i.
+static void PatchDiagonal3D(const PatchBasisInfo &pb, int k, int l,
+                            const real_t *D, real_t *diag)
+{
+   const Array<int> &Q1D = pb.Q1D, &D1D = pb.D1D;
+   const auto &minD = pb.minD, &maxD = pb.maxD;
+   auto f = [&](int d, int q, int i)
+   {
+      return PatchBasis1D(pb, k, d)(q,i) * PatchBasis1D(pb, l, d)(q,i);
+   };
+
+   Array3D<real_t> T1(D1D[0], Q1D[1], Q1D[2]);
+   for (int qz = 0; qz < Q1D[2]; ++qz)
+   {
+      for (int qy = 0; qy < Q1D[1]; ++qy)
+      {
+         for (int dx = 0; dx < D1D[0]; ++dx)
+         {
+            real_t s = 0.0;
+            for (int qx = minD[0][dx]; qx <= maxD[0][dx]; ++qx)
+            {
+               s += f(0, qx, dx) * D[qx + Q1D[0]*(qy + Q1D[1]*qz)];
+            }
+            T1(dx,qy,qz) = s;
+         }
+      }
+   }
+   Array3D<real_t> T2(D1D[0], D1D[1], Q1D[2]);
+   for (int qz = 0; qz < Q1D[2]; ++qz)
+   {
+      for (int dy = 0; dy < D1D[1]; ++dy)
+      {
+         for (int dx = 0; dx < D1D[0]; ++dx)
+         {
+            real_t s = 0.0;
+            for (int qy = minD[1][dy]; qy <= maxD[1][dy]; ++qy)
+            {
+               s += f(1, qy, dy) * T1(dx,qy,qz);
+            }
+            T2(dx,dy,qz) = s;
+         }
+      }
+   }
+   for (int dz = 0; dz < D1D[2]; ++dz)
+   {
+      for (int dy = 0; dy < D1D[1]; ++dy)
+      {
+         for (int dx = 0; dx < D1D[0]; ++dx)
+         {
+            real_t s = 0.0;
+            for (int qz = minD[2][dz]; qz <= maxD[2][dz]; ++qz)
+            {
+               s += f(2, qz, dz) * T2(dx,dy,qz);
+            }
+            diag[dx + D1D[0]*(dy + D1D[1]*dz)] += s;
+         }
+      }
+   }
+}
+
+// Quantities selected by types: 0 for the values, 1 to 3 for the gradients.
+static Array<int> PatchQuantities(int types)
+{
+   Array<int> ks;
+   if (types & NURBSPatchAssembly::VALUES) { ks.Append(0); }
+   if (types & NURBSPatchAssembly::GRADIENTS)
+   {
+      ks.Append(1); ks.Append(2); ks.Append(3);
+   }
+   return ks;
+}
+
+void NURBSPatchAssembly::Setup(const FiniteElementSpace &fes_,
+                               NURBSMeshRules &rules_, int types_)
+{
+   Mesh *mesh = fes_.GetMesh();
+   MFEM_VERIFY(mesh->NURBSext, "Patch-wise assembly requires a NURBS mesh");
+   MFEM_VERIFY(mesh->Dimension() == 3, "Only 3D so far");
+   MFEM_VERIFY(rules_.GetDim() == 3, "");
+   const int np = mesh->NURBSext->GetNP();
+   if (&fes_ == fes && &rules_ == rules && types_ == types &&
+       GetNPatches() == np)
+   {
+      return;
+   }
+   fes = &fes_;
+   rules = &rules_;
+   types = types_;
+   basis.clear();
+   basis.resize(np);
+   reduced_rules.clear();
+   reduced_rules.resize(np);
+}
+
+const PatchBasisInfo &NURBSPatchAssembly::GetBasis(int patch)
+{
+   if (!basis[patch])
+   {
+      basis[patch].reset(
+         new PatchBasisInfo(*fes->GetMesh(), patch, *rules));
+   }
+   return *basis[patch];
+}
+
+const PatchReducedRules &NURBSPatchAssembly::GetReducedRules(int patch)
+{
+   if (!reduced_rules[patch])
+   {
+      reduced_rules[patch].reset(new PatchReducedRules(GetBasis(patch)));
+   }
+   return *reduced_rules[patch];
+}
+
+void NURBSPatchAssembly::AddMult(const QFunction &qf, const Vector &x,
+                                 Vector &y) const
+{
+   const int vdim = fes->GetVDim();
+   Array<int> vdofs;
+   Vector xp, yp, qin, qout;
+   for (int p = 0; p < GetNPatches(); p++)
+   {
+      MFEM_VERIFY(basis[p], "The patch data is not set up");
+      const PatchBasisInfo &pb = *basis[p];
+      const int nd = pb.NumDofs(), nq = pb.NumPoints();
+
+      fes->GetPatchVDofs(p, vdofs);
+      MFEM_ASSERT(vdofs.Size() == vdim*nd, "");
+      x.GetSubVector(vdofs, xp);
+      yp.SetSize(vdofs.Size());
+      yp = 0.0;
+
+      qin.SetSize(4*nq*vdim);
+      qout.SetSize(4*nq*vdim);
+      const real_t *d_xp = xp.HostRead();
+      real_t *d_in = qin.HostWrite(), *d_out = qout.HostWrite();
+      for (int c = 0; c < vdim; c++)
+      {
+         PatchInterp3D(pb, types, d_xp + c*nd, d_in + 4*c*nq);
+      }
+      qf(p, 0, nq, d_in, d_out);
+      real_t *d_yp = yp.HostReadWrite();
+      for (int c = 0; c < vdim; c++)
+      {
+         PatchInterpTranspose3D(pb, types, d_out + 4*c*nq, d_yp + c*nd);
+      }
+
+      y.AddElementVector(vdofs, yp);
+   }
+}
+
+void NURBSPatchAssembly::AssembleDiagonal(const QFunction &qf,
+                                          Vector &diag) const
+{
+   const int vdim = fes->GetVDim();
+   const Array<int> ks = PatchQuantities(types);
+   Array<int> vdofs;
+   Vector dp, qin, qout;
+   for (int p = 0; p < GetNPatches(); p++)
+   {
+      MFEM_VERIFY(basis[p], "The patch data is not set up");
+      const PatchBasisInfo &pb = *basis[p];
+      const int nd = pb.NumDofs(), nq = pb.NumPoints();
+
+      fes->GetPatchVDofs(p, vdofs);
+      MFEM_ASSERT(vdofs.Size() == vdim*nd, "");
+      dp.SetSize(vdofs.Size());
+      dp = 0.0;
+      qin.SetSize(4*nq*vdim);
+      qout.SetSize(4*nq*vdim);
+      qin = 0.0;
+
+      // The entries D_kl(q) of the operator at the points, for the component
+      // a, are the outputs l of the QFunction for the unit input k.
+      real_t *d_in = qin.HostReadWrite(), *d_out = qout.HostWrite();
+      real_t *d_dp = dp.HostReadWrite();
+      for (int a = 0; a < vdim; a++)
+      {
+         for (int k : ks)
+         {
+            real_t *in_k = d_in + (k + 4*a)*nq;
+            for (int q = 0; q < nq; q++) { in_k[q] = 1.0; }
+            qf(p, 0, nq, d_in, d_out);
+            for (int q = 0; q < nq; q++) { in_k[q] = 0.0; }
+            for (int l : ks)
+            {
+               PatchDiagonal3D(pb, k, l, d_out + (l + 4*a)*nq, d_dp + a*nd);
+            }
+         }
+      }
+
+      diag.AddElementVector(vdofs, dp);
+   }
+}
+
+// This version assembles the matrix row by row, using only the points in the
+// support of the basis function of each row, as in DiffusionIntegrator.
+SparseMatrix *NURBSPatchAssembly::AssemblePatchMatrix(int patch,
+                                                      const QFunction &qf,
+                                                      bool coupled,
+                                                      bool reduced)
+{
+   const PatchBasisInfo &pb = GetBasis(patch);
+   const PatchReducedRules *rr = reduced ? &GetReducedRules(patch) : nullptr;
+   const Array<int> ks = PatchQuantities(types);
+
+   const int vdim = fes->GetVDim();
+   const int nd = pb.NumDofs(), n = vdim*nd;
+   const Array<int> &Q1D = pb.Q1D, &D1D = pb.D1D;
+   const auto &minD = pb.minD, &maxD = pb.maxD;
+   const auto &minQ = pb.minQ, &maxQ = pb.maxQ;
+   const auto &minDD = pb.minDD, &maxDD = pb.maxDD;
+   const int ncomp = coupled ? vdim : 1;
+
+   auto dof_index = [&](int i, int jd[3])
+   {
+      jd[0] = i % D1D[0];
+      jd[1] = (i / D1D[0]) % D1D[1];
+      jd[2] = i / (D1D[0] * D1D[1]);
+   };
+
+   // Sparsity: the row of the component a of the basis function j couples
+   // with the basis functions whose support overlaps that of j, in the
+   // components b = a or, if coupled, all b.
+   int *smati = Memory<int>(n+1);
+   smati[0] = 0;
+   int maxw[3] = {0, 0, 0}, maxq[3] = {0, 0, 0};
+   for (int d = 0; d < 3; d++)
+   {
+      for (int i = 0; i < D1D[d]; i++)
+      {
+         maxw[d] = std::max(maxw[d], maxDD[d][i] - minDD[d][i] + 1);
+         maxq[d] = std::max(maxq[d], maxD[d][i] - minD[d][i] + 1);
+      }
+   }
+   for (int a = 0; a < vdim; a++)
+   {
+      for (int j = 0; j < nd; j++)
+      {
+         int jd[3];
+         dof_index(j, jd);
+         int ndd = ncomp;
+         for (int d = 0; d < 3; d++)
+         {
+            ndd *= maxDD[d][jd[d]] - minDD[d][jd[d]] + 1;
+         }
+         smati[a*nd + j + 1] = smati[a*nd + j] + ndd;
+      }
+   }
+   const int nnz = smati[n];
+   int *smatj = Memory<int>(nnz);
+   real_t *smata = Memory<real_t>(nnz);
+   for (int i = 0; i < nnz; i++) { smata[i] = 0.0; }
+
+   for (int a = 0; a < vdim; a++)
+   {
+      for (int j = 0; j < nd; j++)
+      {
+         int jd[3];
+         dof_index(j, jd);
+         int m = smati[a*nd + j];
+         for (int b = coupled ? 0 : a; b < (coupled ? vdim : a + 1); b++)
+         {
+            for (int iz = minDD[2][jd[2]]; iz <= maxDD[2][jd[2]]; iz++)
+            {
+               for (int iy = minDD[1][jd[1]]; iy <= maxDD[1][jd[1]]; iy++)
+               {
+                  for (int ix = minDD[0][jd[0]]; ix <= maxDD[0][jd[0]]; ix++)
+                  {
+                     smatj[m++] = b*nd + ix + D1D[0]*(iy + D1D[1]*iz);
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   // Outputs of the QFunction at the points in the support of the basis
+   // function of the row, computed when first needed.
+   const int nout = 4*vdim;
+   Vector qout(maxq[0]*maxq[1]*maxq[2]*nout), qin(nout);
+   Array<bool> qdone(maxq[0]*maxq[1]*maxq[2]);
+   Vector T1(ncomp*maxw[0]), T2(ncomp*maxw[0]*maxw[1]);
+   std::vector<int> pts[3];
+   std::vector<real_t> wts[3];
+
+   for (int j = 0; j < nd; j++)
+   {
+      int jd[3], nw[3], nqj[3];
+      dof_index(j, jd);
+      for (int d = 0; d < 3; d++)
+      {
+         nw[d] = maxDD[d][jd[d]] - minDD[d][jd[d]] + 1;
+         nqj[d] = maxD[d][jd[d]] - minD[d][jd[d]] + 1;
+      }
+      const int ndd = nw[0]*nw[1]*nw[2];
+
+      auto point_output = [&](int qx, int qy, int qz, int a) -> const real_t*
+      {
+         const int lx = qx - minD[0][jd[0]];
+         const int ly = qy - minD[1][jd[1]];
+         const int lz = qz - minD[2][jd[2]];
+         const int lq = lx + nqj[0]*(ly + nqj[1]*lz);
+         real_t *out = qout.GetData() + lq*nout;
+         if (!qdone[lq])
+         {
+            qin = 0.0;
+            for (int k : ks)
+            {
+               qin[k + 4*a] = PatchBasis1D(pb, k, 0)(qx,jd[0]) *
+                              PatchBasis1D(pb, k, 1)(qy,jd[1]) *
+                              PatchBasis1D(pb, k, 2)(qz,jd[2]);
+            }
+            qf(patch, qx + Q1D[0]*(qy + Q1D[1]*qz), 1, qin.GetData(), out);
+            qdone[lq] = true;
+         }
+         return out;
+      };
+
+      for (int a = 0; a < vdim; a++)
+      {
+         qdone = false;
+         real_t *row = smata + smati[a*nd + j];
+         const int b0 = coupled ? 0 : a;
+
+         for (int l : ks)
+         {
+            // Points and weights in each dimension. With reduced rules, the
+            // rule type in the dimension d is 1 for the derivatives in d.
+            for (int d = 0; d < 3; d++)
+            {
+               pts[d].clear();
+               wts[d].clear();
+               if (rr)
+               {
+                  const int t = (l == d + 1) ? 1 : 0;
+                  const std::vector<int> &ids = rr->ids[t][d][jd[d]];
+                  const Vector &w = rr->weights[t][d][jd[d]];
+                  for (int r = 0; r < (int) ids.size(); r++)
+                  {
+                     pts[d].push_back(ids[r] + minD[d][jd[d]]);
+                     wts[d].push_back(w[r]);
+                  }
+               }
+               else
+               {
+                  for (int q = minD[d][jd[d]]; q <= maxD[d][jd[d]]; q++)
+                  {
+                     pts[d].push_back(q);
+                     wts[d].push_back(1.0);
+                  }
+               }
+            }
+            const Array2D<real_t> &fx = PatchBasis1D(pb, l, 0);
+            const Array2D<real_t> &fy = PatchBasis1D(pb, l, 1);
+            const Array2D<real_t> &fz = PatchBasis1D(pb, l, 2);
+
+            for (int rz = 0; rz < (int) pts[2].size(); rz++)
+            {
+               const int qz = pts[2][rz];
+               T2 = 0.0;
+               for (int ry = 0; ry < (int) pts[1].size(); ry++)
+               {
+                  const int qy = pts[1][ry];
+                  T1 = 0.0;
+                  for (int rx = 0; rx < (int) pts[0].size(); rx++)
+                  {
+                     const int qx = pts[0][rx];
+                     const real_t *out = point_output(qx, qy, qz, a);
+                     for (int c = 0; c < ncomp; c++)
+                     {
+                        const real_t v = out[l + 4*(b0 + c)] * wts[0][rx];
+                        for (int ix = minQ[0][qx]; ix <= maxQ[0][qx]; ix++)
+                        {
+                           T1[c*nw[0] + ix - minDD[0][jd[0]]] += v * fx(qx,ix);
+                        }
+                     }
+                  }
+                  for (int iy = minQ[1][qy]; iy <= maxQ[1][qy]; iy++)
+                  {
+                     const real_t w = wts[1][ry] * fy(qy,iy);
+                     const int ly = iy - minDD[1][jd[1]];
+                     for (int c = 0; c < ncomp; c++)
+                     {
+                        for (int ix = 0; ix < nw[0]; ix++)
+                        {
+                           T2[ix + nw[0]*(ly + nw[1]*c)] +=
+                              T1[c*nw[0] + ix] * w;
+                        }
+                     }
+                  }
+               }
+               for (int iz = minQ[2][qz]; iz <= maxQ[2][qz]; iz++)
+               {
+                  const real_t w = wts[2][rz] * fz(qz,iz);
+                  const int lz = iz - minDD[2][jd[2]];
+                  for (int c = 0; c < ncomp; c++)
+                  {
+                     real_t *R = row + c*ndd + lz*nw[0]*nw[1];
+                     const real_t *S = T2.GetData() + c*nw[0]*nw[1];
+                     for (int i = 0; i < nw[0]*nw[1]; i++) { R[i] += S[i] * w; }
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   if (reduced)
+   {
+      for (int i=0; i<nnz; ++i)
+      {
+         if (smata[i] == 0.0)
+         {
+            // This prevents failure of SparseMatrix EliminateRowCol, as in
+            // DiffusionIntegrator::AssemblePatchMatrix_reducedQuadrature.
+            smata[i] = 1.0e-16;
+         }
+      }
+   }
+
+   // Note that the SparseMatrix takes ownership of its input data.
+   return new SparseMatrix(smati, smatj, smata, n, n);
+}
+
+void GetPatchGeometry(Mesh &mesh, int patch, NURBSMeshRules &rules,
+                      const PatchBasisInfo &pb, bool unit_weights,
+                      Vector &weights, Vector &jac)
+{
+   const Array<int> &Q1D = pb.Q1D;
+   const int nq = pb.NumPoints();
+   weights.SetSize(nq);
+   jac.SetSize(9*nq);
+   real_t *w = weights.HostWrite(), *J = jac.HostWrite();
+   IntegrationPoint ip;
+   for (int qz=0; qz<Q1D[2]; ++qz)
+   {
+      for (int qy=0; qy<Q1D[1]; ++qy)
+      {
+         for (int qx=0; qx<Q1D[0]; ++qx)
+         {
+            const int p = qx + (qy * Q1D[0]) + (qz * Q1D[0] * Q1D[1]);
+            pb.GetElementPoint(qx, qy, qz, ip);
+            const int e = rules.GetPointElement(patch, qx, qy, qz);
+            ElementTransformation *tr = mesh.GetElementTransformation(e);
+
+            w[p] = unit_weights ? 1.0 : ip.weight;
+
+            tr->SetIntPoint(&ip);
+
+            const DenseMatrix& Jp = tr->Jacobian();
+            for (int i=0; i<3; ++i)
+            {
+               for (int j=0; j<3; ++j)
+               {
+                  J[p + ((i + (j * 3)) * nq)] = Jp(i,j);
+               }
+            }
+         }
+      }
+   }
+}
+
+void GetPatchCoefficient(Coefficient *Q, Mesh &mesh, int patch,
+                         NURBSMeshRules &rules, const PatchBasisInfo &pb,
+                         Vector &coeff)
+{
+   if (Q == nullptr)
+   {
+      coeff.SetSize(1);
+      coeff = 1.0;
+      return;
+   }
+   if (ConstantCoefficient *cQ = dynamic_cast<ConstantCoefficient*>(Q))
+   {
+      coeff.SetSize(1);
+      coeff = cQ->constant;
+      return;
+   }
+   MFEM_VERIFY(!dynamic_cast<QuadratureFunctionCoefficient*>(Q),
+               "QuadratureFunction not supported yet");
+
+   const Array<int> &Q1D = pb.Q1D;
+   coeff.SetSize(pb.NumPoints());
+   real_t *C = coeff.HostWrite();
+   IntegrationPoint ip;
+   for (int qz=0; qz<Q1D[2]; ++qz)
+   {
+      for (int qy=0; qy<Q1D[1]; ++qy)
+      {
+         for (int qx=0; qx<Q1D[0]; ++qx)
+         {
+            const int p = qx + (qy * Q1D[0]) + (qz * Q1D[0] * Q1D[1]);
+            const int e = rules.GetPointElement(patch, qx, qy, qz);
+            ElementTransformation *tr = mesh.GetElementTransformation(e);
+            pb.GetElementPoint(qx, qy, qz, ip);
+
+            C[p] = Q->Eval(*tr, ip);
+         }
+      }
+   }
+}
+
+} // namespace internal
+
+} // namespace mfem
@@ -0,0 +1,175 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_BILININTEG_PATCH_HPP
+#define MFEM_BILININTEG_PATCH_HPP
+
+#include "../../config/config.hpp"
+#include "../../general/array.hpp"
+#include "../../linalg/sparsemat.hpp"
+#include "../intrules.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+/// \cond DO_NOT_DOCUMENT
+namespace mfem
+{
+
+class Coefficient;
+class FiniteElementSpace;
+class Mesh;
+
+namespace internal
+{
+
+/// @brief 1D basis data of a 3D NURBS patch, at the points of the tensor
+/// product rule of the patch given by a NURBSMeshRules.
+///
+/// As in DiffusionIntegrator, the basis functions are computed from the knot
+/// vectors of the patch, i.e. all NURBS weights are assumed to be 1.
+struct PatchBasisInfo
+{
+   int dim;
+   /// Number of points and of basis functions in each dimension.
+   Array<int> Q1D, D1D;
+   /// Basis functions B[d](q, i) and their derivatives G[d](q, i).
+   std::vector<Array2D<real_t>> B, G;
+   /** For each dimension, the range [minD[i], maxD[i]] of the points in the
+       support of the basis function i, the range [minQ[q], maxQ[q]] of the
+       basis functions that are nonzero at the point q, and the range
+       [minDD[i], maxDD[i]] of the basis functions whose support overlaps that
+       of the basis function i. */
+   std::vector<std::vector<int>> minD, maxD, minQ, maxQ, minDD, maxDD;
+   /// 1D rules in each dimension, owned by the NURBSMeshRules.
+   Array<const IntegrationRule*> ir1d;
+   /** Coordinates X[d](q) of the points in the reference interval of their
+       knot span, as expected by the element transformations. */
+   std::vector<Vector> X;
+
+   PatchBasisInfo(Mesh &mesh, int patch, const NURBSMeshRules &rules);
+
+   int NumPoints() const { return Q1D[0] * Q1D[1] * Q1D[2]; }
+   int NumDofs() const { return D1D[0] * D1D[1] * D1D[2]; }
+
+   /** @brief Return in @a ip the point (qx, qy, qz) of the patch rule, in the
+       reference coordinates of the element containing it. */
+   void GetElementPoint(int qx, int qy, int qz, IntegrationPoint &ip) const;
+};
+
+/// @brief Reduced 1D quadrature rules of a patch, computed by NNLSSolver, see
+/// DiffusionIntegrator.
+///
+/// For the rule type t (0 for the products of basis functions, 1 for the
+/// products of their derivatives), the dimension d and the 1D basis function
+/// i, the rule has the weights weights[t][d][i] at the points
+/// ids[t][d][i][n] + minD[d][i].
+struct PatchReducedRules
+{
+   std::vector<Vector> weights[2][3];
+   std::vector<std::vector<int>> ids[2][3];
+
+   PatchReducedRules(const PatchBasisInfo &pb);
+};
+
+/// Compute a reduced 1D integration rule, see DiffusionIntegrator.
+void GetReducedRule(const int nq, const int nd,
+                    Array2D<real_t> const& B,
+                    Array2D<real_t> const& G,
+                    std::vector<int> minQ,
+                    std::vector<int> maxQ,
+                    std::vector<int> minD,
+                    std::vector<int> maxD,
+                    std::vector<int> minDD,
+                    std::vector<int> maxDD,
+                    const IntegrationRule *ir,
+                    const bool zeroOrder,
+                    std::vector<Vector> & reducedWeights,
+                    std::vector<std::vector<int>> & reducedIDs);
+
+/// @brief Patch-wise partial assembly and matrix assembly of a symmetric
+/// bilinear form on the NURBS patches of a 3D mesh.
+///
+/// The values and the reference gradients of the basis functions are computed
+/// at the points of the patch rules with sum factorization. The integrator
+/// defines the form by a QFunction, which maps these quantities of the trial
+/// function to the ones that are integrated against the test function, at
+/// each point of a patch. The inputs and outputs of the QFunction have the
+/// layout (nq, 4, vdim), where the quantity 0 is the value and the quantities
+/// 1 to 3 are the reference derivatives; only the quantities selected by the
+/// @a types given to Setup() are read or written.
+class NURBSPatchAssembly
+{
+public:
+   enum Types { VALUES = 1, GRADIENTS = 2 };
+
+   /// QFunction(patch, q0, nq, in, out) for the points q0, ..., q0 + nq - 1.
+   using QFunction = std::function<void(int, int, int, const real_t*,
+                                        real_t*)>;
+
+   NURBSPatchAssembly() = default;
+
+   /// Set the space, the patch rules, and the quantities used by the form.
+   void Setup(const FiniteElementSpace &fes, NURBSMeshRules &rules,
+              int types);
+
+   /// Basis data of the patch @a patch, computed when first needed.
+   const PatchBasisInfo &GetBasis(int patch);
+
+   /// Reduced rules of the patch @a patch, computed when first needed.
+   const PatchReducedRules &GetReducedRules(int patch);
+
+   NURBSMeshRules &GetRules() const { return *rules; }
+
+   int GetNPatches() const { return static_cast<int>(basis.size()); }
+
+   /// Compute y += A x, with global vectors @a x and @a y.
+   void AddMult(const QFunction &qf, const Vector &x, Vector &y) const;
+
+   /// Add the diagonal of A to the global vector @a diag.
+   void AssembleDiagonal(const QFunction &qf, Vector &diag) const;
+
+   /** @brief Assemble the matrix of the patch @a patch row by row, using only
+       the points in the support of the basis function of each row. With
+       @a reduced, the reduced rules are used and the QFunction must not
+       include the quadrature weights. If @a coupled is false, the vector
+       components are not coupled and only the diagonal blocks are stored. */
+   SparseMatrix *AssemblePatchMatrix(int patch, const QFunction &qf,
+                                     bool coupled, bool reduced);
+
+private:
+   const FiniteElementSpace *fes = nullptr;
+   NURBSMeshRules *rules = nullptr;
+   int types = 0;
+   std::vector<std::unique_ptr<PatchBasisInfo>> basis;
+   std::vector<std::unique_ptr<PatchReducedRules>> reduced_rules;
+};
+
+/// @brief Weights and Jacobians, with layout (nq, 3, 3), at the points of the
+/// rule of the patch @a patch, as in DiffusionIntegrator.
+void GetPatchGeometry(Mesh &mesh, int patch, NURBSMeshRules &rules,
+                      const PatchBasisInfo &pb, bool unit_weights,
+                      Vector &weights, Vector &jac);
+
+/// @brief Values of the coefficient @a Q at the points of the rule of the
+/// patch @a patch. A single value is computed if @a Q is null (the value 1)
+/// or constant.
+void GetPatchCoefficient(Coefficient *Q, Mesh &mesh, int patch,
+                         NURBSMeshRules &rules, const PatchBasisInfo &pb,
+                         Vector &coeff);
+
+} // namespace internal
+
+} // namespace mfem
+/// \endcond DO_NOT_DOCUMENT
+
+#endif
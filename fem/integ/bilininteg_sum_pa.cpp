@@ -0,0 +1,620 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../bilininteg.hpp"
+#include "../gridfunc.hpp"
+#include "../qfunction.hpp"
+
+namespace mfem
+{
+
+// The fused quadrature data has NC = has_mass + dim*has_conv + sdim*has_diff
+// components at each quadrature point, where sdim = dim*(dim+1)/2:
+// - mass:       W c det(J)
+// - convection: W alpha adj(J) v
+// - diffusion:  W c adj(J) adj(J)^T / det(J), upper triangle by rows
+enum class SumTerm { Mass, Convection, Diffusion };
+
+// Adds the contribution of one integrator to the fused quadrature data D,
+// starting at component offset.
+static void PASumSetup(const int dim,
+                       const int NQ,
+                       const int NE,
+                       const int NC,
+                       const int offset,
+                       const SumTerm term,
+                       const Array<real_t> &w,
+                       const Vector &j,
+                       const Vector &c,
+                       const real_t alpha,
+                       Vector &d)
+{
+   const int vdim = (term == SumTerm::Convection) ? dim : 1;
+   const bool const_c = c.Size() == vdim;
+   const auto W = w.Read();
+   const auto J = Reshape(j.Read(), NQ, dim, dim, NE);
+   const auto C = const_c ? Reshape(c.Read(), vdim, 1, 1) :
+                  Reshape(c.Read(), vdim, NQ, NE);
+   auto D = Reshape(d.ReadWrite(), NQ, NC, NE);
+   mfem::forall(NE*NQ, [=] MFEM_HOST_DEVICE (int q_global)
+   {
+      const int e = q_global / NQ;
+      const int q = q_global % NQ;
+      const int qc = const_c ? 0 : q, ec = const_c ? 0 : e;
+      real_t A[3][3]; // adj(J)
+      real_t detJ;
+      if (dim == 2)
+      {
+         const real_t J11 = J(q,0,0,e), J12 = J(q,0,1,e);
+         const real_t J21 = J(q,1,0,e), J22 = J(q,1,1,e);
+         A[0][0] =  J22; A[0][1] = -J12;
+         A[1][0] = -J21; A[1][1] =  J11;
+         detJ = (J11 * J22) - (J21 * J12);
+      }
+      else
+      {
+         const real_t J11 = J(q,0,0,e), J12 = J(q,0,1,e), J13 = J(q,0,2,e);
+         const real_t J21 = J(q,1,0,e), J22 = J(q,1,1,e), J23 = J(q,1,2,e);
+         const real_t J31 = J(q,2,0,e), J32 = J(q,2,1,e), J33 = J(q,2,2,e);
+         A[0][0] = (J22 * J33) - (J23 * J32);
+         A[0][1] = (J32 * J13) - (J12 * J33);
+         A[0][2] = (J12 * J23) - (J22 * J13);
+         A[1][0] = (J31 * J23) - (J21 * J33);
+         A[1][1] = (J11 * J33) - (J13 * J31);
+         A[1][2] = (J21 * J13) - (J11 * J23);
+         A[2][0] = (J21 * J32) - (J31 * J22);
+         A[2][1] = (J31 * J12) - (J11 * J32);
+         A[2][2] = (J11 * J22) - (J12 * J21);
+         detJ = (J11 * A[0][0]) + (J12 * A[1][0]) + (J13 * A[2][0]);
+      }
+      switch (term)
+      {
+         case SumTerm::Mass:
+            D(q,offset,e) += W[q] * C(0,qc,ec) * detJ;
+            break;
+         case SumTerm::Convection:
+            for (int k = 0; k < dim; ++k)
+            {
+               real_t val = 0.0;
+               for (int l = 0; l < dim; ++l) { val += A[k][l] * C(l,qc,ec); }
+               D(q,offset+k,e) += alpha * W[q] * val;
+            }
+            break;
+         case SumTerm::Diffusion:
+         {
+            const real_t wd = W[q] * C(0,qc,ec) / detJ;
+            for (int k = 0, idx = 0; k < dim; ++k)
+            {
+               for (int l = k; l < dim; ++l, ++idx)
+               {
+                  real_t val = 0.0;
+                  for (int m = 0; m < dim; ++m) { val += A[k][m] * A[l][m]; }
+                  D(q,offset+idx,e) += wd * val;
+               }
+            }
+            break;
+         }
+      }
+   });
+}
+
+// PA Sum Apply 2D kernel: interpolates the value and the reference gradient at
+// the quadrature points, applies all the terms of the fused quadrature data,
+// and integrates against the test function values and gradients.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PASumApply2D(const int NE,
+                         const bool has_mass,
+                         const bool has_conv,
+                         const bool has_diff,
+                         const Array<real_t> &b_,
+                         const Array<real_t> &g_,
+                         const Vector &d_,
+                         const Vector &x_,
+                         Vector &y_,
+                         const int d1d = 0,
+                         const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const int NC = has_mass + 2*has_conv + 3*has_diff;
+   const int OC = has_mass, OD = OC + 2*has_conv;
+   const auto B = Reshape(b_.Read(), Q1D, D1D);
+   const auto G = Reshape(g_.Read(), Q1D, D1D);
+   const auto D = Reshape(d_.Read(), Q1D*Q1D, NC, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      // Value and reference gradient at the quadrature points
+      real_t u[max_Q1D][max_Q1D][3];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int k = 0; k < 3; ++k) { u[qy][qx][k] = 0.0; }
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         real_t uX[max_Q1D][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            uX[qx][0] = 0.0;
+            uX[qx][1] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            const real_t s = X(dx,dy,e);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               uX[qx][0] += s * B(qx,dx);
+               uX[qx][1] += s * G(qx,dx);
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const real_t wy  = B(qy,dy);
+            const real_t wDy = G(qy,dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               u[qy][qx][0] += uX[qx][0] * wy;
+               u[qy][qx][1] += uX[qx][1] * wy;
+               u[qy][qx][2] += uX[qx][0] * wDy;
+            }
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const int q = qx + qy * Q1D;
+            const real_t v = u[qy][qx][0];
+            const real_t gX = u[qy][qx][1];
+            const real_t gY = u[qy][qx][2];
+            real_t r0 = 0.0, r1 = 0.0, r2 = 0.0;
+            if (has_mass) { r0 += D(q,0,e) * v; }
+            if (has_conv) { r0 += D(q,OC,e) * gX + D(q,OC+1,e) * gY; }
+            if (has_diff)
+            {
+               const real_t O11 = D(q,OD,e);
+               const real_t O12 = D(q,OD+1,e);
+               const real_t O22 = D(q,OD+2,e);
+               r1 = (O11 * gX) + (O12 * gY);
+               r2 = (O12 * gX) + (O22 * gY);
+            }
+            u[qy][qx][0] = r0;
+            u[qy][qx][1] = r1;
+            u[qy][qx][2] = r2;
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         real_t yX[max_D1D][2];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            yX[dx][0] = 0.0;
+            yX[dx][1] = 0.0;
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const real_t r0 = u[qy][qx][0];
+            const real_t r1 = u[qy][qx][1];
+            const real_t r2 = u[qy][qx][2];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const real_t wx  = B(qx,dx);
+               const real_t wDx = G(qx,dx);
+               yX[dx][0] += (r0 * wx) + (r1 * wDx);
+               yX[dx][1] += r2 * wx;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            const real_t wy  = B(qy,dy);
+            const real_t wDy = G(qy,dy);
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               Y(dx,dy,e) += (yX[dx][0] * wy) + (yX[dx][1] * wDy);
+            }
+         }
+      }
+   });
+}
+
+// PA Sum Apply 3D kernel, see PASumApply2D.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PASumApply3D(const int NE,
+                         const bool has_mass,
+                         const bool has_conv,
+                         const bool has_diff,
+                         const Array<real_t> &b_,
+                         const Array<real_t> &g_,
+                         const Vector &d_,
+                         const Vector &x_,
+                         Vector &y_,
+                         const int d1d = 0,
+                         const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const int NC = has_mass + 3*has_conv + 6*has_diff;
+   const int OC = has_mass, OD = OC + 3*has_conv;
+   const auto B = Reshape(b_.Read(), Q1D, D1D);
+   const auto G = Reshape(g_.Read(), Q1D, D1D);
+   const auto D = Reshape(d_.Read(), Q1D*Q1D*Q1D, NC, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      // Value and reference gradient at the quadrature points
+      real_t u[max_Q1D][max_Q1D][max_Q1D][4];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int k = 0; k < 4; ++k) { u[qz][qy][qx][k] = 0.0; }
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         real_t uXY[max_Q1D][max_Q1D][3];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int k = 0; k < 3; ++k) { uXY[qy][qx][k] = 0.0; }
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            real_t uX[max_Q1D][2];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               uX[qx][0] = 0.0;
+               uX[qx][1] = 0.0;
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const real_t s = X(dx,dy,dz,e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  uX[qx][0] += s * B(qx,dx);
+                  uX[qx][1] += s * G(qx,dx);
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const real_t wy  = B(qy,dy);
+               const real_t wDy = G(qy,dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  uXY[qy][qx][0] += uX[qx][0] * wy;
+                  uXY[qy][qx][1] += uX[qx][1] * wy;
+                  uXY[qy][qx][2] += uX[qx][0] * wDy;
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            const real_t wz  = B(qz,dz);
+            const real_t wDz = G(qz,dz);
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  u[qz][qy][qx][0] += uXY[qy][qx][0] * wz;
+                  u[qz][qy][qx][1] += uXY[qy][qx][1] * wz;
+                  u[qz][qy][qx][2] += uXY[qy][qx][2] * wz;
+                  u[qz][qy][qx][3] += uXY[qy][qx][0] * wDz;
+               }
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const int q = qx + (qy + qz * Q1D) * Q1D;
+               const real_t v = u[qz][qy][qx][0];
+               const real_t gX = u[qz][qy][qx][1];
+               const real_t gY = u[qz][qy][qx][2];
+               const real_t gZ = u[qz][qy][qx][3];
+               real_t r0 = 0.0, r1 = 0.0, r2 = 0.0, r3 = 0.0;
+               if (has_mass) { r0 += D(q,0,e) * v; }
+               if (has_conv)
+               {
+                  r0 += D(q,OC,e) * gX + D(q,OC+1,e) * gY + D(q,OC+2,e) * gZ;
+               }
+               if (has_diff)
+               {
+                  const real_t O11 = D(q,OD,e);
+                  const real_t O12 = D(q,OD+1,e);
+                  const real_t O13 = D(q,OD+2,e);
+                  const real_t O22 = D(q,OD+3,e);
+                  const real_t O23 = D(q,OD+4,e);
+                  const real_t O33 = D(q,OD+5,e);
+                  r1 = (O11 * gX) + (O12 * gY) + (O13 * gZ);
+                  r2 = (O12 * gX) + (O22 * gY) + (O23 * gZ);
+                  r3 = (O13 * gX) + (O23 * gY) + (O33 * gZ);
+               }
+               u[qz][qy][qx][0] = r0;
+               u[qz][qy][qx][1] = r1;
+               u[qz][qy][qx][2] = r2;
+               u[qz][qy][qx][3] = r3;
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         real_t yXY[max_D1D][max_D1D][2];
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               yXY[dy][dx][0] = 0.0;
+               yXY[dy][dx][1] = 0.0;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            real_t yX[max_D1D][3];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               for (int k = 0; k < 3; ++k) { yX[dx][k] = 0.0; }
+            }
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const real_t r0 = u[qz][qy][qx][0];
+               const real_t r1 = u[qz][qy][qx][1];
+               const real_t r2 = u[qz][qy][qx][2];
+               const real_t r3 = u[qz][qy][qx][3];
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const real_t wx  = B(qx,dx);
+                  const real_t wDx = G(qx,dx);
+                  yX[dx][0] += (r0 * wx) + (r1 * wDx);
+                  yX[dx][1] += r2 * wx;
+                  yX[dx][2] += r3 * wx;
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               const real_t wy  = B(qy,dy);
+               const real_t wDy = G(qy,dy);
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  yXY[dy][dx][0] += (yX[dx][0] * wy) + (yX[dx][1] * wDy);
+                  yXY[dy][dx][1] += yX[dx][2] * wy;
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            const real_t wz  = B(qz,dz);
+            const real_t wDz = G(qz,dz);
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  Y(dx,dy,dz,e) += (yXY[dy][dx][0] * wz) +
+                                   (yXY[dy][dx][1] * wDz);
+               }
+            }
+         }
+      }
+   });
+}
+
+bool SumIntegrator::AssembleFusedPA(const FiniteElementSpace &fes)
+{
+   if (DeviceCanUseCeed() || integrators.Size() < 2) { return false; }
+
+   Mesh *mesh = fes.GetMesh();
+   dim = mesh->Dimension();
+   if ((dim != 2 && dim != 3) || mesh->SpaceDimension() != dim ||
+       mesh->GetNumGeometries(dim) > 1 || fes.GetVDim() != 1 ||
+       fes.IsVariableOrder() || !UsesTensorBasis(fes)) { return false; }
+   const FiniteElement &el = *fes.GetTypicalFE();
+   if (el.GetMapType() != FiniteElement::VALUE) { return false; }
+
+   // All integrators must be supported and use the same integration rule
+   const IntegrationRule *ir = integrators[0]->GetIntRule();
+   if (ir == nullptr) { return false; }
+   has_mass = has_conv = has_diff = false;
+   for (BilinearFormIntegrator *integ : integrators)
+   {
+      if (integ->GetIntRule() != ir) { return false; }
+      if (dynamic_cast<MassIntegrator*>(integ)) { has_mass = true; }
+      else if (dynamic_cast<ConvectionIntegrator*>(integ)) { has_conv = true; }
+      else if (auto *diff = dynamic_cast<DiffusionIntegrator*>(integ))
+      {
+         if (diff->VQ || diff->MQ) { return false; }
+         has_diff = true;
+      }
+      else { return false; }
+   }
+
+   const MemoryType mt = (pa_mt == MemoryType::DEFAULT) ?
+                         Device::GetDeviceMemoryType() : pa_mt;
+   fespace = &fes;
+   ne = fes.GetNE();
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+   const int nq = ir->GetNPoints();
+   const int nc = has_mass + dim*has_conv + ((dim*(dim+1))/2)*has_diff;
+   const int conv_offset = has_mass;
+   const int diff_offset = conv_offset + dim*has_conv;
+   pa_data.SetSize(nc * nq * ne, mt);
+   pa_data.UseDevice(true);
+   pa_data = 0.0;
+   if (ne == 0) { return true; }
+
+   // The Jacobians are shared with the other PA integrators through the mesh
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS, mt);
+   QuadratureSpace qs(*mesh, *ir);
+   for (BilinearFormIntegrator *integ : integrators)
+   {
+      CoefficientVector coeff(qs, CoefficientStorage::COMPRESSED);
+      if (auto *mass = dynamic_cast<MassIntegrator*>(integ))
+      {
+         if (mass->Q) { coeff.Project(*mass->Q); }
+         else { coeff.SetConstant(1.0); }
+         PASumSetup(dim, nq, ne, nc, 0, SumTerm::Mass, ir->GetWeights(),
+                    geom->J, coeff, 1.0, pa_data);
+      }
+      else if (auto *conv = dynamic_cast<ConvectionIntegrator*>(integ))
+      {
+         coeff.Project(*conv->Q);
+         PASumSetup(dim, nq, ne, nc, conv_offset, SumTerm::Convection,
+                    ir->GetWeights(), geom->J, coeff, conv->alpha, pa_data);
+      }
+      else if (auto *diff = dynamic_cast<DiffusionIntegrator*>(integ))
+      {
+         if (diff->Q) { coeff.Project(*diff->Q); }
+         else { coeff.SetConstant(1.0); }
+         PASumSetup(dim, nq, ne, nc, diff_offset, SumTerm::Diffusion,
+                    ir->GetWeights(), geom->J, coeff, 1.0, pa_data);
+      }
+   }
+   return true;
+}
+
+void SumIntegrator::EnsureIntegratorsPA() const
+{
+   if (integrators_pa) { return; }
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      integrators[i]->AssemblePA(*fespace);
+   }
+   integrators_pa = true;
+}
+
+void SumIntegrator::AssemblePA(const FiniteElementSpace& fes)
+{
+   fespace = &fes;
+   fused = AssembleFusedPA(fes);
+   integrators_pa = false;
+   if (!fused)
+   {
+      pa_data.Destroy();
+      EnsureIntegratorsPA();
+   }
+}
+
+void SumIntegrator::AssembleDiagonalPA(Vector &diag)
+{
+   // The diagonal is computed by the integrators, whose PA data is only
+   // assembled when needed if the integrators are fused.
+   EnsureIntegratorsPA();
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      integrators[i]->AssembleDiagonalPA(diag);
+   }
+}
+
+void SumIntegrator::AddMultPA(const Vector& x, Vector& y) const
+{
+   if (!fused)
+   {
+      for (int i = 0; i < integrators.Size(); i++)
+      {
+         integrators[i]->AddMultPA(x, y);
+      }
+      return;
+   }
+   if (ne == 0) { return; }
+   const Array<real_t> &B = maps->B, &G = maps->G;
+   if (dim == 2)
+   {
+      auto kernel = PASumApply2D<0,0>;
+      switch ((dofs1D << 4 ) | quad1D)
+      {
+         case 0x22: kernel = PASumApply2D<2,2>; break;
+         case 0x23: kernel = PASumApply2D<2,3>; break;
+         case 0x33: kernel = PASumApply2D<3,3>; break;
+         case 0x34: kernel = PASumApply2D<3,4>; break;
+         case 0x44: kernel = PASumApply2D<4,4>; break;
+         case 0x45: kernel = PASumApply2D<4,5>; break;
+         case 0x55: kernel = PASumApply2D<5,5>; break;
+         case 0x56: kernel = PASumApply2D<5,6>; break;
+      }
+      kernel(ne, has_mass, has_conv, has_diff, B, G, pa_data, x, y, dofs1D,
+             quad1D);
+   }
+   else
+   {
+      auto kernel = PASumApply3D<0,0>;
+      switch ((dofs1D << 4 ) | quad1D)
+      {
+         case 0x22: kernel = PASumApply3D<2,2>; break;
+         case 0x23: kernel = PASumApply3D<2,3>; break;
+         case 0x33: kernel = PASumApply3D<3,3>; break;
+         case 0x34: kernel = PASumApply3D<3,4>; break;
+         case 0x44: kernel = PASumApply3D<4,4>; break;
+         case 0x45: kernel = PASumApply3D<4,5>; break;
+         case 0x55: kernel = PASumApply3D<5,5>; break;
+         case 0x56: kernel = PASumApply3D<5,6>; break;
+      }
+      kernel(ne, has_mass, has_conv, has_diff, B, G, pa_data, x, y, dofs1D,
+             quad1D);
+   }
+}
+
+void SumIntegrator::AddAbsMultPA(const Vector& x, Vector& y) const
+{
+   EnsureIntegratorsPA();
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      integrators[i]->AddAbsMultPA(x, y);
+   }
+}
+
+void SumIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
+{
+   EnsureIntegratorsPA();
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      integrators[i]->AddMultTransposePA(x, y);
+   }
+}
+
+void SumIntegrator::AddAbsMultTransposePA(const Vector &x, Vector &y) const
+{
+   EnsureIntegratorsPA();
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      integrators[i]->AddAbsMultTransposePA(x, y);
+   }
+}
+
+} // namespace mfem
@@ -327,6 +327,7 @@ void VectorDiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
 
 template<int T_D1D = 0, int T_Q1D = 0>
 static void PAVectorDiffusionDiagonal2D(const int NE,
+                                        const bool vector_coeff,
                                         const Array<real_t> &b,
                                         const Array<real_t> &g,
                                         const Vector &d,
@@ -357,39 +358,44 @@ static void PAVectorDiffusionDiagonal2D(const int NE,
       real_t QD0[MQ1][MD1];
       real_t QD1[MQ1][MD1];
       real_t QD2[MQ1][MD1];
-      for (int qx = 0; qx < Q1D; ++qx)
+      // With a vector coefficient, each component has its own quadrature data
+      for (int c = 0; c < (vector_coeff ? 2 : 1); ++c)
       {
-         for (int dy = 0; dy < D1D; ++dy)
+         for (int qx = 0; qx < Q1D; ++qx)
          {
-            QD0[qx][dy] = 0.0;
-            QD1[qx][dy] = 0.0;
-            QD2[qx][dy] = 0.0;
-            for (int qy = 0; qy < Q1D; ++qy)
+            for (int dy = 0; dy < D1D; ++dy)
             {
-               const int q = qx + qy * Q1D;
-               const real_t D0 = D(q,0,0,e);
-               const real_t D1 = D(q,1,0,e);
-               const real_t D2 = D(q,3/*2*/,0,e); // size from 3 (symmetric) to 4 (dims x dims)
-               QD0[qx][dy] += B(qy, dy) * B(qy, dy) * D0;
-               QD1[qx][dy] += B(qy, dy) * G(qy, dy) * D1;
-               QD2[qx][dy] += G(qy, dy) * G(qy, dy) * D2;
+               QD0[qx][dy] = 0.0;
+               QD1[qx][dy] = 0.0;
+               QD2[qx][dy] = 0.0;
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  const int q = qx + qy * Q1D;
+                  const real_t D0 = D(q,0,c,e);
+                  const real_t D1 = D(q,1,c,e);
+                  const real_t D2 = D(q,3/*2*/,c,e); // size from 3 (symmetric) to 4 (dims x dims)
+                  QD0[qx][dy] += B(qy, dy) * B(qy, dy) * D0;
+                  QD1[qx][dy] += B(qy, dy) * G(qy, dy) * D1;
+                  QD2[qx][dy] += G(qy, dy) * G(qy, dy) * D2;
+               }
             }
          }
-      }
-      for (int dy = 0; dy < D1D; ++dy)
-      {
-         for (int dx = 0; dx < D1D; ++dx)
+         for (int dy = 0; dy < D1D; ++dy)
          {
-            real_t temp = 0.0;
-            for (int qx = 0; qx < Q1D; ++qx)
+            for (int dx = 0; dx < D1D; ++dx)
             {
-               temp += G(qx, dx) * G(qx, dx) * QD0[qx][dy];
-               temp += G(qx, dx) * B(qx, dx) * QD1[qx][dy];
-               temp += B(qx, dx) * G(qx, dx) * QD1[qx][dy];
-               temp += B(qx, dx) * B(qx, dx) * QD2[qx][dy];
+               real_t temp = 0.0;
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  temp += G(qx, dx) * G(qx, dx) * QD0[qx][dy];
+                  temp += G(qx, dx) * B(qx, dx) * QD1[qx][dy];
+                  temp += B(qx, dx) * G(qx, dx) * QD1[qx][dy];
+                  temp += B(qx, dx) * B(qx, dx) * QD2[qx][dy];
+               }
+               if (vector_coeff) { Y(dx,dy,c,e) += temp; continue; }
+               Y(dx,dy,0,e) += temp;
+               Y(dx,dy,1,e) += temp;
             }
-            Y(dx,dy,0,e) += temp;
-            Y(dx,dy,1,e) += temp;
          }
       }
    });
@@ -397,6 +403,7 @@ static void PAVectorDiffusionDiagonal2D(const int NE,
 
 template<int T_D1D = 0, int T_Q1D = 0>
 static void PAVectorDiffusionDiagonal3D(const int NE,
+                                        const bool vector_coeff,
                                         const Array<real_t> &b,
                                         const Array<real_t> &g,
                                         const Vector &d,
@@ -424,8 +431,11 @@ static void PAVectorDiffusionDiagonal3D(const int NE,
       constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
       real_t QQD[MQ1][MQ1][MD1];
       real_t QDD[MQ1][MD1][MD1];
-      for (int i = 0; i < DIM; ++i)
+      // With a vector coefficient, each component has its own quadrature data
+      const int NC = vector_coeff ? DIM : 1;
+      for (int ci = 0; ci < NC * DIM; ++ci)
       {
+         const int c = ci / DIM, i = ci % DIM;
          for (int j = 0; j < DIM; ++j)
          {
             // first tensor contraction, along z direction
@@ -443,7 +453,7 @@ static void PAVectorDiffusionDiagonal3D(const int NE,
                                       3 - (3-i)*(2-i)/2 + j:
                                       3 - (3-j)*(2-j)/2 + i;
                         // using 6 symmetric values
-                        const real_t O = Q(q,k,0,e);
+                        const real_t O = Q(q,k,c,e);
                         const real_t Bz = B(qz,dz);
                         const real_t Gz = G(qz,dz);
                         const real_t L = i==2 ? Gz : Bz;
@@ -488,6 +498,11 @@ static void PAVectorDiffusionDiagonal3D(const int NE,
                         const real_t R = j==0 ? Gx : Bx;
                         temp += L * QDD[qx][dy][dz] * R;
                      }
+                     if (vector_coeff)
+                     {
+                        Y(dx, dy, dz, c, e) += temp;
+                        continue;
+                     }
                      Y(dx, dy, dz, 0, e) += temp;
                      Y(dx, dy, dz, 1, e) += temp;
                      Y(dx, dy, dz, 2, e) += temp;
@@ -503,6 +518,7 @@ static void PAVectorDiffusionAssembleDiagonal(const int dim,
                                               const int D1D,
                                               const int Q1D,
                                               const int NE,
+                                              const bool vector_coeff,
                                               const Array<real_t> &B,
                                               const Array<real_t> &G,
                                               const Vector &op,
@@ -510,15 +526,26 @@ static void PAVectorDiffusionAssembleDiagonal(const int dim,
 {
    if (dim == 2)
    {
-      return PAVectorDiffusionDiagonal2D(NE, B, G, op, y, D1D, Q1D);
+      return PAVectorDiffusionDiagonal2D(NE, vector_coeff, B, G, op, y, D1D,
+                                         Q1D);
    }
    else if (dim == 3)
    {
-      return PAVectorDiffusionDiagonal3D(NE, B, G, op, y, D1D, Q1D);
+      return PAVectorDiffusionDiagonal3D(NE, vector_coeff, B, G, op, y, D1D,
+                                         Q1D);
    }
    MFEM_ABORT("Dimension not implemented.");
 }
 
+OperatorCostModel VectorDiffusionIntegrator::GetCostModelPA() const
+{
+   if (DeviceCanUseCeed()) { return BilinearFormIntegrator::GetCostModelPA(); }
+   // With a matrix coefficient, the gradients of all the components are
+   // coupled at each point.
+   const real_t qflops = MQ ? 2.0*dim*dim*vdim : 2.0*dim*dim;
+   return PACostModel(*maps, dim, ne, vdim, dim, dim, qflops, pa_data);
+}
+
 void VectorDiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
 {
    if (DeviceCanUseCeed())
@@ -527,13 +554,37 @@ void VectorDiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
    }
    else
    {
-      MFEM_VERIFY(!VQ && !MQ, "VQ and MQ not supported.");
-      PAVectorDiffusionAssembleDiagonal(dim, dofs1D, quad1D, ne,
+      MFEM_VERIFY(!MQ, "MQ not supported.");
+      PAVectorDiffusionAssembleDiagonal(dim, dofs1D, quad1D, ne, VQ != nullptr,
                                         maps->B, maps->G,
                                         pa_data, diag);
    }
 }
 
+void VectorDiffusionIntegrator::AssembleBlockDiagonalPA(Vector &blocks)
+{
+   MFEM_VERIFY(!DeviceCanUseCeed(),
+               "AssembleBlockDiagonalPA is not supported with libCEED.");
+   MFEM_VERIFY(!MQ, "MQ not supported.");
+   // Without a matrix coefficient the components are not coupled, and the
+   // blocks are diagonal.
+   const int nd = blocks.Size() / (vdim * vdim * ne);
+   Vector diag(nd * vdim * ne);
+   diag.UseDevice(true);
+   diag = 0.0;
+   AssembleDiagonalPA(diag);
+   const int VDIM = vdim;
+   const auto X = Reshape(diag.Read(), nd, VDIM, ne);
+   auto Y = Reshape(blocks.ReadWrite(), nd, VDIM, VDIM, ne);
+   mfem::forall(nd * VDIM * ne, [=] MFEM_HOST_DEVICE(int idx)
+   {
+      const int i = idx % nd;
+      const int v = (idx / nd) % VDIM;
+      const int e = idx / (nd * VDIM);
+      Y(i, v, v, e) += X(i, v, e);
+   });
+}
+
 /*
 // PA Diffusion Apply kernel
 void VectorDiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
@@ -0,0 +1,165 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../fem.hpp"
+#include "../../mesh/nurbs.hpp"
+
+namespace mfem
+{
+
+// The quadrature data of a point has the layout (6, ncoeff), with the symmetric
+// matrix w adj(J) adj(J)^T / det(J) times the coefficient of each component,
+// where ncoeff is vdim for a VectorCoefficient and 1 otherwise.
+void VectorDiffusionIntegrator::SetupPatchQData(const int patch,
+                                                bool unitWeights,
+                                                Vector &qdata)
+{
+   MFEM_VERIFY(MQ == nullptr, "MatrixCoefficient is not supported on NURBS "
+               "patches");
+   Mesh &mesh = *fespace->GetMesh();
+   const internal::PatchBasisInfo &pb = patch_assembly.GetBasis(patch);
+   const int nq = pb.NumPoints();
+   const int vd = fespace->GetVDim();
+   const int ncoeff = VQ ? vd : 1;
+
+   Vector weights, jac, coeff;
+   internal::GetPatchGeometry(mesh, patch, *patchRules, pb, unitWeights,
+                              weights, jac);
+   if (VQ)
+   {
+      MFEM_VERIFY(VQ->GetVDim() == vd, "Unexpected dimension for "
+                  "VectorCoefficient");
+      const Array<int> &Q1D = pb.Q1D;
+      coeff.SetSize(nq*vd);
+      Vector vq(vd);
+      IntegrationPoint ip;
+      for (int qz=0; qz<Q1D[2]; ++qz)
+      {
+         for (int qy=0; qy<Q1D[1]; ++qy)
+         {
+            for (int qx=0; qx<Q1D[0]; ++qx)
+            {
+               const int p = qx + (qy * Q1D[0]) + (qz * Q1D[0] * Q1D[1]);
+               const int e = patchRules->GetPointElement(patch, qx, qy, qz);
+               ElementTransformation *tr = mesh.GetElementTransformation(e);
+               pb.GetElementPoint(qx, qy, qz, ip);
+               VQ->Eval(vq, *tr, ip);
+               for (int c = 0; c < vd; c++) { coeff[p + nq*c] = vq[c]; }
+            }
+         }
+      }
+   }
+   else
+   {
+      internal::GetPatchCoefficient(Q, mesh, patch, *patchRules, pb, coeff);
+   }
+   const bool const_coeff = coeff.Size() == 1;
+
+   qdata.SetSize(nq*6*ncoeff);
+   DenseMatrix J(3), A(3);
+   for (int q = 0; q < nq; q++)
+   {
+      for (int i = 0; i < 9; i++) { J.GetData()[i] = jac[q + nq*i]; }
+      CalcAdjugate(J, A);
+      const real_t wdet = weights[q] / J.Det();
+      const real_t M[6] =
+      {
+         wdet * (A(0,0)*A(0,0) + A(0,1)*A(0,1) + A(0,2)*A(0,2)),
+         wdet * (A(0,0)*A(1,0) + A(0,1)*A(1,1) + A(0,2)*A(1,2)),
+         wdet * (A(0,0)*A(2,0) + A(0,1)*A(2,1) + A(0,2)*A(2,2)),
+         wdet * (A(1,0)*A(1,0) + A(1,1)*A(1,1) + A(1,2)*A(1,2)),
+         wdet * (A(1,0)*A(2,0) + A(1,1)*A(2,1) + A(1,2)*A(2,2)),
+         wdet * (A(2,0)*A(2,0) + A(2,1)*A(2,1) + A(2,2)*A(2,2))
+      };
+      for (int c = 0; c < ncoeff; c++)
+      {
+         const real_t cq = const_coeff ? coeff[0] : coeff[q + nq*c];
+         for (int s = 0; s < 6; s++) { qdata[s + 6*(c + ncoeff*q)] = cq*M[s]; }
+      }
+   }
+}
+
+void VectorDiffusionIntegrator::ApplyPatchQFunction(const Vector &qdata,
+                                                    int q0, int nq,
+                                                    const real_t *in,
+                                                    real_t *out) const
+{
+   const int vd = fespace->GetVDim();
+   const int ncoeff = VQ ? vd : 1;
+   const real_t *D = qdata.HostRead() + 6*ncoeff*q0;
+   for (int c = 0; c < vd; c++)
+   {
+      const real_t *u = in + 4*c*nq;
+      real_t *v = out + 4*c*nq;
+      for (int i = 0; i < nq; i++)
+      {
+         const real_t *M = D + 6*((VQ ? c : 0) + ncoeff*i);
+         const real_t g0 = u[i + nq], g1 = u[i + 2*nq], g2 = u[i + 3*nq];
+         v[i + nq]   = M[0]*g0 + M[1]*g1 + M[2]*g2;
+         v[i + 2*nq] = M[1]*g0 + M[3]*g1 + M[4]*g2;
+         v[i + 3*nq] = M[2]*g0 + M[4]*g1 + M[5]*g2;
+      }
+   }
+}
+
+void VectorDiffusionIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
+{
+   fespace = &fes;
+   MFEM_VERIFY(patchRules, "Patch-wise integration requires NURBSMeshRules");
+   patch_assembly.Setup(fes, *patchRules,
+                        internal::NURBSPatchAssembly::GRADIENTS);
+
+   const int np = patch_assembly.GetNPatches();
+   patch_qdata.resize(np);
+   for (int p = 0; p < np; p++)
+   {
+      SetupPatchQData(p, false, patch_qdata[p]);
+   }
+}
+
+void VectorDiffusionIntegrator::AddMultNURBSPA(const Vector &x,
+                                               Vector &y) const
+{
+   patch_assembly.AddMult([this](int p, int q0, int nq, const real_t *in,
+                                 real_t *out)
+   {
+      ApplyPatchQFunction(patch_qdata[p], q0, nq, in, out);
+   }, x, y);
+}
+
+void VectorDiffusionIntegrator::AssembleDiagonalNURBSPA(Vector &diag)
+{
+   patch_assembly.AssembleDiagonal([this](int p, int q0, int nq,
+                                          const real_t *in, real_t *out)
+   {
+      ApplyPatchQFunction(patch_qdata[p], q0, nq, in, out);
+   }, diag);
+}
+
+void VectorDiffusionIntegrator::AssemblePatchMatrix(
+   const int patch, const FiniteElementSpace &fes, SparseMatrix*& smat)
+{
+   fespace = &fes;
+   MFEM_VERIFY(patchRules, "Patch-wise integration requires NURBSMeshRules");
+   patch_assembly.Setup(fes, *patchRules,
+                        internal::NURBSPatchAssembly::GRADIENTS);
+
+   const bool reduced = integrationMode == Mode::PATCHWISE_REDUCED;
+   Vector qdata;
+   SetupPatchQData(patch, reduced, qdata);
+   smat = patch_assembly.AssemblePatchMatrix(
+             patch, [&](int, int q0, int nq, const real_t *in, real_t *out)
+   {
+      ApplyPatchQFunction(qdata, q0, nq, in, out);
+   }, false, reduced);
+}
+
+} // namespace mfem
@@ -347,15 +347,138 @@ static void PAVectorMassAssembleDiagonal(const int dim, const int D1D,
    MFEM_ABORT("Dimension not implemented.");
 }
 
+// Adds the vdim x vdim blocks coupling the components of each dof to blocks,
+// for scalar, vector and matrix coefficients.
+static void PAVectorMassAssembleBlockDiagonal(const int dim, const int D1D,
+                                              const int Q1D, const int NE,
+                                              const int coeff_vdim,
+                                              const Array<real_t> &b,
+                                              const Vector &pa_data,
+                                              Vector &blocks)
+{
+   MFEM_VERIFY(dim == 2 || dim == 3, "Dimension not implemented.");
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const int VDIM = dim;
+   const bool const_coeff = coeff_vdim == 1;
+   const bool vector_coeff = coeff_vdim == VDIM;
+   const int ND = (dim == 2) ? D1D*D1D : D1D*D1D*D1D;
+   const int NQ = (dim == 2) ? Q1D*Q1D : Q1D*Q1D*Q1D;
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto D = Reshape(pa_data.Read(), NQ, coeff_vdim, NE);
+   auto Y = Reshape(blocks.ReadWrite(), ND, VDIM, VDIM, NE);
+
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE(int e)
+   {
+      constexpr int max_D1D = DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = DofQuadLimits::MAX_Q1D;
+      real_t temp[max_Q1D][max_Q1D][max_D1D];
+      real_t temp2[max_Q1D][max_D1D][max_D1D];
+      const int Q1Dz = (dim == 2) ? 1 : Q1D;
+      const int D1Dz = (dim == 2) ? 1 : D1D;
+      for (int k = 0; k < coeff_vdim; ++k)
+      {
+         // Entry (r,c) of the blocks of a matrix coefficient, a single
+         // diagonal entry for a vector coefficient
+         const int r = const_coeff ? 0 : (vector_coeff ? k : k / VDIM);
+         const int c = const_coeff ? 0 : (vector_coeff ? k : k % VDIM);
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int dz = 0; dz < D1Dz; ++dz)
+               {
+                  temp[qx][qy][dz] = 0.0;
+                  for (int qz = 0; qz < Q1Dz; ++qz)
+                  {
+                     const real_t Bz = (dim == 2) ? 1.0 : B(qz, dz);
+                     const int q = qx + (qy + qz * Q1D) * Q1D;
+                     temp[qx][qy][dz] += Bz * Bz * D(q, k, e);
+                  }
+               }
+            }
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int dz = 0; dz < D1Dz; ++dz)
+            {
+               for (int dy = 0; dy < D1D; ++dy)
+               {
+                  temp2[qx][dy][dz] = 0.0;
+                  for (int qy = 0; qy < Q1D; ++qy)
+                  {
+                     temp2[qx][dy][dz] +=
+                        B(qy, dy) * B(qy, dy) * temp[qx][qy][dz];
+                  }
+               }
+            }
+         }
+         for (int dz = 0; dz < D1Dz; ++dz)
+         {
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  real_t temp3 = 0.0;
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     temp3 += B(qx, dx) * B(qx, dx) * temp2[qx][dy][dz];
+                  }
+                  const int i = dx + (dy + dz * D1D) * D1D;
+                  if (const_coeff)
+                  {
+                     for (int v = 0; v < VDIM; ++v) { Y(i, v, v, e) += temp3; }
+                  }
+                  else { Y(i, r, c, e) += temp3; }
+               }
+            }
+         }
+      }
+   });
+}
+
+OperatorCostModel VectorMassIntegrator::GetCostModelPA() const
+{
+   if (DeviceCanUseCeed()) { return BilinearFormIntegrator::GetCostModelPA(); }
+   // A matrix coefficient couples the components at each point.
+   const real_t qflops = (coeff_vdim == vdim*vdim) ? 2.0*vdim : 1.0;
+   return PACostModel(*maps, dim, ne, vdim, 1, 1, qflops, pa_data);
+}
+
 void VectorMassIntegrator::AssembleDiagonalPA(Vector &diag)
 {
    if (DeviceCanUseCeed()) { ceedOp->GetDiagonal(diag); }
-   else
+   else if (coeff_vdim == 1)
    {
-      MFEM_VERIFY(coeff_vdim == 1, "coeff_vdim != 1");
-      MFEM_VERIFY(!VQ && !MQ, "VQ and MQ not supported");
       PAVectorMassAssembleDiagonal(dim, dofs1D, quad1D, ne, maps->B, pa_data, diag);
    }
+   else
+   {
+      // Extract the diagonal from the blocks coupling the components
+      const int nd = diag.Size() / (vdim * ne);
+      Vector blocks(nd * vdim * vdim * ne);
+      blocks.UseDevice(true);
+      blocks = 0.0;
+      AssembleBlockDiagonalPA(blocks);
+      const int VDIM = vdim;
+      const auto X = Reshape(blocks.Read(), nd, VDIM, VDIM, ne);
+      auto Y = Reshape(diag.Write(), nd, VDIM, ne);
+      mfem::forall(nd * VDIM * ne, [=] MFEM_HOST_DEVICE(int idx)
+      {
+         const int i = idx % nd;
+         const int v = (idx / nd) % VDIM;
+         const int e = idx / (nd * VDIM);
+         Y(i, v, e) = X(i, v, v, e);
+      });
+   }
+}
+
+void VectorMassIntegrator::AssembleBlockDiagonalPA(Vector &blocks)
+{
+   MFEM_VERIFY(!DeviceCanUseCeed(),
+               "AssembleBlockDiagonalPA is not supported with libCEED.");
+   PAVectorMassAssembleBlockDiagonal(dim, dofs1D, quad1D, ne, coeff_vdim,
+                                     maps->B, pa_data, blocks);
 }
 
 } // namespace mfem
@@ -0,0 +1,724 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../../linalg/kernels.hpp"
+#include "../hyperbolic.hpp"
+#include "../quadinterpolator.hpp"
+#include "../ceed/interface/util.hpp"
+
+namespace mfem
+{
+
+// Device versions of the flux functions. The formulas are the same as in
+// BurgersFlux, ShallowWaterFlux and EulerFlux. The flux F(u) with shape
+// (NEQ, DIM) is stored column-major, F[c + NEQ*d].
+
+template <int D>
+struct BurgersFluxKernel
+{
+   static constexpr int DIM = D;
+   static constexpr int NEQ = 1;
+
+   MFEM_HOST_DEVICE real_t Flux(const real_t *u, real_t *F) const
+   {
+      for (int d = 0; d < DIM; d++) { F[d] = u[0] * u[0] * 0.5; }
+      return fabs(u[0]);
+   }
+
+   MFEM_HOST_DEVICE real_t FluxDotN(const real_t *u, const real_t *n,
+                                    real_t *Fn) const
+   {
+      real_t nsum = 0.0;
+      for (int d = 0; d < DIM; d++) { nsum += n[d]; }
+      Fn[0] = u[0] * u[0] * 0.5 * nsum;
+      return fabs(u[0]);
+   }
+};
+
+template <int D>
+struct ShallowWaterFluxKernel
+{
+   static constexpr int DIM = D;
+   static constexpr int NEQ = D + 1;
+   real_t g;
+
+   MFEM_HOST_DEVICE real_t Flux(const real_t *u, real_t *F) const
+   {
+      const real_t height = u[0];
+      const real_t *h_vel = u + 1;
+      const real_t energy = 0.5 * g * (height * height);
+      real_t h_vel2 = 0.0;
+      for (int d = 0; d < DIM; d++)
+      {
+         F[NEQ*d] = h_vel[d];
+         for (int i = 0; i < DIM; i++)
+         {
+            F[1 + i + NEQ*d] = h_vel[i] * h_vel[d] / height;
+         }
+         F[1 + d + NEQ*d] += energy;
+         h_vel2 += h_vel[d] * h_vel[d];
+      }
+      const real_t sound = sqrt(g * height);
+      const real_t vel = sqrt(h_vel2) / height;
+      return vel + sound;
+   }
+
+   MFEM_HOST_DEVICE real_t FluxDotN(const real_t *u, const real_t *n,
+                                    real_t *Fn) const
+   {
+      const real_t height = u[0];
+      const real_t *h_vel = u + 1;
+      const real_t energy = 0.5 * g * (height * height);
+      real_t hu_n = 0.0, n2 = 0.0;
+      for (int d = 0; d < DIM; d++)
+      {
+         hu_n += h_vel[d] * n[d];
+         n2 += n[d] * n[d];
+      }
+      Fn[0] = hu_n;
+      const real_t normal_vel = hu_n / height;
+      for (int i = 0; i < DIM; i++)
+      {
+         Fn[1 + i] = normal_vel * h_vel[i] + energy * n[i];
+      }
+      const real_t sound = sqrt(g * height);
+      const real_t vel = fabs(normal_vel) / sqrt(n2);
+      return vel + sound;
+   }
+};
+
+template <int D>
+struct EulerFluxKernel
+{
+   static constexpr int DIM = D;
+   static constexpr int NEQ = D + 2;
+   real_t gamma;
+
+   MFEM_HOST_DEVICE real_t Flux(const real_t *u, real_t *F) const
+   {
+      const real_t density = u[0];
+      const real_t *momentum = u + 1;
+      const real_t energy = u[1 + DIM];
+      real_t momentum2 = 0.0;
+      for (int d = 0; d < DIM; d++) { momentum2 += momentum[d] * momentum[d]; }
+      const real_t kinetic_energy = 0.5 * momentum2 / density;
+      const real_t pressure = (gamma - 1.0) * (energy - kinetic_energy);
+      const real_t H = (energy + pressure) / density;
+      for (int d = 0; d < DIM; d++)
+      {
+         F[NEQ*d] = momentum[d];
+         for (int i = 0; i < DIM; i++)
+         {
+            F[1 + i + NEQ*d] = momentum[i] * momentum[d] / density;
+         }
+         F[1 + d + NEQ*d] += pressure;
+         F[1 + DIM + NEQ*d] = momentum[d] * H;
+      }
+      const real_t sound = sqrt(gamma * pressure / density);
+      const real_t speed = sqrt(2.0 * kinetic_energy / density);
+      return speed + sound;
+   }
+
+   MFEM_HOST_DEVICE real_t FluxDotN(const real_t *u, const real_t *n,
+                                    real_t *Fn) const
+   {
+      const real_t density = u[0];
+      const real_t *momentum = u + 1;
+      const real_t energy = u[1 + DIM];
+      real_t momentum2 = 0.0, momentum_n = 0.0, n2 = 0.0;
+      for (int d = 0; d < DIM; d++)
+      {
+         momentum2 += momentum[d] * momentum[d];
+         momentum_n += momentum[d] * n[d];
+         n2 += n[d] * n[d];
+      }
+      const real_t kinetic_energy = 0.5 * momentum2 / density;
+      const real_t pressure = (gamma - 1.0) * (energy - kinetic_energy);
+      Fn[0] = momentum_n;
+      const real_t normal_velocity = momentum_n / density;
+      for (int d = 0; d < DIM; d++)
+      {
+         Fn[1 + d] = normal_velocity * momentum[d] + pressure * n[d];
+      }
+      Fn[1 + DIM] = normal_velocity * (energy + pressure);
+      const real_t sound = sqrt(gamma * pressure / density);
+      const real_t speed = fabs(normal_velocity) / sqrt(n2);
+      return speed + sound;
+   }
+};
+
+// Device versions of RusanovFlux::Eval() and ComponentwiseUpwindFlux::Eval().
+
+struct RusanovFluxKernel
+{
+   template <typename FK>
+   MFEM_HOST_DEVICE real_t Eval(const FK &fk, const real_t *u1,
+                                const real_t *u2, const real_t *nor,
+                                real_t *flux) const
+   {
+      constexpr int NEQ = FK::NEQ;
+      real_t F1[NEQ], F2[NEQ];
+      const real_t speed1 = fk.FluxDotN(u1, nor, F1);
+      const real_t speed2 = fk.FluxDotN(u2, nor, F2);
+      const real_t maxE = fmax(speed1, speed2);
+      real_t n2 = 0.0;
+      for (int d = 0; d < FK::DIM; d++) { n2 += nor[d] * nor[d]; }
+      const real_t scaledMaxE = maxE * sqrt(n2);
+      for (int c = 0; c < NEQ; c++)
+      {
+         flux[c] = 0.5*(scaledMaxE*(u1[c] - u2[c]) + (F1[c] + F2[c]));
+      }
+      return maxE;
+   }
+};
+
+struct ComponentwiseUpwindFluxKernel
+{
+   template <typename FK>
+   MFEM_HOST_DEVICE real_t Eval(const FK &fk, const real_t *u1,
+                                const real_t *u2, const real_t *nor,
+                                real_t *flux) const
+   {
+      constexpr int NEQ = FK::NEQ;
+      real_t F1[NEQ], F2[NEQ];
+      const real_t speed1 = fk.FluxDotN(u1, nor, F1);
+      const real_t speed2 = fk.FluxDotN(u2, nor, F2);
+      for (int c = 0; c < NEQ; c++)
+      {
+         flux[c] = (u1[c] <= u2[c]) ? fmin(F1[c], F2[c]) : fmax(F1[c], F2[c]);
+      }
+      return fmax(speed1, speed2);
+   }
+};
+
+template <int DIM, typename Body>
+static void DispatchFluxKernel(const FluxFunction &flux, Body &&body)
+{
+   if (dynamic_cast<const BurgersFlux*>(&flux))
+   {
+      body(BurgersFluxKernel<DIM> {});
+   }
+   else if (auto sw = dynamic_cast<const ShallowWaterFlux*>(&flux))
+   {
+      body(ShallowWaterFluxKernel<DIM> {sw->GetGravity()});
+   }
+   else if (auto euler = dynamic_cast<const EulerFlux*>(&flux))
+   {
+      body(EulerFluxKernel<DIM> {euler->GetSpecificHeatRatio()});
+   }
+   else
+   {
+      MFEM_ABORT("Partial assembly supports only BurgersFlux, "
+                 "ShallowWaterFlux and EulerFlux.");
+   }
+}
+
+template <typename Body>
+static void DispatchFluxKernel(const int dim, const FluxFunction &flux,
+                               Body &&body)
+{
+   if (dim == 2) { DispatchFluxKernel<2>(flux, body); }
+   else { DispatchFluxKernel<3>(flux, body); }
+}
+
+static void CheckPASpace(const FiniteElementSpace &fes, const int neq)
+{
+   const Mesh *mesh = fes.GetMesh();
+   const int dim = mesh->Dimension();
+   MFEM_VERIFY(!DeviceCanUseCeed(),
+               "HyperbolicFormIntegrator does not support libCEED.");
+   MFEM_VERIFY(dim == 2 || dim == 3, "Only 2D and 3D are supported.");
+   MFEM_VERIFY(mesh->SpaceDimension() == dim,
+               "Surface meshes are not supported.");
+   MFEM_VERIFY(fes.GetVDim() == neq,
+               "The vector dimension of the space must be the number of "
+               "equations.");
+   MFEM_VERIFY(dynamic_cast<const TensorBasisElement*>(fes.GetTypicalFE()),
+               "Only tensor-product elements are supported.");
+}
+
+static void CheckPA1D(const int dim, const int D1D, const int Q1D)
+{
+   const auto &limits = DeviceDofQuadLimits::Get();
+   const int max_d1d = (dim == 2) ? limits.MAX_D1D : limits.MAX_INTERP_1D;
+   const int max_q1d = (dim == 2) ? limits.MAX_Q1D : limits.MAX_INTERP_1D;
+   MFEM_VERIFY(D1D <= max_d1d && Q1D <= max_q1d,
+               "Orders higher than " << max_d1d - 1 << " and "
+               "quadrature rules with more than " << max_q1d
+               << " points per direction are not supported.");
+}
+
+// PA Hyperbolic Setup kernel: sign * W * adj(J).
+template <int DIM>
+static void PAHyperbolicSetup(const int NE, const int NQ, const real_t sign,
+                              const Array<real_t> &w, const Vector &j,
+                              Vector &op)
+{
+   const auto W = w.Read();
+   const auto J = Reshape(j.Read(), NQ, DIM, DIM, NE);
+   auto D = Reshape(op.Write(), NQ, DIM, DIM, NE);
+   mfem::forall(NQ*NE, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int q = i % NQ, e = i / NQ;
+      real_t Jloc[DIM*DIM], Aloc[DIM*DIM];
+      for (int c = 0; c < DIM; c++)
+      {
+         for (int r = 0; r < DIM; r++) { Jloc[r + DIM*c] = J(q,r,c,e); }
+      }
+      kernels::CalcAdjugate<DIM>(Jloc, Aloc);
+      for (int c = 0; c < DIM; c++)
+      {
+         for (int r = 0; r < DIM; r++)
+         {
+            D(q,r,c,e) = sign * W[q] * Aloc[r + DIM*c];
+         }
+      }
+   });
+}
+
+// Flux at the quadrature points, pulled back to the reference element,
+// Fr(c,k) = sum_d F(c,d) D(k,d), and the maximum characteristic speed.
+template <typename FK>
+static void PAHyperbolicFlux(const FK fk, const int NE, const int NQ,
+                             const Vector &d, const Vector &u, Vector &fr,
+                             Vector &speed)
+{
+   constexpr int DIM = FK::DIM;
+   constexpr int NEQ = FK::NEQ;
+   const auto D = Reshape(d.Read(), NQ, DIM, DIM, NE);
+   const auto U = Reshape(u.Read(), NEQ, NQ, NE);
+   auto Fr = Reshape(fr.Write(), NEQ, DIM, NQ, NE);
+   auto S = Reshape(speed.Write(), NQ, NE);
+   mfem::forall(NQ*NE, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int q = i % NQ, e = i / NQ;
+      real_t ul[NEQ], F[NEQ*DIM];
+      for (int c = 0; c < NEQ; c++) { ul[c] = U(c,q,e); }
+      S(q,e) = fk.Flux(ul, F);
+      for (int k = 0; k < DIM; k++)
+      {
+         for (int c = 0; c < NEQ; c++)
+         {
+            real_t s = 0.0;
+            for (int l = 0; l < DIM; l++) { s += F[c + NEQ*l] * D(q,k,l,e); }
+            Fr(c,k,q,e) = s;
+         }
+      }
+   });
+}
+
+// y += sum_q sum_k dphi/dxi_k(q) Fr(c,k,q), sum-factorized.
+static void PAHyperbolicGradTranspose2D(const int NE, const int NEQ,
+                                        const int D1D, const int Q1D,
+                                        const Array<real_t> &b,
+                                        const Array<real_t> &g,
+                                        const Vector &fr, Vector &y)
+{
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto G = Reshape(g.Read(), Q1D, D1D);
+   const auto Fr = Reshape(fr.Read(), NEQ, 2, Q1D, Q1D, NE);
+   auto Y = Reshape(y.ReadWrite(), D1D, D1D, NEQ, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MD1 = DofQuadLimits::MAX_D1D;
+      constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+      real_t t0[MD1][MQ1], t1[MD1][MQ1];
+      for (int c = 0; c < NEQ; c++)
+      {
+         for (int qy = 0; qy < Q1D; qy++)
+         {
+            for (int dx = 0; dx < D1D; dx++)
+            {
+               real_t s0 = 0.0, s1 = 0.0;
+               for (int qx = 0; qx < Q1D; qx++)
+               {
+                  s0 += G(qx,dx) * Fr(c,0,qx,qy,e);
+                  s1 += B(qx,dx) * Fr(c,1,qx,qy,e);
+               }
+               t0[dx][qy] = s0;
+               t1[dx][qy] = s1;
+            }
+         }
+         for (int dy = 0; dy < D1D; dy++)
+         {
+            for (int dx = 0; dx < D1D; dx++)
+            {
+               real_t s = 0.0;
+               for (int qy = 0; qy < Q1D; qy++)
+               {
+                  s += B(qy,dy) * t0[dx][qy] + G(qy,dy) * t1[dx][qy];
+               }
+               Y(dx,dy,c,e) += s;
+            }
+         }
+      }
+   });
+}
+
+static void PAHyperbolicGradTranspose3D(const int NE, const int NEQ,
+                                        const int D1D, const int Q1D,
+                                        const Array<real_t> &b,
+                                        const Array<real_t> &g,
+                                        const Vector &fr, Vector &y)
+{
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto G = Reshape(g.Read(), Q1D, D1D);
+   const auto Fr = Reshape(fr.Read(), NEQ, 3, Q1D, Q1D, Q1D, NE);
+   auto Y = Reshape(y.ReadWrite(), D1D, D1D, D1D, NEQ, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int M1 = DofQuadLimits::MAX_INTERP_1D;
+      real_t t1[M1][M1][M1], t2[M1][M1][M1];
+      for (int c = 0; c < NEQ; c++)
+      {
+         for (int k = 0; k < 3; k++)
+         {
+            // Derivative in direction k, interpolation in the others
+            const auto &Bx = (k == 0) ? G : B;
+            const auto &By = (k == 1) ? G : B;
+            const auto &Bz = (k == 2) ? G : B;
+            for (int qz = 0; qz < Q1D; qz++)
+            {
+               for (int qy = 0; qy < Q1D; qy++)
+               {
+                  for (int dx = 0; dx < D1D; dx++)
+                  {
+                     real_t s = 0.0;
+                     for (int qx = 0; qx < Q1D; qx++)
+                     {
+                        s += Bx(qx,dx) * Fr(c,k,qx,qy,qz,e);
+                     }
+                     t1[dx][qy][qz] = s;
+                  }
+               }
+            }
+            for (int qz = 0; qz < Q1D; qz++)
+            {
+               for (int dy = 0; dy < D1D; dy++)
+               {
+                  for (int dx = 0; dx < D1D; dx++)
+                  {
+                     real_t s = 0.0;
+                     for (int qy = 0; qy < Q1D; qy++)
+                     {
+                        s += By(qy,dy) * t1[dx][qy][qz];
+                     }
+                     t2[dx][dy][qz] = s;
+                  }
+               }
+            }
+            for (int dz = 0; dz < D1D; dz++)
+            {
+               for (int dy = 0; dy < D1D; dy++)
+               {
+                  for (int dx = 0; dx < D1D; dx++)
+                  {
+                     real_t s = 0.0;
+                     for (int qz = 0; qz < Q1D; qz++)
+                     {
+                        s += Bz(qz,dz) * t2[dx][dy][qz];
+                     }
+                     Y(dx,dy,dz,c,e) += s;
+                  }
+               }
+            }
+         }
+      }
+   });
+}
+
+// Interior face kernel: interpolates the traces from both sides, evaluates
+// the numerical flux with the scaled normal and applies the transpose of the
+// trace interpolation, y0 -= B^t F, y1 += B^t F.
+template <typename FK, typename NFK>
+static void PAHyperbolicFace2D(const FK fk, const NFK nfk, const int NF,
+                               const int D1D, const int Q1D,
+                               const real_t sign, const Array<real_t> &w,
+                               const Array<real_t> &b, const Vector &nor,
+                               const Vector &x, Vector &y, Vector &speed)
+{
+   constexpr int NEQ = FK::NEQ;
+   const auto W = w.Read();
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto N = Reshape(nor.Read(), Q1D, 2, NF);
+   const auto X = Reshape(x.Read(), D1D, NEQ, 2, NF);
+   auto Y = Reshape(y.ReadWrite(), D1D, NEQ, 2, NF);
+   auto S = Reshape(speed.Write(), Q1D, NF);
+   mfem::forall(NF, [=] MFEM_HOST_DEVICE (int f)
+   {
+      constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+      real_t flux[NEQ][MQ1];
+      for (int q = 0; q < Q1D; q++)
+      {
+         real_t u1[NEQ], u2[NEQ], n[2], fq[NEQ];
+         for (int c = 0; c < NEQ; c++)
+         {
+            real_t s1 = 0.0, s2 = 0.0;
+            for (int d = 0; d < D1D; d++)
+            {
+               s1 += B(q,d) * X(d,c,0,f);
+               s2 += B(q,d) * X(d,c,1,f);
+            }
+            u1[c] = s1;
+            u2[c] = s2;
+         }
+         n[0] = N(q,0,f);
+         n[1] = N(q,1,f);
+         S(q,f) = nfk.Eval(fk, u1, u2, n, fq);
+         for (int c = 0; c < NEQ; c++) { flux[c][q] = sign * W[q] * fq[c]; }
+      }
+      for (int c = 0; c < NEQ; c++)
+      {
+         for (int d = 0; d < D1D; d++)
+         {
+            real_t s = 0.0;
+            for (int q = 0; q < Q1D; q++) { s += B(q,d) * flux[c][q]; }
+            Y(d,c,0,f) -= s;
+            Y(d,c,1,f) += s;
+         }
+      }
+   });
+}
+
+template <typename FK, typename NFK>
+static void PAHyperbolicFace3D(const FK fk, const NFK nfk, const int NF,
+                               const int D1D, const int Q1D,
+                               const real_t sign, const Array<real_t> &w,
+                               const Array<real_t> &b, const Vector &nor,
+                               const Vector &x, Vector &y, Vector &speed)
+{
+   constexpr int NEQ = FK::NEQ;
+   const auto W = Reshape(w.Read(), Q1D, Q1D);
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto N = Reshape(nor.Read(), Q1D, Q1D, 3, NF);
+   const auto X = Reshape(x.Read(), D1D, D1D, NEQ, 2, NF);
+   auto Y = Reshape(y.ReadWrite(), D1D, D1D, NEQ, 2, NF);
+   auto S = Reshape(speed.Write(), Q1D, Q1D, NF);
+   mfem::forall(NF, [=] MFEM_HOST_DEVICE (int f)
+   {
+      constexpr int M1 = DofQuadLimits::MAX_INTERP_1D;
+      real_t t[2][NEQ][M1][M1];   // (qx,dy)
+      real_t u[2][NEQ][M1][M1];   // (qx,qy)
+      for (int side = 0; side < 2; side++)
+      {
+         for (int c = 0; c < NEQ; c++)
+         {
+            for (int dy = 0; dy < D1D; dy++)
+            {
+               for (int qx = 0; qx < Q1D; qx++)
+               {
+                  real_t s = 0.0;
+                  for (int dx = 0; dx < D1D; dx++)
+                  {
+                     s += B(qx,dx) * X(dx,dy,c,side,f);
+                  }
+                  t[side][c][qx][dy] = s;
+               }
+            }
+            for (int qy = 0; qy < Q1D; qy++)
+            {
+               for (int qx = 0; qx < Q1D; qx++)
+               {
+                  real_t s = 0.0;
+                  for (int dy = 0; dy < D1D; dy++)
+                  {
+                     s += B(qy,dy) * t[side][c][qx][dy];
+                  }
+                  u[side][c][qx][qy] = s;
+               }
+            }
+         }
+      }
+      // Store the scaled numerical flux in u[0]
+      for (int qy = 0; qy < Q1D; qy++)
+      {
+         for (int qx = 0; qx < Q1D; qx++)
+         {
+            real_t u1[NEQ], u2[NEQ], n[3], fq[NEQ];
+            for (int c = 0; c < NEQ; c++)
+            {
+               u1[c] = u[0][c][qx][qy];
+               u2[c] = u[1][c][qx][qy];
+            }
+            for (int d = 0; d < 3; d++) { n[d] = N(qx,qy,d,f); }
+            S(qx,qy,f) = nfk.Eval(fk, u1, u2, n, fq);
+            for (int c = 0; c < NEQ; c++)
+            {
+               u[0][c][qx][qy] = sign * W(qx,qy) * fq[c];
+            }
+         }
+      }
+      for (int c = 0; c < NEQ; c++)
+      {
+         for (int qx = 0; qx < Q1D; qx++)
+         {
+            for (int dy = 0; dy < D1D; dy++)
+            {
+               real_t s = 0.0;
+               for (int qy = 0; qy < Q1D; qy++)
+               {
+                  s += B(qy,dy) * u[0][c][qx][qy];
+               }
+               t[0][c][qx][dy] = s;
+            }
+         }
+         for (int dy = 0; dy < D1D; dy++)
+         {
+            for (int dx = 0; dx < D1D; dx++)
+            {
+               real_t s = 0.0;
+               for (int qx = 0; qx < Q1D; qx++)
+               {
+                  s += B(qx,dx) * t[0][c][qx][dy];
+               }
+               Y(dx,dy,c,0,f) -= s;
+               Y(dx,dy,c,1,f) += s;
+            }
+         }
+      }
+   });
+}
+
+void HyperbolicFormIntegrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   CheckPASpace(fes, num_equations);
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetTypicalFE();
+   dim = mesh->Dimension();
+   ne = fes.GetNE();
+   // Abort early if the flux function is not supported
+   DispatchFluxKernel(dim, fluxFunction, [](auto) { });
+   const IntegrationRule *ir = IntRule ? IntRule :
+                               &IntRules.Get(el.GetGeomType(),
+                                             2*el.GetOrder() + IntOrderOffset);
+   nq = ir->GetNPoints();
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   CheckPA1D(dim, maps->ndof, maps->nqpt);
+   qi = fes.GetQuadratureInterpolator(*ir);
+
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS);
+   pa_data.SetSize(nq * dim * dim * ne, Device::GetMemoryType());
+   if (dim == 2)
+   {
+      PAHyperbolicSetup<2>(ne, nq, sign, ir->GetWeights(), geom->J, pa_data);
+   }
+   else
+   {
+      PAHyperbolicSetup<3>(ne, nq, sign, ir->GetWeights(), geom->J, pa_data);
+   }
+}
+
+void HyperbolicFormIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   if (ne == 0) { return; }
+   q_state.SetSize(num_equations * nq * ne, Device::GetMemoryType());
+   q_flux.SetSize(num_equations * dim * nq * ne, Device::GetMemoryType());
+   q_speed.SetSize(nq * ne, Device::GetMemoryType());
+
+   qi->SetOutputLayout(QVectorLayout::byVDIM);
+   qi->Values(x, q_state);
+   DispatchFluxKernel(dim, fluxFunction, [&](auto fk)
+   {
+      PAHyperbolicFlux(fk, ne, nq, pa_data, q_state, q_flux, q_speed);
+   });
+   if (dim == 2)
+   {
+      PAHyperbolicGradTranspose2D(ne, num_equations, maps->ndof, maps->nqpt,
+                                  maps->B, maps->G, q_flux, y);
+   }
+   else
+   {
+      PAHyperbolicGradTranspose3D(ne, num_equations, maps->ndof, maps->nqpt,
+                                  maps->B, maps->G, q_flux, y);
+   }
+   max_char_speed = std::max(q_speed.Max(), max_char_speed);
+}
+
+void HyperbolicFormIntegrator::AssemblePAInteriorFaces(
+   const FiniteElementSpace &fes)
+{
+   CheckPASpace(fes, num_equations);
+   const auto *tfe =
+      dynamic_cast<const TensorBasisElement*>(fes.GetTypicalFE());
+   MFEM_VERIFY(tfe->GetBasisType() == BasisType::GaussLobatto,
+               "Only the Gauss-Lobatto basis is supported on the faces.");
+   MFEM_VERIFY(dynamic_cast<const RusanovFlux*>(&numFlux) ||
+               dynamic_cast<const ComponentwiseUpwindFlux*>(&numFlux),
+               "Partial assembly supports only RusanovFlux and "
+               "ComponentwiseUpwindFlux.");
+
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetTypicalTraceElement();
+   dim = mesh->Dimension();
+   nf = fes.GetNFbyType(FaceType::Interior);
+   const int order = 2*fes.GetTypicalFE()->GetOrder() + IntOrderOffset;
+   const IntegrationRule *ir = IntRule ? IntRule :
+                               &IntRules.Get(el.GetGeomType(), order);
+   nq_face = ir->GetNPoints();
+   face_maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   CheckPA1D(dim, face_maps->ndof, face_maps->nqpt);
+   if (nf == 0) { return; }
+
+   const FaceGeometricFactors *geom = mesh->GetFaceGeometricFactors(
+                                         *ir, FaceGeometricFactors::DETERMINANTS |
+                                         FaceGeometricFactors::NORMALS,
+                                         FaceType::Interior);
+   pa_face_data.SetSize(nq_face * dim * nf, Device::GetMemoryType());
+   // Scaled normal, n*|J|, equal to CalcOrtho() of the face Jacobian
+   const int NQ = nq_face, DIM = dim, NF = nf;
+   const auto n = Reshape(geom->normal.Read(), NQ, DIM, NF);
+   const auto detJ = Reshape(geom->detJ.Read(), NQ, NF);
+   auto nor = Reshape(pa_face_data.Write(), NQ, DIM, NF);
+   mfem::forall(NQ*NF, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int q = i % NQ, f = i / NQ;
+      for (int d = 0; d < DIM; d++) { nor(q,d,f) = n(q,d,f) * detJ(q,f); }
+   });
+}
+
+void HyperbolicFormIntegrator::AddMultPAInteriorFaces(const Vector &x,
+                                                      Vector &y) const
+{
+   if (nf == 0) { return; }
+   face_speed.SetSize(nq_face * nf, Device::GetMemoryType());
+   const int D1D = face_maps->ndof, Q1D = face_maps->nqpt;
+   const Array<real_t> &W = face_maps->IntRule->GetWeights();
+   const Array<real_t> &B = face_maps->B;
+   const auto apply = [&](auto fk, auto nfk)
+   {
+      if constexpr (decltype(fk)::DIM == 2)
+      {
+         PAHyperbolicFace2D(fk, nfk, nf, D1D, Q1D, sign, W, B, pa_face_data,
+                            x, y, face_speed);
+      }
+      else
+      {
+         PAHyperbolicFace3D(fk, nfk, nf, D1D, Q1D, sign, W, B, pa_face_data,
+                            x, y, face_speed);
+      }
+   };
+   DispatchFluxKernel(dim, fluxFunction, [&](auto fk)
+   {
+      if (dynamic_cast<const RusanovFlux*>(&numFlux))
+      {
+         apply(fk, RusanovFluxKernel {});
+      }
+      else
+      {
+         apply(fk, ComponentwiseUpwindFluxKernel {});
+      }
+   });
+   max_char_speed = std::max(face_speed.Max(), max_char_speed);
+}
+
+} // namespace mfem
@@ -0,0 +1,456 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../../linalg/kernels.hpp"
+#include "../nonlininteg.hpp"
+#include "../ceed/interface/util.hpp"
+
+namespace mfem
+{
+
+// PA Hyperelastic Setup kernel: Jrt = Jtr^{-1} and W det(Jtr).
+template<int DIM>
+static void PAHyperelasticSetup(const int NE, const int NQ,
+                                const Array<real_t> &w,
+                                const Vector &j,
+                                Vector &jrt,
+                                Vector &wdet)
+{
+   const auto W = w.Read();
+   const auto J = Reshape(j.Read(), NQ, DIM, DIM, NE);
+   auto Jrt = Reshape(jrt.Write(), NQ, DIM, DIM, NE);
+   auto WD = Reshape(wdet.Write(), NQ, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      real_t Jtr[DIM*DIM], Jinv[DIM*DIM];
+      for (int q = 0; q < NQ; ++q)
+      {
+         for (int c = 0; c < DIM; c++)
+         {
+            for (int r = 0; r < DIM; r++)
+            {
+               Jtr[r + DIM*c] = J(q,r,c,e);
+            }
+         }
+         kernels::CalcInverse<DIM>(Jtr, Jinv);
+         WD(q,e) = W[q] * kernels::Det<DIM>(Jtr);
+         for (int c = 0; c < DIM; c++)
+         {
+            for (int r = 0; r < DIM; r++)
+            {
+               Jrt(q,r,c,e) = Jinv[r + DIM*c];
+            }
+         }
+      }
+   });
+}
+
+// Deformation gradient Jpt = (X^t DSh) Jrt at the quadrature points.
+template<int DIM>
+static void PAHyperelasticDefGrad(const int NE, const int ND, const int NQ,
+                                  const Vector &g,
+                                  const Vector &jrt,
+                                  const Vector &x,
+                                  Vector &f)
+{
+   const auto G = Reshape(g.Read(), NQ, DIM, ND);
+   const auto Jrt = Reshape(jrt.Read(), NQ, DIM, DIM, NE);
+   const auto X = Reshape(x.Read(), ND, DIM, NE);
+   auto F = Reshape(f.Write(), DIM, DIM, NQ, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int q = 0; q < NQ; ++q)
+      {
+         real_t Jpr[DIM][DIM];
+         for (int i = 0; i < DIM; i++)
+         {
+            for (int j = 0; j < DIM; j++) { Jpr[i][j] = 0.0; }
+         }
+         for (int a = 0; a < ND; a++)
+         {
+            for (int j = 0; j < DIM; j++)
+            {
+               const real_t gja = G(q,j,a);
+               for (int i = 0; i < DIM; i++) { Jpr[i][j] += X(a,i,e) * gja; }
+            }
+         }
+         for (int i = 0; i < DIM; i++)
+         {
+            for (int k = 0; k < DIM; k++)
+            {
+               real_t s = 0.0;
+               for (int j = 0; j < DIM; j++) { s += Jpr[i][j] * Jrt(q,j,k,e); }
+               F(i,k,q,e) = s;
+            }
+         }
+      }
+   });
+}
+
+// Residual kernel: y(a,i) += sum_q sum_m S(i,m,q) G(q,m,a).
+template<int DIM>
+static void PAHyperelasticApply(const int NE, const int ND, const int NQ,
+                                const Vector &g,
+                                const Vector &s,
+                                Vector &y)
+{
+   const auto G = Reshape(g.Read(), NQ, DIM, ND);
+   const auto S = Reshape(s.Read(), DIM, DIM, NQ, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, DIM, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int a = 0; a < ND; a++)
+      {
+         real_t ya[DIM];
+         for (int i = 0; i < DIM; i++) { ya[i] = 0.0; }
+         for (int q = 0; q < NQ; ++q)
+         {
+            for (int m = 0; m < DIM; m++)
+            {
+               const real_t gma = G(q,m,a);
+               for (int i = 0; i < DIM; i++) { ya[i] += S(i,m,q,e) * gma; }
+            }
+         }
+         for (int i = 0; i < DIM; i++) { Y(a,i,e) += ya[i]; }
+      }
+   });
+}
+
+// Gradient kernel: y(a,i) += sum_q sum_m G(q,m,a) C(i,m,j,n,q) (dX^t G)(j,n).
+template<int DIM>
+static void PAHyperelasticApplyGrad(const int NE, const int ND, const int NQ,
+                                    const Vector &g,
+                                    const Vector &c,
+                                    const Vector &x,
+                                    Vector &y)
+{
+   const auto G = Reshape(g.Read(), NQ, DIM, ND);
+   const auto C = Reshape(c.Read(), DIM, DIM, DIM, DIM, NQ, NE);
+   const auto X = Reshape(x.Read(), ND, DIM, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, DIM, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int q = 0; q < NQ; ++q)
+      {
+         real_t gX[DIM][DIM], CgX[DIM][DIM];
+         for (int j = 0; j < DIM; j++)
+         {
+            for (int n = 0; n < DIM; n++) { gX[j][n] = 0.0; }
+         }
+         for (int b = 0; b < ND; b++)
+         {
+            for (int n = 0; n < DIM; n++)
+            {
+               const real_t gnb = G(q,n,b);
+               for (int j = 0; j < DIM; j++) { gX[j][n] += X(b,j,e) * gnb; }
+            }
+         }
+         for (int i = 0; i < DIM; i++)
+         {
+            for (int m = 0; m < DIM; m++)
+            {
+               real_t s = 0.0;
+               for (int j = 0; j < DIM; j++)
+               {
+                  for (int n = 0; n < DIM; n++)
+                  {
+                     s += C(i,m,j,n,q,e) * gX[j][n];
+                  }
+               }
+               CgX[i][m] = s;
+            }
+         }
+         for (int a = 0; a < ND; a++)
+         {
+            for (int i = 0; i < DIM; i++)
+            {
+               real_t s = 0.0;
+               for (int m = 0; m < DIM; m++) { s += G(q,m,a) * CgX[i][m]; }
+               Y(a,i,e) += s;
+            }
+         }
+      }
+   });
+}
+
+// Gradient diagonal kernel.
+template<int DIM>
+static void PAHyperelasticGradDiagonal(const int NE, const int ND,
+                                       const int NQ,
+                                       const Vector &g,
+                                       const Vector &c,
+                                       Vector &diag)
+{
+   const auto G = Reshape(g.Read(), NQ, DIM, ND);
+   const auto C = Reshape(c.Read(), DIM, DIM, DIM, DIM, NQ, NE);
+   auto D = Reshape(diag.ReadWrite(), ND, DIM, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int a = 0; a < ND; a++)
+      {
+         for (int i = 0; i < DIM; i++)
+         {
+            real_t s = 0.0;
+            for (int q = 0; q < NQ; ++q)
+            {
+               for (int m = 0; m < DIM; m++)
+               {
+                  for (int n = 0; n < DIM; n++)
+                  {
+                     s += G(q,m,a) * C(i,m,i,n,q,e) * G(q,n,a);
+                  }
+               }
+            }
+            D(a,i,e) += s;
+         }
+      }
+   });
+}
+
+void HyperelasticNLFIntegrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   Mesh *mesh = fes.GetMesh();
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "only 2D and 3D meshes are supported");
+   MFEM_VERIFY(mesh->SpaceDimension() == dim && fes.GetVDim() == dim,
+               "the FE space must be a vector space with vdim == dim");
+   MFEM_VERIFY(!fes.IsVariableOrder() && mesh->GetNumGeometries(dim) <= 1,
+               "mixed meshes and variable order spaces are not supported");
+   MFEM_VERIFY(!DeviceCanUseCeed(), "the Ceed backends are not supported");
+
+   fespace = &fes;
+   const FiniteElement &el = *fes.GetTypicalFE();
+   ElementTransformation &T = *mesh->GetTypicalElementTransformation();
+   pa_ir = GetIntegrationRule(el, T);
+   ne = fes.GetNE();
+   nd = el.GetDof();
+   nq = pa_ir->GetNPoints();
+
+   // Reference gradients, reordered to match the lexicographic E-vectors used
+   // by the PA nonlinear form extension.
+   const DofToQuad &maps = el.GetDofToQuad(*pa_ir, DofToQuad::FULL);
+   auto el_t = dynamic_cast<const TensorBasisElement*>(&el);
+   auto el_n = dynamic_cast<const NodalFiniteElement*>(&el);
+   const Array<int> *dof_map = el_t ? &el_t->GetDofMap() :
+                               el_n ? &el_n->GetLexicographicOrdering() :
+                               nullptr;
+   const bool reorder = dof_map && dof_map->Size() > 0;
+   pa_G.SetSize(nq*dim*nd);
+   {
+      const auto G = Reshape(maps.G.HostRead(), nq, dim, nd);
+      auto G_lex = Reshape(pa_G.HostWrite(), nq, dim, nd);
+      for (int a = 0; a < nd; a++)
+      {
+         const int a_nat = reorder ? (*dof_map)[a] : a;
+         for (int j = 0; j < dim; j++)
+         {
+            for (int q = 0; q < nq; q++) { G_lex(q,j,a) = G(q,j,a_nat); }
+         }
+      }
+   }
+
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(*pa_ir, GeometricFactors::JACOBIANS, pa_mt);
+   pa_data.SetSize(nq*dim*dim*ne, Device::GetMemoryType());
+   pa_w.SetSize(nq*ne, Device::GetMemoryType());
+   pa_F.SetSize(dim*dim*nq*ne, Device::GetMemoryType());
+   pa_S.SetSize(dim*dim*nq*ne, Device::GetMemoryType());
+   const Array<real_t> &w = pa_ir->GetWeights();
+   switch (dim)
+   {
+      case 2: PAHyperelasticSetup<2>(ne, nq, w, geom->J, pa_data, pa_w); break;
+      case 3: PAHyperelasticSetup<3>(ne, nq, w, geom->J, pa_data, pa_w); break;
+      default: MFEM_ABORT("dim = " << dim << " is not supported");
+   }
+}
+
+void HyperelasticNLFIntegrator::ComputeDeformationGradientPA(
+   const Vector &x) const
+{
+   switch (dim)
+   {
+      case 2: PAHyperelasticDefGrad<2>(ne, nd, nq, pa_G, pa_data, x, pa_F);
+         break;
+      case 3: PAHyperelasticDefGrad<3>(ne, nd, nq, pa_G, pa_data, x, pa_F);
+         break;
+      default: MFEM_ABORT("dim = " << dim << " is not supported");
+   }
+}
+
+real_t HyperelasticNLFIntegrator::GetLocalStateEnergyPA(const Vector &x) const
+{
+   ComputeDeformationGradientPA(x);
+   const auto F = Reshape(pa_F.HostRead(), dim, dim, nq, ne);
+   const auto W = Reshape(pa_w.HostRead(), nq, ne);
+
+   Mesh *mesh = fespace->GetMesh();
+   IsoparametricTransformation Ttr;
+   DenseMatrix Jpt_q(dim);
+   real_t energy = 0.0;
+   for (int e = 0; e < ne; e++)
+   {
+      mesh->GetElementTransformation(e, &Ttr);
+      model->SetTransformation(Ttr);
+      for (int q = 0; q < nq; q++)
+      {
+         Ttr.SetIntPoint(&pa_ir->IntPoint(q));
+         for (int k = 0; k < dim; k++)
+         {
+            for (int i = 0; i < dim; i++) { Jpt_q(i,k) = F(i,k,q,e); }
+         }
+         energy += W(q,e) * model->EvalW(Jpt_q);
+      }
+   }
+   return energy;
+}
+
+void HyperelasticNLFIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   ComputeDeformationGradientPA(x);
+   const auto F = Reshape(pa_F.HostRead(), dim, dim, nq, ne);
+   const auto Jrt_q = Reshape(pa_data.HostRead(), nq, dim, dim, ne);
+   const auto W = Reshape(pa_w.HostRead(), nq, ne);
+   auto S = Reshape(pa_S.HostWrite(), dim, dim, nq, ne);
+
+   // Evaluate the model at the quadrature points and store the weighted
+   // W det(Jtr) P Jrt^t, so that the residual is S : DSh.
+   Mesh *mesh = fespace->GetMesh();
+   IsoparametricTransformation Ttr;
+   DenseMatrix Jpt_q(dim), P_q(dim);
+   for (int e = 0; e < ne; e++)
+   {
+      mesh->GetElementTransformation(e, &Ttr);
+      model->SetTransformation(Ttr);
+      for (int q = 0; q < nq; q++)
+      {
+         Ttr.SetIntPoint(&pa_ir->IntPoint(q));
+         for (int k = 0; k < dim; k++)
+         {
+            for (int i = 0; i < dim; i++) { Jpt_q(i,k) = F(i,k,q,e); }
+         }
+         model->EvalP(Jpt_q, P_q);
+         for (int m = 0; m < dim; m++)
+         {
+            for (int i = 0; i < dim; i++)
+            {
+               real_t s = 0.0;
+               for (int k = 0; k < dim; k++) { s += P_q(i,k) * Jrt_q(q,m,k,e); }
+               S(i,m,q,e) = W(q,e) * s;
+            }
+         }
+      }
+   }
+
+   switch (dim)
+   {
+      case 2: PAHyperelasticApply<2>(ne, nd, nq, pa_G, pa_S, y); break;
+      case 3: PAHyperelasticApply<3>(ne, nd, nq, pa_G, pa_S, y); break;
+      default: MFEM_ABORT("dim = " << dim << " is not supported");
+   }
+}
+
+void HyperelasticNLFIntegrator::AssembleGradPA(const Vector &x,
+                                               const FiniteElementSpace &fes)
+{
+   if (fespace != &fes) { AssemblePA(fes); }
+
+   ComputeDeformationGradientPA(x);
+   const auto F = Reshape(pa_F.HostRead(), dim, dim, nq, ne);
+   const auto Jrt_q = Reshape(pa_data.HostRead(), nq, dim, dim, ne);
+   const auto W = Reshape(pa_w.HostRead(), nq, ne);
+   grad_data.SetSize(dim*dim*dim*dim*nq*ne, Device::GetMemoryType());
+   auto C = Reshape(grad_data.HostWrite(), dim, dim, dim, dim, nq, ne);
+
+   // With DS = I, HyperelasticModel::AssembleH() returns the derivative of P
+   // with respect to Jpt: H(k + i*dim, l + j*dim) = dP(i,k)/dJpt(j,l).
+   DenseMatrix I_dim(dim), H(dim*dim), HJ(dim);
+   I_dim = 0.0;
+   for (int i = 0; i < dim; i++) { I_dim(i,i) = 1.0; }
+
+   Mesh *mesh = fespace->GetMesh();
+   IsoparametricTransformation Ttr;
+   DenseMatrix Jpt_q(dim);
+   for (int e = 0; e < ne; e++)
+   {
+      mesh->GetElementTransformation(e, &Ttr);
+      model->SetTransformation(Ttr);
+      for (int q = 0; q < nq; q++)
+      {
+         Ttr.SetIntPoint(&pa_ir->IntPoint(q));
+         for (int k = 0; k < dim; k++)
+         {
+            for (int i = 0; i < dim; i++) { Jpt_q(i,k) = F(i,k,q,e); }
+         }
+         H = 0.0;
+         model->AssembleH(Jpt_q, I_dim, W(q,e), H);
+         // Pull back both gradient indices to the reference element:
+         // C(i,m,j,n) = sum_{k,l} Jrt(m,k) dP(i,k)/dJpt(j,l) Jrt(n,l).
+         for (int j = 0; j < dim; j++)
+         {
+            for (int i = 0; i < dim; i++)
+            {
+               for (int n = 0; n < dim; n++)
+               {
+                  for (int k = 0; k < dim; k++)
+                  {
+                     real_t s = 0.0;
+                     for (int l = 0; l < dim; l++)
+                     {
+                        s += H(k + i*dim, l + j*dim) * Jrt_q(q,n,l,e);
+                     }
+                     HJ(k,n) = s;
+                  }
+               }
+               for (int n = 0; n < dim; n++)
+               {
+                  for (int m = 0; m < dim; m++)
+                  {
+                     real_t s = 0.0;
+                     for (int k = 0; k < dim; k++)
+                     {
+                        s += Jrt_q(q,m,k,e) * HJ(k,n);
+                     }
+                     C(i,m,j,n,q,e) = s;
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+void HyperelasticNLFIntegrator::AddMultGradPA(const Vector &x,
+                                              Vector &y) const
+{
+   switch (dim)
+   {
+      case 2: PAHyperelasticApplyGrad<2>(ne, nd, nq, pa_G, grad_data, x, y);
+         break;
+      case 3: PAHyperelasticApplyGrad<3>(ne, nd, nq, pa_G, grad_data, x, y);
+         break;
+      default: MFEM_ABORT("dim = " << dim << " is not supported");
+   }
+}
+
+void HyperelasticNLFIntegrator::AssembleGradDiagonalPA(Vector &diag) const
+{
+   switch (dim)
+   {
+      case 2: PAHyperelasticGradDiagonal<2>(ne, nd, nq, pa_G, grad_data, diag);
+         break;
+      case 3: PAHyperelasticGradDiagonal<3>(ne, nd, nq, pa_G, grad_data, diag);
+         break;
+      default: MFEM_ABORT("dim = " << dim << " is not supported");
+   }
+}
+
+} // namespace mfem
@@ -10,6 +10,11 @@
 // CONTRIBUTING.md for details.
 
 #include "multigrid.hpp"
+#include "../linalg/solvers.hpp"
+#ifdef MFEM_USE_MPI
+#include "pbilinearform.hpp"
+#include "../linalg/hypre.hpp"
+#endif
 
 namespace mfem
 {
@@ -329,7 +334,10 @@ void GeometricMultigrid::FormFineLinearSystem(Vector& x, Vector& b,
                                               OperatorHandle& A,
                                               Vector& X, Vector& B)
 {
-   bfs.Last()->FormLinearSystem(*essentialTrueDofs.Last(), x, b, A, X, B);
+   const Array<int> no_ess_tdofs;
+   bfs.Last()->FormLinearSystem(essentialTrueDofs.Size() ?
+                                *essentialTrueDofs.Last() : no_ess_tdofs,
+                                x, b, A, X, B);
 }
 
 void GeometricMultigrid::RecoverFineFEMSolution(const Vector& X,
@@ -338,4 +346,186 @@ void GeometricMultigrid::RecoverFineFEMSolution(const Vector& X,
    bfs.Last()->RecoverFEMSolution(X, b, x);
 }
 
+PMultigridSolver::PMultigridSolver(const FiniteElementSpace &fes,
+                                   const Array<int> &ess_bdr,
+                                   IntegratorBuilder add_integrators_,
+                                   int coarse_order, int smoother_order_)
+   : GeometricMultigrid(*MakeHierarchy(fes, coarse_order), ess_bdr),
+     add_integrators(add_integrators_),
+     smoother_order(smoother_order_)
+{
+   const int nlevels = fespaces.GetNumLevels();
+   collections.SetSize(nlevels);
+   for (int level = 0; level < nlevels; ++level)
+   {
+      collections[level] = const_cast<FiniteElementCollection*>(
+                              fespaces.GetFESpaceAtLevel(level).FEColl());
+   }
+   max_eig.SetSize(nlevels);
+   max_eig = 0.0;
+
+   ConstructCoarseOperatorAndSolver();
+   for (int level = 1; level < nlevels; ++level)
+   {
+      ConstructOperatorAndSmoother(level);
+   }
+}
+
+PMultigridSolver::~PMultigridSolver()
+{
+   // The forms reference the spaces of the hierarchy, which is owned here and
+   // is deleted before the base class destructors are called.
+   for (int i = 0; i < bfs.Size(); ++i) { delete bfs[i]; }
+   bfs.SetSize(0);
+   delete &fespaces;
+   for (int i = 0; i < collections.Size(); ++i) { delete collections[i]; }
+}
+
+FiniteElementSpaceHierarchy *PMultigridSolver::MakeHierarchy(
+   const FiniteElementSpace &fes, int coarse_order)
+{
+   const H1_FECollection *fine_fec =
+      dynamic_cast<const H1_FECollection*>(fes.FEColl());
+   MFEM_VERIFY(fine_fec, "PMultigridSolver requires an H1 space");
+   MFEM_VERIFY(!fes.IsVariableOrder(),
+               "variable order spaces are not supported");
+   const int dim = fes.GetMesh()->Dimension();
+   const int vdim = fes.GetVDim();
+   const int ordering = fes.GetOrdering();
+   const int btype = fine_fec->GetBasisType();
+
+   // Orders of the levels, from the coarsest to the finest one
+   const int fine_order = fes.GetMaxElementOrder();
+   MFEM_VERIFY(coarse_order >= 1 && coarse_order <= fine_order,
+               "invalid coarse order " << coarse_order);
+   Array<int> orders;
+   for (int p = fine_order; p > coarse_order; p = std::max(coarse_order, p/2))
+   {
+      orders.Prepend(p);
+   }
+   orders.Prepend(coarse_order);
+
+   FiniteElementCollection *coarse_fec =
+      new H1_FECollection(orders[0], dim, btype);
+   FiniteElementSpaceHierarchy *hierarchy = nullptr;
+#ifdef MFEM_USE_MPI
+   if (auto *pfes = dynamic_cast<const ParFiniteElementSpace*>(&fes))
+   {
+      ParMesh *pmesh = pfes->GetParMesh();
+      hierarchy = new ParFiniteElementSpaceHierarchy(
+         pmesh, new ParFiniteElementSpace(pmesh, coarse_fec, vdim, ordering),
+         false, true);
+   }
+#endif
+   if (!hierarchy)
+   {
+      Mesh *mesh = fes.GetMesh();
+      hierarchy = new FiniteElementSpaceHierarchy(
+         mesh, new FiniteElementSpace(mesh, coarse_fec, vdim, ordering),
+         false, true);
+   }
+   for (int level = 1; level < orders.Size(); ++level)
+   {
+      hierarchy->AddOrderRefinedLevel(
+         new H1_FECollection(orders[level], dim, btype), vdim, ordering);
+   }
+   return hierarchy;
+}
+
+void PMultigridSolver::ConstructBilinearForm(int level, AssemblyLevel assembly)
+{
+   FiniteElementSpace &fes = const_cast<FiniteElementSpace&>(
+                                fespaces.GetFESpaceAtLevel(level));
+   BilinearForm *form = nullptr;
+#ifdef MFEM_USE_MPI
+   if (auto *pfes = dynamic_cast<ParFiniteElementSpace*>(&fes))
+   {
+      form = new ParBilinearForm(pfes);
+   }
+#endif
+   if (!form) { form = new BilinearForm(&fes); }
+   form->SetAssemblyLevel(assembly);
+   add_integrators(*form);
+   form->Assemble();
+   bfs.Append(form);
+}
+
+void PMultigridSolver::ConstructCoarseOperatorAndSolver()
+{
+   ConstructBilinearForm(0, AssemblyLevel::LEGACY);
+
+   OperatorPtr opr;
+   opr.SetType(Operator::ANY_TYPE);
+   bfs[0]->FormSystemMatrix(GetEssentialTrueDofs(0), opr);
+   const bool own_opr = opr.OwnsOperator();
+   opr.SetOperatorOwner(false);
+
+   Solver *coarse_solver = nullptr;
+#ifdef MFEM_USE_MPI
+   if (auto *hypre_opr = dynamic_cast<HypreParMatrix*>(opr.Ptr()))
+   {
+      HypreBoomerAMG *amg = new HypreBoomerAMG(*hypre_opr);
+      amg->SetPrintLevel(0);
+      if (fespaces.GetFESpaceAtLevel(0).GetVDim() > 1)
+      {
+         amg->SetSystemsOptions(fespaces.GetFESpaceAtLevel(0).GetVDim(),
+                                fespaces.GetFESpaceAtLevel(0).GetOrdering() ==
+                                Ordering::byNODES);
+      }
+      coarse_solver = amg;
+   }
+#endif
+   if (!coarse_solver)
+   {
+      SparseMatrix *sp_opr = dynamic_cast<SparseMatrix*>(opr.Ptr());
+      MFEM_VERIFY(sp_opr, "unexpected coarse operator type");
+      CGSolver *pcg = new CGSolver();
+      pcg->SetPrintLevel(-1);
+      pcg->SetMaxIter(500);
+      pcg->SetRelTol(1e-8);
+      pcg->SetAbsTol(0.0);
+      pcg->SetOperator(*sp_opr);
+      coarse_prec.reset(new GSSmoother(*sp_opr));
+      pcg->SetPreconditioner(*coarse_prec);
+      coarse_solver = pcg;
+   }
+
+   AddLevel(opr.Ptr(), coarse_solver, own_opr, true);
+}
+
+void PMultigridSolver::ConstructOperatorAndSmoother(int level)
+{
+   const Array<int> &ess_tdof_list = GetEssentialTrueDofs(level);
+   ConstructBilinearForm(level, AssemblyLevel::PARTIAL);
+
+   OperatorPtr opr;
+   opr.SetType(Operator::ANY_TYPE);
+   bfs[level]->FormSystemMatrix(ess_tdof_list, opr);
+   const bool own_opr = opr.OwnsOperator();
+   opr.SetOperatorOwner(false);
+
+   Vector diag(fespaces.GetFESpaceAtLevel(level).GetTrueVSize());
+   bfs[level]->AssembleDiagonal(diag);
+
+   // Estimate the largest eigenvalue of the diagonally preconditioned
+   // operator with a power method.
+   OperatorJacobiSmoother inv_diag(diag, ess_tdof_list, 1.0);
+   ProductOperator diag_prec(&inv_diag, opr.Ptr(), false, false);
+#ifdef MFEM_USE_MPI
+   auto *pfes = dynamic_cast<const ParFiniteElementSpace*>(
+                   &fespaces.GetFESpaceAtLevel(level));
+   PowerMethod power_method(pfes ? pfes->GetComm() : MPI_COMM_NULL);
+#else
+   PowerMethod power_method;
+#endif
+   Vector ev(opr->Width());
+   max_eig[level] = power_method.EstimateLargestEigenvalue(diag_prec, ev, 10,
+                                                           1e-8, 12345);
+
+   Solver *smoother = new OperatorChebyshevSmoother(*opr, diag, ess_tdof_list,
+                                                    smoother_order,
+                                                    max_eig[level]);
+   AddLevel(opr.Ptr(), smoother, own_opr, true);
+}
+
 } // namespace mfem
@@ -17,6 +17,7 @@
 
 #include "../linalg/operator.hpp"
 #include "../linalg/handle.hpp"
+#include <functional>
 
 namespace mfem
 {
@@ -204,6 +205,72 @@ public:
    void RecoverFineFEMSolution(const Vector& X, const Vector& b, Vector& x);
 };
 
+/// Matrix-free p-multigrid solver for H1 discretizations
+/** The levels of the hierarchy have the same mesh as the given finite element
+    space and orders p, p/2, p/4, ..., down to the coarse order. The operators
+    on all levels, except the coarsest one, use partial assembly and are
+    smoothed with OperatorChebyshevSmoother, where the largest eigenvalue of
+    the diagonally preconditioned operator is estimated with a power method.
+    The intergrid transfer operators are TransferOperator%s, i.e.
+    TensorProductPRefinementTransferOperator%s for scalar spaces on tensor
+    product meshes. The operator on the coarsest level is fully assembled and
+    solved with HypreBoomerAMG in parallel, or with a Gauss-Seidel
+    preconditioned CG in serial.
+
+    The bilinear form is described by a function that adds the integrators to
+    the form on each level; the integrators are not shared between levels.
+    Since the finest space of the hierarchy has the same dofs as the given
+    space, FormFineLinearSystem() and RecoverFineFEMSolution() can be used with
+    vectors defined on the given space. */
+class PMultigridSolver : public GeometricMultigrid
+{
+public:
+   /// Function adding the integrators of the bilinear form to @a a.
+   typedef std::function<void(BilinearForm &a)> IntegratorBuilder;
+
+   /** @brief Construct the p-multigrid solver for the bilinear form described
+       by @a add_integrators on the H1 space @a fes, with the essential
+       boundary attributes @a ess_bdr.
+
+       @a coarse_order is the order on the coarsest level, and
+       @a smoother_order is the order of the Chebyshev smoothers. If @a fes is
+       a ParFiniteElementSpace, the levels are parallel spaces and forms. */
+   PMultigridSolver(const FiniteElementSpace &fes, const Array<int> &ess_bdr,
+                    IntegratorBuilder add_integrators, int coarse_order = 1,
+                    int smoother_order = 2);
+
+   /// Destructor
+   ~PMultigridSolver();
+
+   /// Returns the estimated largest eigenvalue of the diagonally
+   /// preconditioned operator at the given level, 0 < level < NumLevels().
+   real_t GetMaxEigenvalueEstimate(int level) const { return max_eig[level]; }
+
+protected:
+   const IntegratorBuilder add_integrators;
+   const int smoother_order;
+   Array<FiniteElementCollection*> collections;
+   Array<int> no_ess_tdofs;
+   Array<real_t> max_eig;
+   std::unique_ptr<Solver> coarse_prec;
+
+   /// Create the space hierarchy with orders p, p/2, ..., @a coarse_order.
+   static FiniteElementSpaceHierarchy *MakeHierarchy(
+      const FiniteElementSpace &fes, int coarse_order);
+
+   /// Returns the essential true dofs at the given level.
+   const Array<int> &GetEssentialTrueDofs(int level) const
+   {
+      return essentialTrueDofs.Size() ? *essentialTrueDofs[level]
+             : no_ess_tdofs;
+   }
+
+   /// Create the bilinear form at the given level and append it to #bfs.
+   void ConstructBilinearForm(int level, AssemblyLevel assembly);
+   void ConstructCoarseOperatorAndSolver();
+   void ConstructOperatorAndSmoother(int level);
+};
+
 } // namespace mfem
 
 #endif
@@ -25,7 +25,9 @@ PANonlinearFormExtension::PANonlinearFormExtension(const NonlinearForm *nlf):
    NonlinearFormExtension(nlf),
    fes(*nlf->FESpace()),
    dnfi(*nlf->GetDNFI()),
+   fnfi(nlf->GetInteriorFaceIntegrators()),
    elemR(nullptr),
+   int_face_restrict_lex(nullptr),
    Grad(*this)
 {
    if (!DeviceCanUseCeed())
@@ -38,6 +40,25 @@ PANonlinearFormExtension::PANonlinearFormExtension(const NonlinearForm *nlf):
    ye.UseDevice(true);
 }
 
+void PANonlinearFormExtension::SetupFaceRestriction()
+{
+   if (fnfi.Size() == 0)
+   {
+      int_face_restrict_lex = nullptr;
+      return;
+   }
+   MFEM_VERIFY(!DeviceCanUseCeed(),
+               "interior face integrators are not supported with libCEED");
+   int_face_restrict_lex =
+      fes.GetFaceRestriction(ElementDofOrdering::LEXICOGRAPHIC,
+                             FaceType::Interior);
+   int_face_X.SetSize(int_face_restrict_lex->Height(),
+                      Device::GetMemoryType());
+   int_face_Y.SetSize(int_face_restrict_lex->Height(),
+                      Device::GetMemoryType());
+   int_face_Y.UseDevice(true);
+}
+
 real_t PANonlinearFormExtension::GetGridFunctionEnergy(const Vector &x) const
 {
    real_t energy = 0.0;
@@ -52,11 +73,16 @@ real_t PANonlinearFormExtension::GetGridFunctionEnergy(const Vector &x) const
 
 void PANonlinearFormExtension::Assemble()
 {
-   MFEM_VERIFY(nlf->GetInteriorFaceIntegrators().Size() == 0 &&
-               nlf->GetBdrFaceIntegrators().Size() == 0,
-               "face integrators are not supported yet");
+   MFEM_VERIFY(nlf->GetBdrFaceIntegrators().Size() == 0,
+               "boundary face integrators are not supported yet");
 
    for (int i = 0; i < dnfi.Size(); ++i) { dnfi[i]->AssemblePA(fes); }
+
+   SetupFaceRestriction();
+   for (int i = 0; i < fnfi.Size(); ++i)
+   {
+      fnfi[i]->AssemblePAInteriorFaces(fes);
+   }
 }
 
 void PANonlinearFormExtension::Mult(const Vector &x, Vector &y) const
@@ -67,6 +93,17 @@ void PANonlinearFormExtension::Mult(const Vector &x, Vector &y) const
       elemR->Mult(x, xe);
       for (int i = 0; i < dnfi.Size(); ++i) { dnfi[i]->AddMultPA(xe, ye); }
       elemR->MultTranspose(ye, y);
+
+      if (int_face_restrict_lex)
+      {
+         int_face_Y = 0.0;
+         int_face_restrict_lex->Mult(x, int_face_X);
+         for (int i = 0; i < fnfi.Size(); ++i)
+         {
+            fnfi[i]->AddMultPAInteriorFaces(int_face_X, int_face_Y);
+         }
+         int_face_restrict_lex->AddMultTransposeInPlace(int_face_Y, y);
+      }
    }
    else
    {
@@ -91,6 +128,7 @@ void PANonlinearFormExtension::Update()
    elemR = fes.GetElementRestriction(ElementDofOrdering::LEXICOGRAPHIC);
    xe.SetSize(elemR->Height());
    ye.SetSize(elemR->Height());
+   SetupFaceRestriction();
    Grad.Update();
 }
 
@@ -100,6 +138,8 @@ PANonlinearFormExtension::Gradient::Gradient(const PANonlinearFormExtension &e):
 
 void PANonlinearFormExtension::Gradient::AssembleGrad(const Vector &g)
 {
+   MFEM_VERIFY(ext.fnfi.Size() == 0,
+               "the gradient of interior face integrators is not supported");
    ext.elemR->Mult(g, ext.xe);
    for (int i = 0; i < ext.dnfi.Size(); ++i)
    {
@@ -92,9 +92,15 @@ protected:
    mutable Vector xe, ye;
    const FiniteElementSpace &fes;
    const Array<NonlinearFormIntegrator*> &dnfi;
+   const Array<NonlinearFormIntegrator*> &fnfi;
    const Operator *elemR; // not owned
+   const FaceRestriction *int_face_restrict_lex; // not owned
+   mutable Vector int_face_X, int_face_Y;
    mutable Gradient Grad;
 
+   /// Setup the interior face restriction, if there are face integrators.
+   void SetupFaceRestriction();
+
 public:
    PANonlinearFormExtension(const NonlinearForm *nlf);
 
@@ -60,6 +60,20 @@ void NonlinearFormIntegrator::AssembleGradDiagonalPA(Vector &diag) const
                "   is not implemented for this class.");
 }
 
+void NonlinearFormIntegrator::AssemblePAInteriorFaces(
+   const FiniteElementSpace &fes)
+{
+   mfem_error ("NonlinearFormIntegrator::AssemblePAInteriorFaces(...)\n"
+               "   is not implemented for this class.");
+}
+
+void NonlinearFormIntegrator::AddMultPAInteriorFaces(const Vector &,
+                                                     Vector &) const
+{
+   mfem_error ("NonlinearFormIntegrator::AddMultPAInteriorFaces(...)\n"
+               "   is not implemented for this class.");
+}
+
 void NonlinearFormIntegrator::AssembleMF(const FiniteElementSpace &fes)
 {
    mfem_error ("NonlinearFormIntegrator::AssembleMF(...)\n"
@@ -135,6 +135,22 @@ public:
        @param[in,out] diag  The result Vector: $ diag += diag(G) $. */
    virtual void AssembleGradDiagonalPA(Vector &diag) const;
 
+   /// Method defining partial assembly on the interior faces.
+   /** The result of the partial assembly is stored internally so that it can be
+       used later in the method AddMultPAInteriorFaces(). */
+   virtual void AssemblePAInteriorFaces(const FiniteElementSpace &fes);
+
+   /// Method for partially assembled action on the interior faces.
+   /** Perform the action of the face terms of the integrator on the input @a x
+       and add the result to the output @a y. Both @a x and @a y are face
+       E-vectors with double-valued traces, see L2FaceValues::DoubleValued.
+
+       The method is separate from AddMultPA() so that the same integrator can
+       be added as both a domain and an interior face integrator. It can be
+       called only after the method AssemblePAInteriorFaces() has been
+       called. */
+   virtual void AddMultPAInteriorFaces(const Vector &x, Vector &y) const;
+
    /// Indicates whether this integrator can use a Ceed backend.
    virtual bool SupportsCeed() const { return false; }
 
@@ -319,6 +335,25 @@ private:
    //        output - the result of AssembleElementVector() (dof x dim).
    DenseMatrix DSh, DS, Jrt, Jpr, Jpt, P, PMatI, PMatO;
 
+   // PA extension
+   const FiniteElementSpace *fespace = nullptr;
+   const IntegrationRule *pa_ir = nullptr;
+   int dim, ne, nq, nd;
+   // Reference gradients of the shape functions in lexicographic order,
+   // (NQ x dim x ND).
+   Vector pa_G;
+   // Jrt (NQ x dim x dim x NE) and quadrature weights times det(Jtr) (NQ x NE).
+   Vector pa_data, pa_w;
+   // Weighted derivative of P with respect to Jpt, pulled back to the
+   // reference element, (dim x dim x dim x dim x NQ x NE).
+   Vector grad_data;
+   // Jpt and the weighted P Jrt^t at the quadrature points, (dim x dim x NQ x
+   // NE).
+   mutable Vector pa_F, pa_S;
+
+   /// Compute #pa_F from the E-vector @a x.
+   void ComputeDeformationGradientPA(const Vector &x) const;
+
 public:
    /** @param[in] m  HyperelasticModel that will be integrated. */
    HyperelasticNLFIntegrator(HyperelasticModel *m) : model(m) { }
@@ -338,6 +373,34 @@ public:
    void AssembleElementGrad(const FiniteElement &el,
                             ElementTransformation &Ttr,
                             const Vector &elfun, DenseMatrix &elmat) override;
+
+   using NonlinearFormIntegrator::AssemblePA;
+
+   /** @brief Setup the partial assembly data: the reference gradients of the
+       shape functions and the target (stress-free) geometry at the quadrature
+       points. The target configuration is given by the mesh of @a fes. */
+   void AssemblePA(const FiniteElementSpace &fes) override;
+
+   real_t GetLocalStateEnergyPA(const Vector &x) const override;
+
+   /** @brief Add the action of the integrator at the state @a x to @a y. Both
+       @a x and @a y are E-vectors; @a x contains the physical coordinates of
+       the deformed configuration. */
+   /** The deformation gradients are computed by device kernels, while the
+       HyperelasticModel is evaluated point-wise on the host. */
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   /** @brief Compute and store the derivative of the 1st Piola-Kirchhoff
+       stress at the quadrature points for the state @a x (an E-vector). */
+   /** The derivative is obtained from HyperelasticModel::AssembleH(), so any
+       model can be used. The action of the gradient and its diagonal are then
+       computed without forming element matrices. */
+   void AssembleGradPA(const Vector &x, const FiniteElementSpace &fes) override;
+
+   void AddMultGradPA(const Vector &x, Vector &y) const override;
+
+   void AssembleGradDiagonalPA(Vector &diag) const override;
+
 protected:
    const IntegrationRule* GetDefaultIntegrationRule(
       const FiniteElement& trial_fe,
@@ -22,7 +22,7 @@ namespace mfem
 static void NormalDerivativeSetupFaceIndexMap2D(
    int nf, int d, const Array<int>& face_to_elem, Array<int>& face_to_vol)
 {
-   const auto f2e = Reshape(face_to_elem.HostRead(), 2, 2, nf);
+   const auto f2e = Reshape(face_to_elem.HostRead(), 2, 3, nf);
    auto f2v = Reshape(face_to_vol.HostWrite(), d, 2, nf);
 
    for (int f = 0; f < nf; ++f)
@@ -32,6 +32,7 @@ static void NormalDerivativeSetupFaceIndexMap2D(
       for (int side = 0; side < 2; ++side)
       {
          const int el = f2e(side, 0, f);
+         const int orientation = f2e(side, 2, f);
 
          if (el < 0)
          {
@@ -45,7 +46,8 @@ static void NormalDerivativeSetupFaceIndexMap2D(
             for (int p = 0; p < d; ++p)
             {
                int i, j;
-               internal::FaceIdxToVolIdx2D(p, d, fid0, fid1, side, i, j);
+               internal::FaceIdxToVolIdx2D(p, d, fid0, fid1, side, orientation,
+                                           i, j);
 
                f2v(p, side, f) = i + d * j;
             }
@@ -112,42 +114,41 @@ L2NormalDerivativeFaceRestriction::L2NormalDerivativeFaceRestriction(
 
    if (dim == 2)
    {
-      // (el0, el1, fid0, fid1)
-      face_to_elem.SetSize(nf * 4);
       face_to_vol.SetSize(2 * nf * d);
    }
    else if (dim == 3)
    {
-      // (el0, el1, fid0, fid1, or0, or1)
-      face_to_elem.SetSize(nf * 6);
       face_to_vol.SetSize(2 * nf * d * d);
    }
    else
    {
       MFEM_ABORT("Unsupported dimension.");
    }
-   auto f2e = Reshape(face_to_elem.HostWrite(), 2, (dim == 2) ? 2 : 3, nf);
+   // (el0, el1, fid0, fid1, or0, or1)
+   face_to_elem.SetSize(nf * 6);
+   auto f2e = Reshape(face_to_elem.HostWrite(), 2, 3, nf);
 
-   // Populate the face_to_elem array. The elem_indicator will be used to count
-   // the number of elements that are adjacent to faces of the given type.
-   Array<int> elem_indicator(ne);
-   elem_indicator = 0;
+   // Populate the face_to_elem array. The elem_face_count will be used to
+   // count the number of faces of the given type adjacent to each local face
+   // of each element (more than one for the coarse side of nonconforming
+   // faces).
+   const int nfe = (dim == 2) ? 4 : 6; // number of faces per element
+   Array<int> elem_face_count(ne * nfe);
+   elem_face_count = 0;
 
    int f_ind = 0;
    for (int f = 0; f < fes.GetNF(); ++f)
    {
       Mesh::FaceInformation face = mesh.GetFaceInformation(f);
 
-      if (face.IsOfFaceType(face_type))
+      if (face.IsOfFaceType(face_type) && !face.IsNonconformingCoarse())
       {
          f2e(0, 0, f_ind) = face.element[0].index;
          f2e(0, 1, f_ind) = face.element[0].local_face_id;
-         if (dim == 3)
-         {
-            f2e(0, 2, f_ind) = face.element[0].orientation;
-         }
+         f2e(0, 2, f_ind) = face.element[0].orientation;
 
-         elem_indicator[face.element[0].index] = 1;
+         elem_face_count[face.element[0].index * nfe +
+                         face.element[0].local_face_id]++;
 
          if (face_type == FaceType::Interior)
          {
@@ -161,29 +162,23 @@ L2NormalDerivativeFaceRestriction::L2NormalDerivativeFaceRestriction(
             {
                // Face is not shared
                f2e(1, 0, f_ind) = el_idx_1;
-               elem_indicator[el_idx_1] = 1;
+               elem_face_count[el_idx_1 * nfe +
+                               face.element[1].local_face_id]++;
             }
             f2e(1, 1, f_ind) = face.element[1].local_face_id;
-
-            if (dim == 3)
-            {
-               f2e(1, 2, f_ind) = face.element[1].orientation;
-            }
+            f2e(1, 2, f_ind) = face.element[1].orientation;
          }
          else
          {
             f2e(1, 0, f_ind) = -1;
             f2e(1, 1, f_ind) = -1;
-
-            if (dim == 3)
-            {
-               f2e(1, 2, f_ind) = -1;
-            }
+            f2e(1, 2, f_ind) = -1;
          }
 
          f_ind++;
       }
    }
+   MFEM_VERIFY(f_ind == nf, "Unexpected number of faces.");
 
    // evaluate face to vol map
    if (dim == 2)
@@ -195,18 +190,49 @@ L2NormalDerivativeFaceRestriction::L2NormalDerivativeFaceRestriction(
       NormalDerivativeSetupFaceIndexMap3D(nf, d, face_to_elem, face_to_vol);
    }
 
+   // Number of layers: the maximum number of faces sharing the same local
+   // face of an element. The element e belongs to layer l if at least one of
+   // its local faces is adjacent to more than l faces.
+   int n_layers = 0;
+   Array<int> elem_layers(ne);
+   elem_layers = 0;
+   for (int e = 0; e < ne; ++e)
+   {
+      for (int i = 0; i < nfe; ++i)
+      {
+         elem_layers[e] = std::max(elem_layers[e], elem_face_count[e*nfe + i]);
+      }
+      n_layers = std::max(n_layers, elem_layers[e]);
+   }
+
+   // Row of element e in layer l of elem_to_face
+   Array<int> elem_row(n_layers * ne);
+   elem_row = -1;
+   elem_layer_offsets.SetSize(n_layers + 1);
+   elem_layer_offsets[0] = 0;
+   for (int l = 0; l < n_layers; ++l)
+   {
+      int row = elem_layer_offsets[l];
+      for (int e = 0; e < ne; ++e)
+      {
+         if (elem_layers[e] > l) { elem_row[l*ne + e] = row++; }
+      }
+      elem_layer_offsets[l + 1] = row;
+   }
+
    // Number of elements adjacent to faces of face_type
-   ne_type = elem_indicator.Sum();
+   ne_type = (n_layers > 0) ? elem_layer_offsets[1] : 0;
 
    // In 2D: (el, f0,f1,f2,f3, s0,s1,s2,s3)
    // In 3D: (el, f0,f1,f2,f3,f4,f5, s0,s1,s2,s3,s4,s5)
    const int elem_data_sz = (dim == 2) ? 9 : 13;
+   const int n_rows = elem_layer_offsets[n_layers];
 
-   elem_to_face.SetSize(elem_data_sz * ne_type);
+   elem_to_face.SetSize(elem_data_sz * n_rows);
    elem_to_face = -1;
 
-   auto e2f = Reshape(elem_to_face.HostWrite(), elem_data_sz, ne_type);
-   elem_indicator.PartialSum();
+   auto e2f = Reshape(elem_to_face.HostWrite(), elem_data_sz, n_rows);
+   elem_face_count = 0;
 
    const int nsides = (face_type == FaceType::Interior) ? 2 : 1;
    const int side_begin = (dim == 2) ? 5 : 7;
@@ -219,8 +245,9 @@ L2NormalDerivativeFaceRestriction::L2NormalDerivativeFaceRestriction(
          if (el < ne)
          {
             const int face_id = f2e(side, 1, f);
+            const int layer = elem_face_count[el*nfe + face_id]++;
 
-            const int e = elem_indicator[el] - 1;
+            const int e = elem_row[layer*ne + el];
             e2f(0, e) = el;
             e2f(1 + face_id, e) = f;
             e2f(side_begin + face_id, e) = side;
@@ -337,8 +364,8 @@ void L2NormalDerivativeFaceRestriction::Mult2D(const Vector &x, Vector &y) const
 
    // derivative of 1D basis function
    const auto G_ = Reshape(maps.G.Read(), q, d);
-   // (el0, el1, fid0, fid1)
-   const auto f2e = Reshape(face_to_elem.Read(), 2, 2, nf);
+   // (el0, el1, fid0, fid1, or0, or1)
+   const auto f2e = Reshape(face_to_elem.Read(), 2, 3, nf);
 
    const auto f2v = Reshape(face_to_vol.Read(), q, 2, nf);
 
@@ -569,8 +596,11 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose2D(
    // derivative of 1D basis function
    auto G_ = Reshape(maps.G.Read(), q, d);
 
+   const int n_layers = elem_layer_offsets.Size() - 1;
+   const int n_rows = elem_layer_offsets[n_layers];
+
    // entries of e2f: (el,f0,f1,f2,f3,s0,s1,s2,s3)
-   auto e2f = Reshape(elem_to_face.Read(), 9, ne_type);
+   auto e2f = Reshape(elem_to_face.Read(), 9, n_rows);
 
    auto f2v = Reshape(face_to_vol.Read(), d, 2, nf);
 
@@ -579,98 +609,119 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose2D(
    auto d_x = Reshape(x.ReadWrite(), t?vd:d, d, t?d:ne, t?ne:vd);
    auto d_y = Reshape(y.Read(), q, vd, 2, nf);
 
-   mfem::forall_2D(ne_type, d, d, [=] MFEM_HOST_DEVICE (int e)
+   // The layers are processed one after the other, so that each element is
+   // updated by at most one thread block at a time.
+   for (int layer = 0; layer < n_layers; ++layer)
    {
-      constexpr int MD = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      const int offset = elem_layer_offsets[layer];
+      const int ne_layer = elem_layer_offsets[layer + 1] - offset;
+
+      mfem::forall_2D(ne_layer, d, d, [=] MFEM_HOST_DEVICE (int e_layer)
+      {
+         constexpr int MD = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
 
-      MFEM_SHARED real_t y_s[MD];
-      MFEM_SHARED int pp[MD];
-      MFEM_SHARED int jj;
-      if (MFEM_THREAD_ID(x) == 0 && MFEM_THREAD_ID(y) == 0) { jj = 0; }
+         const int e = offset + e_layer;
 
-      MFEM_SHARED real_t BG[MD*MD];
-      DeviceMatrix G(BG, q, d);
+         MFEM_SHARED real_t y_s[MD];
+         MFEM_SHARED int pp[MD];
+         MFEM_SHARED int jj;
+         if (MFEM_THREAD_ID(x) == 0 && MFEM_THREAD_ID(y) == 0) { jj = 0; }
 
-      MFEM_SHARED real_t x_s[MD*MD];
-      DeviceMatrix xx(x_s, d, d);
+         MFEM_SHARED real_t BG[MD*MD];
+         DeviceMatrix G(BG, q, d);
 
-      MFEM_SHARED int el; // global element index
-      MFEM_SHARED int faces[4];
-      MFEM_SHARED int sides[4];
+         MFEM_SHARED real_t x_s[MD*MD];
+         DeviceMatrix xx(x_s, d, d);
 
-      MFEM_FOREACH_THREAD(i,x,d)
-      {
-         MFEM_FOREACH_THREAD(p,y,q)
+         MFEM_SHARED int el; // global element index
+         MFEM_SHARED int faces[4];
+         MFEM_SHARED int sides[4];
+
+         MFEM_FOREACH_THREAD(i,x,d)
          {
-            G(p,i) = a * G_(p,i);
-            xx(p,i) = 0.0;
+            MFEM_FOREACH_THREAD(p,y,q)
+            {
+               G(p,i) = a * G_(p,i);
+            }
          }
-      }
 
-      if (MFEM_THREAD_ID(y) == 0)
-      {
-         if (MFEM_THREAD_ID(x) == 0)
+         if (MFEM_THREAD_ID(y) == 0)
          {
-            el = e2f(0, e);
+            if (MFEM_THREAD_ID(x) == 0)
+            {
+               el = e2f(0, e);
+            }
+
+            MFEM_FOREACH_THREAD(i, x, 4)
+            {
+               faces[i] = e2f(1 + i, e);
+               sides[i] = e2f(5 + i, e);
+            }
          }
+         MFEM_SYNC_THREAD;
 
-         MFEM_FOREACH_THREAD(i, x, 4)
+         for (int c = 0; c < vd; ++c)
          {
-            faces[i] = e2f(1 + i, e);
-            sides[i] = e2f(5 + i, e);
-         }
-      }
-      MFEM_SYNC_THREAD;
+            MFEM_FOREACH_THREAD(k,x,d)
+            {
+               MFEM_FOREACH_THREAD(l,y,d)
+               {
+                  xx(k,l) = 0.0;
+               }
+            }
+            MFEM_SYNC_THREAD;
 
-      for (int face_id=0; face_id < 4; ++face_id)
-      {
-         const int f = faces[face_id];
+            for (int face_id=0; face_id < 4; ++face_id)
+            {
+               const int f = faces[face_id];
 
-         if (f < 0) { continue; }
+               if (f < 0) { continue; }
 
-         const int side = sides[face_id];
+               const int side = sides[face_id];
 
-         if (MFEM_THREAD_ID(y) == 0)
-         {
-            MFEM_FOREACH_THREAD(p,x,d)
-            {
-               y_s[p] = d_y(p, 0, side, f);
+               if (MFEM_THREAD_ID(y) == 0)
+               {
+                  MFEM_FOREACH_THREAD(p,x,d)
+                  {
+                     y_s[p] = d_y(p, c, side, f);
 
-               const int ij = f2v(p, side, f);
-               const int i = ij % q;
-               const int j = ij / q;
+                     const int ij = f2v(p, side, f);
+                     const int i = ij % q;
+                     const int j = ij / q;
 
-               pp[(face_id == 0 || face_id == 2) ? i : j] = p;
-               if (MFEM_THREAD_ID(x) == 0)
+                     pp[(face_id == 0 || face_id == 2) ? i : j] = p;
+                     if (MFEM_THREAD_ID(x) == 0)
+                     {
+                        jj = (face_id == 0 || face_id == 2) ? j : i;
+                     }
+                  }
+               }
+               MFEM_SYNC_THREAD;
+
+               MFEM_FOREACH_THREAD(k,x,d)
                {
-                  jj = (face_id == 0 || face_id == 2) ? j : i;
+                  MFEM_FOREACH_THREAD(l,y,d)
+                  {
+                     const int p = (face_id == 0 || face_id == 2) ? pp[k] : pp[l];
+                     const int kk = (face_id == 0 || face_id == 2) ? l : k;
+                     const real_t g = G(jj, kk);
+                     xx(k,l) += g * y_s[p];
+                  }
                }
+               MFEM_SYNC_THREAD;
             }
-         }
-         MFEM_SYNC_THREAD;
 
-         MFEM_FOREACH_THREAD(k,x,d)
-         {
-            MFEM_FOREACH_THREAD(l,y,d)
+            MFEM_FOREACH_THREAD(k,x,d)
             {
-               const int p = (face_id == 0 || face_id == 2) ? pp[k] : pp[l];
-               const int kk = (face_id == 0 || face_id == 2) ? l : k;
-               const real_t g = G(jj, kk);
-               xx(k,l) += g * y_s[p];
+               MFEM_FOREACH_THREAD(l,y,d)
+               {
+                  d_x(t?c:k, t?k:l, t?l:el, t?el:c) += xx(k,l);
+               }
             }
+            MFEM_SYNC_THREAD;
          }
-      }
-      MFEM_SYNC_THREAD;
-
-      MFEM_FOREACH_THREAD(k,x,d)
-      {
-         MFEM_FOREACH_THREAD(l,y,d)
-         {
-            const int c = 0;
-            d_x(t?c:k, t?k:l, t?l:el, t?el:c) += xx(k,l);
-         }
-      }
-   });
+      });
+   }
 }
 
 template <int T_D1D>
@@ -680,8 +731,6 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose3D(
    const int vd = fes.GetVDim();
    const bool t = fes.GetOrdering() == Ordering::byVDIM;
 
-   MFEM_VERIFY(vd == 1, "vdim > 1 not supported.");
-
    const FiniteElement &fe = *fes.GetTypicalFE();
    const DofToQuad &maps = fe.GetDofToQuad(fe.GetNodes(), DofToQuad::TENSOR);
 
@@ -694,135 +743,151 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose3D(
 
    auto G_ = Reshape(maps.G.Read(), q, d);
 
+   const int n_layers = elem_layer_offsets.Size() - 1;
+   const int n_rows = elem_layer_offsets[n_layers];
+
    // (el, f0,f1,f2,f3,f4,f5, s0,s1,s2,s3,s4,s5)
-   auto e2f = Reshape(elem_to_face.Read(), 13, ne_type);
+   auto e2f = Reshape(elem_to_face.Read(), 13, n_rows);
 
    auto f2v = Reshape(face_to_vol.Read(), q2d, 2, nf);
 
    auto d_x = Reshape(x.ReadWrite(), t?vd:d, d, d, t?d:ne, t?ne:vd);
    const auto d_y = Reshape(y.Read(), q2d, vd, 2, nf);
 
-   mfem::forall_2D(ne_type, q, q, [=] MFEM_HOST_DEVICE (int e) -> void
+   // The layers are processed one after the other, so that each element is
+   // updated by at most one thread block at a time.
+   for (int layer = 0; layer < n_layers; ++layer)
    {
-      static constexpr int MD = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      const int offset = elem_layer_offsets[layer];
+      const int ne_layer = elem_layer_offsets[layer + 1] - offset;
 
-      MFEM_SHARED int pp[MD][MD];
-      MFEM_SHARED real_t y_s[MD*MD];
-      MFEM_SHARED int jj;
-      if (MFEM_THREAD_ID(x) == 0 && MFEM_THREAD_ID(y) == 0) { jj = 0; }
+      mfem::forall_2D(ne_layer, q, q, [=] MFEM_HOST_DEVICE (int e_layer) -> void
+      {
+         static constexpr int MD = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
 
-      MFEM_SHARED real_t xx_s[MD*MD*MD];
-      auto xx = Reshape(xx_s, d, d, d);
+         const int e = offset + e_layer;
 
-      MFEM_SHARED real_t G_s[MD*MD];
-      DeviceMatrix G(G_s, q, d);
+         MFEM_SHARED int pp[MD][MD];
+         MFEM_SHARED real_t y_s[MD*MD];
+         MFEM_SHARED int jj;
+         if (MFEM_THREAD_ID(x) == 0 && MFEM_THREAD_ID(y) == 0) { jj = 0; }
 
-      MFEM_SHARED int el;
-      MFEM_SHARED int faces[6];
-      MFEM_SHARED int sides[6];
+         MFEM_SHARED real_t xx_s[MD*MD*MD];
+         auto xx = Reshape(xx_s, d, d, d);
 
-      // Load G into shared memory
-      MFEM_FOREACH_THREAD(j, x, d)
-      {
-         MFEM_FOREACH_THREAD(i, y, q)
-         {
-            G(i, j) = a * G_(i, j);
-            G(i, j) = a * G_(i, j);
-            G(i, j) = a * G_(i, j);
-         }
-      }
+         MFEM_SHARED real_t G_s[MD*MD];
+         DeviceMatrix G(G_s, q, d);
 
-      if (MFEM_THREAD_ID(y) == 0)
-      {
-         if (MFEM_THREAD_ID(x) == 0)
-         {
-            el = e2f(0, e); // global element index
-         }
+         MFEM_SHARED int el;
+         MFEM_SHARED int faces[6];
+         MFEM_SHARED int sides[6];
 
-         MFEM_FOREACH_THREAD(i, x, 6)
+         // Load G into shared memory
+         MFEM_FOREACH_THREAD(j, x, d)
          {
-            faces[i] = e2f(1 + i, e);
-            sides[i] = e2f(7 + i, e);
+            MFEM_FOREACH_THREAD(i, y, q)
+            {
+               G(i, j) = a * G_(i, j);
+            }
          }
-      }
 
-      MFEM_FOREACH_THREAD(k, x, d)
-      {
-         MFEM_FOREACH_THREAD(j, y, d)
+         if (MFEM_THREAD_ID(y) == 0)
          {
-            for (int i = 0; i < d; ++i)
+            if (MFEM_THREAD_ID(x) == 0)
             {
-               xx(i, j, k) = 0.0;
+               el = e2f(0, e); // global element index
             }
-         }
-      }
-      MFEM_SYNC_THREAD;
 
-      for (int face_id = 0; face_id < 6; ++face_id)
-      {
-         const int f = faces[face_id];
+            MFEM_FOREACH_THREAD(i, x, 6)
+            {
+               faces[i] = e2f(1 + i, e);
+               sides[i] = e2f(7 + i, e);
+            }
+         }
+         MFEM_SYNC_THREAD;
 
-         if (f < 0)
+         for (int c = 0; c < vd; ++c)
          {
-            continue;
-         }
+            MFEM_FOREACH_THREAD(k, x, d)
+            {
+               MFEM_FOREACH_THREAD(j, y, d)
+               {
+                  for (int i = 0; i < d; ++i)
+                  {
+                     xx(i, j, k) = 0.0;
+                  }
+               }
+            }
+            MFEM_SYNC_THREAD;
 
-         const int side = sides[face_id];
+            for (int face_id = 0; face_id < 6; ++face_id)
+            {
+               const int f = faces[face_id];
 
-         // is this face parallel to the x-y plane in reference coordinates?
-         const bool xy_plane = (face_id == 0 || face_id == 5);
-         const bool xz_plane = (face_id == 1 || face_id == 3);
+               if (f < 0)
+               {
+                  continue;
+               }
 
-         MFEM_FOREACH_THREAD(p1, x, q)
-         {
-            MFEM_FOREACH_THREAD(p2, y, q)
-            {
-               const int p = p1 + q * p2;
-               y_s[p] = d_y(p, 0, side, f);
+               const int side = sides[face_id];
 
-               const int ijk = f2v(p, side, f);
-               const int k = ijk / q2d;
-               const int i = ijk % q;
-               const int j = (ijk - q2d*k) / q;
+               // is this face parallel to the x-y plane in reference
+               // coordinates?
+               const bool xy_plane = (face_id == 0 || face_id == 5);
+               const bool xz_plane = (face_id == 1 || face_id == 3);
 
-               pp[(xy_plane || xz_plane) ? i : j][(xy_plane) ? j : k] = p;
-               if (MFEM_THREAD_ID(x) == 0 && MFEM_THREAD_ID(y) == 0)
+               MFEM_FOREACH_THREAD(p1, x, q)
                {
-                  jj = (xy_plane) ? k : (xz_plane) ? j : i;
+                  MFEM_FOREACH_THREAD(p2, y, q)
+                  {
+                     const int p = p1 + q * p2;
+                     y_s[p] = d_y(p, c, side, f);
+
+                     const int ijk = f2v(p, side, f);
+                     const int k = ijk / q2d;
+                     const int i = ijk % q;
+                     const int j = (ijk - q2d*k) / q;
+
+                     pp[(xy_plane || xz_plane) ? i : j][(xy_plane) ? j : k] = p;
+                     if (MFEM_THREAD_ID(x) == 0 && MFEM_THREAD_ID(y) == 0)
+                     {
+                        jj = (xy_plane) ? k : (xz_plane) ? j : i;
+                     }
+                  }
                }
-            }
-         }
-         MFEM_SYNC_THREAD;
+               MFEM_SYNC_THREAD;
 
-         MFEM_FOREACH_THREAD(n, x, d)
-         {
-            MFEM_FOREACH_THREAD(m, y, d)
-            {
-               for (int l = 0; l < d; ++l)
+               MFEM_FOREACH_THREAD(n, x, d)
                {
-                  const int p = (xy_plane) ? pp[l][m] : (xz_plane) ? pp[l][n] : pp[m][n];
-                  const int kk = (xy_plane) ? n : (xz_plane) ? m : l;
-                  const real_t g = G(jj, kk);
-                  xx(l, m, n) += g * y_s[p];
+                  MFEM_FOREACH_THREAD(m, y, d)
+                  {
+                     for (int l = 0; l < d; ++l)
+                     {
+                        const int p = (xy_plane) ? pp[l][m] : (xz_plane) ? pp[l][n] : pp[m][n];
+                        const int kk = (xy_plane) ? n : (xz_plane) ? m : l;
+                        const real_t g = G(jj, kk);
+                        xx(l, m, n) += g * y_s[p];
+                     }
+                  }
                }
+               MFEM_SYNC_THREAD;
             }
-         }
-      }
-      MFEM_SYNC_THREAD;
 
-      // map back to global array
-      MFEM_FOREACH_THREAD(n, x, d)
-      {
-         MFEM_FOREACH_THREAD(m, y, d)
-         {
-            for (int l = 0; l < d; ++l)
+            // map back to global array
+            MFEM_FOREACH_THREAD(n, x, d)
             {
-               const int c = 0;
-               d_x(t?c:l, t?l:m, t?m:n, t?n:el, t?el:c) += xx(l, m, n);
+               MFEM_FOREACH_THREAD(m, y, d)
+               {
+                  for (int l = 0; l < d; ++l)
+                  {
+                     d_x(t?c:l, t?l:m, t?m:n, t?n:el, t?el:c) += xx(l, m, n);
+                  }
+               }
             }
+            MFEM_SYNC_THREAD;
          }
-      }
-   });
+      });
+   }
 }
 
 } // namespace mfem
@@ -34,6 +34,13 @@ protected:
 
    Array<int> face_to_elem; ///< Face-wise information array.
    Array<int> elem_to_face; ///< Element-wise information array.
+   /// @brief Offsets of the layers of @a elem_to_face.
+   ///
+   /// On nonconforming meshes, the coarse element of a nonconforming face is
+   /// adjacent to several faces through the same local face. Such elements
+   /// are repeated in the subsequent layers of @a elem_to_face, each element
+   /// appearing at most once per layer.
+   Array<int> elem_layer_offsets;
    Array<int> face_to_vol; ///< maps face index to volume index
 
 public:
@@ -329,6 +329,43 @@ void ParBilinearForm::AssembleDiagonal(Vector &diag) const
    }
 }
 
+void ParBilinearForm::AssembleBlockDiagonal(DenseTensor &blocks,
+                                            Array<int> &block_dofs) const
+{
+   const Operator *P = fes->GetProlongationMatrix();
+   Vector local_cols;
+   if (ext)
+   {
+      ext->AssembleBlockDiagonal(local_cols);
+   }
+   else
+   {
+      MFEM_ASSERT(mat, "the ParBilinearForm is not assembled!");
+      GetBlockDiagonalColumns(*mat, local_cols);
+   }
+   if (IsIdentityProlongation(P))
+   {
+      BlockDiagonalFromColumns(local_cols, blocks, block_dofs);
+      return;
+   }
+   const HypreParMatrix *HP = dynamic_cast<const HypreParMatrix*>(P);
+   MFEM_VERIFY(fes->Conforming() || HP,
+               "unsupported prolongation matrix type.");
+   const int vdim = fes->GetVDim();
+   const int n = P->Height(), m = P->Width();
+   Vector cols(vdim*m);
+   for (int c = 0; c < vdim; c++)
+   {
+      Vector lc, tc;
+      lc.MakeRef(local_cols, c*n, n);
+      tc.MakeRef(cols, c*m, m);
+      if (fes->Conforming()) { P->MultTranspose(lc, tc); }
+      else { HP->AbsMultTranspose(1.0, lc, 0.0, tc); }
+      tc.SyncAliasMemory(cols);
+   }
+   BlockDiagonalFromColumns(cols, blocks, block_dofs);
+}
+
 void ParBilinearForm
 ::ParallelEliminateEssentialBC(const Array<int> &bdr_attr_is_ess,
                                HypreParMatrix &A, const HypreParVector &X,
@@ -101,6 +101,14 @@ public:
        diagonal for this case. */
    void AssembleDiagonal(Vector &diag) const override;
 
+   /** @brief Assemble the nodal block diagonal of the true-dof matrix, see
+       BilinearForm::AssembleBlockDiagonal().
+
+       The local blocks are reduced with P^T, or with |P^T| when the mesh is
+       nonconforming, see AssembleDiagonal(). */
+   void AssembleBlockDiagonal(DenseTensor &blocks,
+                              Array<int> &block_dofs) const override;
+
    /// Returns the matrix assembled on the true dofs, i.e. P^t A P.
    /** The returned matrix is the internal one, owned by the form. It is not
        reassembled if it has been already constructed. If FormSystemMatrix()
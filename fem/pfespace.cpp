@@ -3668,8 +3668,8 @@ int ParFiniteElementSpace
          const NCMesh::NCList &list = pncmesh->GetNCList(entity);
          if (list.masters.Size() == 0) { continue; }
 
-         IsoparametricTransformation T;
-         DenseMatrix I;
+         // slaves at the same position share their interpolation matrix
+         NCTransferMatrices transfer(list);
 
          // process masters that we own or that affect our edges/faces
          for (const auto &mf : list.masters)
@@ -3714,14 +3714,6 @@ int ParFiniteElementSpace
 
             if (fe == nullptr) { continue; }
 
-            switch (mf.Geom())
-            {
-               case Geometry::SQUARE:   T.SetFE(&QuadrilateralFE); break;
-               case Geometry::TRIANGLE: T.SetFE(&TriangleFE); break;
-               case Geometry::SEGMENT:  T.SetFE(&SegmentFE); break;
-               default: MFEM_ABORT("unsupported geometry");
-            }
-
             // constrain slaves that exist in our mesh
             for (int si = mf.slaves_begin; si < mf.slaves_end; si++)
             {
@@ -3732,10 +3724,8 @@ int ParFiniteElementSpace
                const int q = GetEntityDofs(entity, sf.index, slave_dofs, mf.Geom(), variant);
                if (q < 0) { break; }
 
-               list.OrientedPointMatrix(sf, T.GetPointMat());
-
                const auto *slave_fe = fec->GetFE(mf.Geom(), q);
-               slave_fe->GetTransferMatrix(*fe, T, I);
+               const DenseMatrix &I = transfer.Get(sf, *fe, *slave_fe);
 
                // make each slave DOF dependent on all master DOFs
                AddDependencies(deps, master_dofs, slave_dofs, I);
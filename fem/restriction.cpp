@@ -313,6 +313,13 @@ static MFEM_HOST_DEVICE int GetMinElt(const int *my_elts, const int nbElts,
    return min_el;
 }
 
+/** Returns the (unsigned) index of a dof index that may be encoded as -1-i to
+    indicate a negative orientation (e.g. in H(curl) and H(div) spaces). */
+static MFEM_HOST_DEVICE int DecodeDof(const int i)
+{
+   return (i >= 0) ? i : -1-i;
+}
+
 /** Returns the index where a non-zero entry should be added and increment the
     number of non-zeros for the row i_L. */
 static MFEM_HOST_DEVICE int GetAndIncrementNnzIndex(const int i_L, int* I)
@@ -344,7 +351,7 @@ int ElementRestriction::FillI(SparseMatrix &mat) const
       const int i = l_dof%elt_dofs;
 
       const int i_gm = e*elt_dofs + i;
-      const int i_L = d_gather_map[i_gm];
+      const int i_L = DecodeDof(d_gather_map[i_gm]);
       const int i_offset = d_offsets[i_L];
       const int i_next_offset = d_offsets[i_L+1];
       const int i_nbElts = i_next_offset - i_offset;
@@ -352,13 +359,13 @@ int ElementRestriction::FillI(SparseMatrix &mat) const
       int *i_elts = &d_ij_elts(i_offset, 0);
       for (int e_i = 0; e_i < i_nbElts; ++e_i)
       {
-         const int i_E = d_indices[i_offset+e_i];
+         const int i_E = DecodeDof(d_indices[i_offset+e_i]);
          i_elts[e_i] = i_E/elt_dofs;
       }
       for (int j = 0; j < elt_dofs; j++)
       {
          const int j_gm = e*elt_dofs + j;
-         const int j_L = d_gather_map[j_gm];
+         const int j_L = DecodeDof(d_gather_map[j_gm]);
          const int j_offset = d_offsets[j_L];
          const int j_next_offset = d_offsets[j_L+1];
          const int j_nbElts = j_next_offset - j_offset;
@@ -371,7 +378,7 @@ int ElementRestriction::FillI(SparseMatrix &mat) const
             int *j_elts = &d_ij_elts(j_offset, 1);
             for (int e_j = 0; e_j < j_nbElts; ++e_j)
             {
-               const int j_E = d_indices[j_offset+e_j];
+               const int j_E = DecodeDof(d_indices[j_offset+e_j]);
                const int elt = j_E/elt_dofs;
                j_elts[e_j] = elt;
             }
@@ -421,31 +428,36 @@ void ElementRestriction::FillJAndData(const Vector &ea_data,
       const int i = l_dof%elt_dofs;
 
       const int i_gm = e*elt_dofs + i;
-      const int i_L = d_gather_map[i_gm];
+      const int i_sL = d_gather_map[i_gm];
+      const int i_L = DecodeDof(i_sL);
       const int i_offset = d_offsets[i_L];
       const int i_next_offset = d_offsets[i_L+1];
       const int i_nbElts = i_next_offset - i_offset;
 
+      // The local dof index i_B is stored with the sign of the local dof
       int *i_elts = &d_ij_B_el(i_offset, 0);
       int *i_B = &d_ij_B_el(i_offset, 1);
       for (int e_i = 0; e_i < i_nbElts; ++e_i)
       {
-         const int i_E = d_indices[i_offset+e_i];
+         const int i_sE = d_indices[i_offset+e_i];
+         const int i_E = DecodeDof(i_sE);
          i_elts[e_i] = i_E/elt_dofs;
-         i_B[e_i]    = i_E%elt_dofs;
+         i_B[e_i]    = (i_sE >= 0) ? i_E%elt_dofs : -1-i_E%elt_dofs;
       }
       for (int j = 0; j < elt_dofs; j++)
       {
          const int j_gm = e*elt_dofs + j;
-         const int j_L = d_gather_map[j_gm];
+         const int j_sL = d_gather_map[j_gm];
+         const int j_L = DecodeDof(j_sL);
          const int j_offset = d_offsets[j_L];
          const int j_next_offset = d_offsets[j_L+1];
          const int j_nbElts = j_next_offset - j_offset;
          if (i_nbElts == 1 || j_nbElts == 1) // no assembly required
          {
             const int nnz = GetAndIncrementNnzIndex(i_L, I);
+            const bool plus = (i_sL >= 0) == (j_sL >= 0);
             J[nnz] = j_L;
-            Data[nnz] = mat_ea(j,i,e);
+            Data[nnz] = plus ? mat_ea(j,i,e) : -mat_ea(j,i,e);
          }
          else // assembly required
          {
@@ -453,10 +465,11 @@ void ElementRestriction::FillJAndData(const Vector &ea_data,
             int *j_B = &d_ij_B_el(j_offset, 3);
             for (int e_j = 0; e_j < j_nbElts; ++e_j)
             {
-               const int j_E = d_indices[j_offset+e_j];
+               const int j_sE = d_indices[j_offset+e_j];
+               const int j_E = DecodeDof(j_sE);
                const int elt = j_E/elt_dofs;
                j_elts[e_j] = elt;
-               j_B[e_j]    = j_E%elt_dofs;
+               j_B[e_j]    = (j_sE >= 0) ? j_E%elt_dofs : -1-j_E%elt_dofs;
             }
             int min_e = GetMinElt(i_elts, i_nbElts, j_elts, j_nbElts);
             if (e == min_e) // add the nnz only once
@@ -465,14 +478,18 @@ void ElementRestriction::FillJAndData(const Vector &ea_data,
                for (int k = 0; k < i_nbElts; k++)
                {
                   const int e_i = i_elts[k];
-                  const int i_Bloc = i_B[k];
+                  const int i_sBloc = i_B[k];
+                  const int i_Bloc = DecodeDof(i_sBloc);
                   for (int l = 0; l < j_nbElts; l++)
                   {
                      const int e_j = j_elts[l];
-                     const int j_Bloc = j_B[l];
+                     const int j_sBloc = j_B[l];
+                     const int j_Bloc = DecodeDof(j_sBloc);
                      if (e_i == e_j)
                      {
-                        val += mat_ea(j_Bloc, i_Bloc, e_i);
+                        const bool plus = (i_sBloc >= 0) == (j_sBloc >= 0);
+                        const real_t val_ij = mat_ea(j_Bloc, i_Bloc, e_i);
+                        val += plus ? val_ij : -val_ij;
                      }
                   }
                }
@@ -42,6 +42,22 @@ struct Hashed4
    int next;
 };
 
+/** A concept for items that should be used in OpenHashTable and be accessible
+ *  by hashing two IDs. Unlike Hashed2, there is no link to the next item.
+ */
+struct OpenHashed2
+{
+   int p1, p2;
+};
+
+/** A concept for items that should be used in OpenHashTable and be accessible
+ *  by hashing four IDs.
+ */
+struct OpenHashed4
+{
+   int p1, p2, p3; // NOTE: p4 is neither hashed nor stored
+};
+
 
 /** HashTable is a container for items that require associative access through
  *  pairs (or quadruples) of indices:
@@ -457,6 +473,239 @@ protected:
    int BinSize(int idx) const;
 };
 
+/** OpenHashTable is an alternative to HashTable with the same interface, where
+ *  the hash table uses open addressing with linear probing instead of linked
+ *  lists of items.
+ *
+ *  The hash values of the keys and the ids of the items are stored in the
+ *  slots of the table, in separate (structure of arrays) hash and id arrays. A
+ *  lookup scans a few consecutive slots and only accesses the items whose hash
+ *  value matches, instead of following the links stored in the items of a bin.
+ *  The items do not need a link to the next item, i.e. the type T can follow
+ *  the OpenHashed2 or OpenHashed4 concept (Hashed2 and Hashed4 items also
+ *  work).
+ *
+ *  Notes:
+ *   - The keys are nonnegative. Unused items are marked with p1 = -1.
+ *   - The table is kept at most 3/4 full, and deleted slots are filled by
+ *     shifting back the following slots of the probe sequence, so there are
+ *     no "deleted" markers.
+ */
+template<typename T>
+class OpenHashTable : public BlockArray<T>
+{
+protected:
+   typedef BlockArray<T> Base;
+
+   /// Number of stored key parts: 3 for the Hashed4 concepts, 2 otherwise.
+   static constexpr int K = (std::is_base_of<OpenHashed4, T>::value ||
+                             std::is_base_of<Hashed4, T>::value) ? 3 : 2;
+
+public:
+   /** @brief Main constructor of the OpenHashTable class.
+
+       @param[in] block_size The size of the storage blocks of the underlying
+                             BlockArray<T>.
+       @param[in] init_hash_size The initial number of slots of the hash
+                                 table. Must be a power of 2. */
+   OpenHashTable(int block_size = 16*1024, int init_hash_size = 32*1024);
+   /// Deep copy
+   OpenHashTable(const OpenHashTable& other) = default;
+   /// Copy assignment not supported
+   OpenHashTable& operator=(const OpenHashTable&) = delete;
+
+   /// See HashTable::Get(int, int).
+   T* Get(int p1, int p2) { return &(Base::At(GetId(p1, p2))); }
+
+   /// See HashTable::Get(int, int, int, int).
+   T* Get(int p1, int p2, int p3, int p4 = -1)
+   { return &(Base::At(GetId(p1, p2, p3, p4))); }
+
+   /// See HashTable::GetId(int, int).
+   int GetId(int p1, int p2) { return GetId(Key(p1, p2, -1, -1)); }
+
+   /// See HashTable::GetId(int, int, int, int).
+   int GetId(int p1, int p2, int p3, int p4 = -1)
+   { return GetId(Key(p1, p2, p3, p4)); }
+
+   /// See HashTable::Find(int, int).
+   T* Find(int p1, int p2)
+   {
+      const int id = FindId(p1, p2);
+      return (id >= 0) ? &(Base::At(id)) : NULL;
+   }
+
+   /// See HashTable::Find(int, int, int, int).
+   T* Find(int p1, int p2, int p3, int p4 = -1)
+   {
+      const int id = FindId(p1, p2, p3, p4);
+      return (id >= 0) ? &(Base::At(id)) : NULL;
+   }
+
+   /// See HashTable::Find(int, int).
+   const T* Find(int p1, int p2) const
+   {
+      const int id = FindId(p1, p2);
+      return (id >= 0) ? &(Base::At(id)) : NULL;
+   }
+
+   /// See HashTable::Find(int, int, int, int).
+   const T* Find(int p1, int p2, int p3, int p4 = -1) const
+   {
+      const int id = FindId(p1, p2, p3, p4);
+      return (id >= 0) ? &(Base::At(id)) : NULL;
+   }
+
+   /// See HashTable::FindId(int, int).
+   int FindId(int p1, int p2) const
+   { return slot_ids[FindSlot(Key(p1, p2, -1, -1))]; }
+
+   /// See HashTable::FindId(int, int, int, int).
+   int FindId(int p1, int p2, int p3, int p4 = -1) const
+   { return slot_ids[FindSlot(Key(p1, p2, p3, p4))]; }
+
+   /// Return the number of elements currently stored in the OpenHashTable.
+   int Size() const { return Base::Size() - unused.Size(); }
+
+   /// Return the total number of ids (used and unused) in the OpenHashTable.
+   int NumIds() const { return Base::Size(); }
+
+   /// Return the number of free/unused ids in the OpenHashTable.
+   int NumFreeIds() const { return unused.Size(); }
+
+   /// See HashTable::IdExists().
+   bool IdExists(int id) const { return (Base::At(id).p1 >= 0); }
+
+   /// See HashTable::Delete().
+   void Delete(int id);
+
+   /// Remove all items.
+   void DeleteAll();
+
+   /// See HashTable::Alloc().
+   void Alloc(int id, int p1, int p2);
+
+   /// See HashTable::UpdateUnused().
+   void UpdateUnused();
+
+   /// See HashTable::Reparent(int, int, int).
+   void Reparent(int id, int new_p1, int new_p2)
+   { Reparent(id, Key(new_p1, new_p2, -1, -1)); }
+
+   /// See HashTable::Reparent(int, int, int, int, int).
+   void Reparent(int id, int new_p1, int new_p2, int new_p3, int new_p4 = -1)
+   { Reparent(id, Key(new_p1, new_p2, new_p3, new_p4)); }
+
+   /// Return total size of allocated memory (tables plus items), in bytes.
+   std::size_t MemoryUsage() const;
+
+   /// Write details of the memory usage to the mfem output stream.
+   void PrintMemoryDetail() const;
+
+   /// Print a histogram of the probe lengths for debugging purposes.
+   void PrintStats() const;
+
+   class iterator : public Base::iterator
+   {
+   protected:
+      friend class OpenHashTable;
+      typedef typename Base::iterator base;
+
+      iterator() { }
+      iterator(const base &it) : base(it)
+      {
+         while (base::good() && (*this)->p1 < 0) { base::next(); }
+      }
+
+   public:
+      iterator &operator++()
+      {
+         while (base::next(), base::good() && (*this)->p1 < 0) { }
+         return *this;
+      }
+   };
+
+   class const_iterator : public Base::const_iterator
+   {
+   protected:
+      friend class OpenHashTable;
+      typedef typename Base::const_iterator base;
+
+      const_iterator() { }
+      const_iterator(const base &it) : base(it)
+      {
+         while (base::good() && (*this)->p1 < 0) { base::next(); }
+      }
+
+   public:
+      const_iterator &operator++()
+      {
+         while (base::next(), base::good() && (*this)->p1 < 0) { }
+         return *this;
+      }
+   };
+
+   iterator begin() { return iterator(Base::begin()); }
+   iterator end() { return iterator(); }
+   const_iterator begin() const { return const_iterator(Base::cbegin()); }
+   const_iterator end() const { return const_iterator(); }
+
+   const_iterator cbegin() const { return const_iterator(Base::cbegin()); }
+   const_iterator cend() const { return const_iterator(); }
+
+protected:
+   /// The sorted parts of a key, p3 = -1 for items with two key parts.
+   struct KeyType { int p[3]; };
+
+   /// The (31-bit) hash values of the keys of the items in the slots.
+   Array<int> slot_hash;
+
+   /// The ids of the items in the slots, -1 for empty slots.
+   Array<int> slot_ids;
+
+   /// mask = number of slots - 1, and shift = 31 - log2(number of slots).
+   int mask, shift;
+
+   /// List of deleted items in the BlockArray<T>, see HashTable::unused.
+   Array<int> unused;
+
+   /// Sort the parts of a key, see HashTable::GetId().
+   static KeyType Key(int p1, int p2, int p3, int p4);
+
+   /// Return the key of an item.
+   static KeyType ItemKey(const T &item);
+
+   /// Set the key of an item.
+   static void SetItemKey(T &item, const KeyType &key);
+
+   /** @brief Return the 31-bit hash value of a key. Its upper bits are the
+       first slot of the probe sequence of the key. */
+   static inline int Hash(const KeyType &key);
+
+   /// Return true if the item @a id has the key @a key.
+   inline bool ItemHasKey(int id, const KeyType &key) const;
+
+   /** @brief Return the slot containing @a key, or the empty slot ending its
+       probe sequence if the key is not in the table. */
+   inline int FindSlot(const KeyType &key) const;
+
+   /// Store the item @a id with the given hash value in the empty @a slot.
+   inline void SetSlot(int slot, int id, int hash);
+
+   /// Empty the slot containing the item @a id, which must be in the table.
+   void RemoveSlot(int id);
+
+   int GetId(const KeyType &key);
+   void Reparent(int id, const KeyType &key);
+
+   /// Double the number of slots if the table is more than 3/4 full.
+   inline void CheckRehash();
+
+   /// Reinsert all the items into a table with @a num_slots slots.
+   void DoRehash(int num_slots);
+};
+
+
 /// Hash function for data sequences.
 /** Depends on GnuTLS for SHA-256 hashing. */
 class HashFunction
@@ -597,6 +846,19 @@ inline void sort4_ext(int &a, int &b, int &c, int &d)
    }
 }
 
+// Access to the third key part of the items of an OpenHashTable
+template<int K> struct OpenHashKey3
+{
+   template<typename T> static int Get(const T &) { return -1; }
+   template<typename T> static void Set(T &, int) { }
+};
+
+template<> struct OpenHashKey3<3>
+{
+   template<typename T> static int Get(const T &item) { return item.p3; }
+   template<typename T> static void Set(T &item, int p3) { item.p3 = p3; }
+};
+
 } // internal
 
 template<typename T>
@@ -936,6 +1198,265 @@ void HashTable<T>::PrintStats() const
    }
 }
 
+template<typename T>
+OpenHashTable<T>::OpenHashTable(int block_size, int init_hash_size)
+   : Base(block_size)
+{
+   MFEM_VERIFY(init_hash_size > 1 && !(init_hash_size & (init_hash_size-1)),
+               "init_size must be a power of two.");
+   DoRehash(init_hash_size);
+}
+
+template<typename T>
+typename OpenHashTable<T>::KeyType
+OpenHashTable<T>::Key(int p1, int p2, int p3, int p4)
+{
+   if (K == 2)
+   {
+      if (p1 > p2) { std::swap(p1, p2); }
+      return KeyType{{p1, p2, -1}};
+   }
+   internal::sort4_ext(p1, p2, p3, p4);
+   return KeyType{{p1, p2, p3}};
+}
+
+template<typename T>
+typename OpenHashTable<T>::KeyType
+OpenHashTable<T>::ItemKey(const T &item)
+{
+   return KeyType{{item.p1, item.p2, internal::OpenHashKey3<K>::Get(item)}};
+}
+
+template<typename T>
+void OpenHashTable<T>::SetItemKey(T &item, const KeyType &key)
+{
+   item.p1 = key.p[0];
+   item.p2 = key.p[1];
+   internal::OpenHashKey3<K>::Set(item, key.p[2]);
+}
+
+template<typename T>
+inline int OpenHashTable<T>::Hash(const KeyType &key)
+{
+   // NOTE: the constants are arbitrary, the multiplication by 2^64/phi moves
+   // the well-mixed bits to the top (Fibonacci hashing).
+   const std::uint64_t h = 984120265ull*std::uint64_t(key.p[0]) +
+                           125965121ull*std::uint64_t(key.p[1]) +
+                           495698413ull*std::uint64_t(key.p[2]+1);
+   return int((h*11400714819323198485ull) >> 33);
+}
+
+template<typename T>
+inline bool OpenHashTable<T>::ItemHasKey(int id, const KeyType &key) const
+{
+   const T &item = Base::At(id);
+   return (item.p1 == key.p[0] && item.p2 == key.p[1] &&
+           internal::OpenHashKey3<K>::Get(item) == key.p[2]);
+}
+
+template<typename T>
+inline int OpenHashTable<T>::FindSlot(const KeyType &key) const
+{
+   // the items are only accessed when their hash value matches
+   const int hash = Hash(key);
+   int slot = hash >> shift;
+   while (slot_ids[slot] >= 0 &&
+          !(slot_hash[slot] == hash && ItemHasKey(slot_ids[slot], key)))
+   {
+      slot = (slot + 1) & mask;
+   }
+   return slot;
+}
+
+template<typename T>
+inline void OpenHashTable<T>::SetSlot(int slot, int id, int hash)
+{
+   slot_ids[slot] = id;
+   slot_hash[slot] = hash;
+}
+
+template<typename T>
+void OpenHashTable<T>::RemoveSlot(int id)
+{
+   int slot = FindSlot(ItemKey(Base::At(id)));
+   MFEM_VERIFY(slot_ids[slot] == id,
+               "OpenHashTable<>::RemoveSlot: item not found!");
+
+   // Move back the following items of the probe sequence whose first slot is
+   // not in the cyclic range (slot, next], so they can still be found.
+   for (int next = (slot + 1) & mask; slot_ids[next] >= 0;
+        next = (next + 1) & mask)
+   {
+      const int home = slot_hash[next] >> shift;
+      const bool stays = (slot < next) ? (slot < home && home <= next)
+                         : (slot < home || home <= next);
+      if (!stays)
+      {
+         SetSlot(slot, slot_ids[next], slot_hash[next]);
+         slot = next;
+      }
+   }
+   slot_ids[slot] = -1;
+}
+
+template<typename T>
+int OpenHashTable<T>::GetId(const KeyType &key)
+{
+   // search for the item in the hash table
+   const int slot = FindSlot(key);
+   if (slot_ids[slot] >= 0) { return slot_ids[slot]; }
+
+   // not found - use an unused item or create a new one
+   int new_id;
+   if (unused.Size())
+   {
+      new_id = unused.Last();
+      unused.DeleteLast();
+   }
+   else
+   {
+      new_id = Base::Append();
+   }
+   SetItemKey(Base::At(new_id), key);
+
+   // insert into the hash table
+   SetSlot(slot, new_id, Hash(key));
+   CheckRehash();
+
+   return new_id;
+}
+
+template<typename T>
+void OpenHashTable<T>::Reparent(int id, const KeyType &key)
+{
+   RemoveSlot(id);
+   SetItemKey(Base::At(id), key);
+   SetSlot(FindSlot(key), id, Hash(key));
+}
+
+template<typename T>
+void OpenHashTable<T>::Delete(int id)
+{
+   RemoveSlot(id);
+   Base::At(id).p1 = -1; // mark item as unused
+   unused.Append(id);    // add its id to the unused ids
+}
+
+template<typename T>
+void OpenHashTable<T>::DeleteAll()
+{
+   Base::DeleteAll();
+   slot_ids = -1;
+   unused.DeleteAll();
+}
+
+template<typename T>
+void OpenHashTable<T>::Alloc(int id, int p1, int p2)
+{
+   // enlarge the BlockArray to hold 'id'
+   while (id >= Base::Size())
+   {
+      Base::At(Base::Append()).p1 = -1; // append "unused" items
+   }
+
+   T& item = Base::At(id);
+   if (item.p1 < 0)
+   {
+      const KeyType key = Key(p1, p2, -1, -1);
+      SetItemKey(item, key);
+      SetSlot(FindSlot(key), id, Hash(key));
+      CheckRehash();
+   }
+}
+
+template<typename T>
+void OpenHashTable<T>::UpdateUnused()
+{
+   unused.DeleteAll();
+   for (int i = 0; i < Base::Size(); i++)
+   {
+      if (Base::At(i).p1 < 0) { unused.Append(i); }
+   }
+}
+
+template<typename T>
+inline void OpenHashTable<T>::CheckRehash()
+{
+   // is the table more than 3/4 full?
+   if (4*std::size_t(Base::Size()) > 3*std::size_t(mask+1))
+   {
+      DoRehash(2*(mask+1));
+   }
+}
+
+template<typename T>
+void OpenHashTable<T>::DoRehash(int num_slots)
+{
+   Array<int> old_hash, old_ids;
+   old_hash.Swap(slot_hash);
+   old_ids.Swap(slot_ids);
+
+   slot_hash.SetSize(num_slots);
+   slot_ids.SetSize(num_slots);
+   slot_ids = -1;
+   mask = num_slots-1;
+   shift = 31;
+   for (int n = num_slots; n > 1; n >>= 1) { shift--; }
+
+   // reinsert all items using their stored hash values, the keys are distinct
+   // so the items themselves are not accessed
+   for (int i = 0; i < old_ids.Size(); i++)
+   {
+      if (old_ids[i] < 0) { continue; }
+      int slot = old_hash[i] >> shift;
+      while (slot_ids[slot] >= 0) { slot = (slot + 1) & mask; }
+      SetSlot(slot, old_ids[i], old_hash[i]);
+   }
+}
+
+template<typename T>
+std::size_t OpenHashTable<T>::MemoryUsage() const
+{
+   return slot_hash.MemoryUsage() + slot_ids.MemoryUsage() +
+          Base::MemoryUsage() + unused.MemoryUsage();
+}
+
+template<typename T>
+void OpenHashTable<T>::PrintMemoryDetail() const
+{
+   mfem::out << Base::MemoryUsage() << " + "
+             << slot_hash.MemoryUsage() + slot_ids.MemoryUsage()
+             << " + " << unused.MemoryUsage();
+}
+
+template<typename T>
+void OpenHashTable<T>::PrintStats() const
+{
+   mfem::out << "Hash table size: " << mask+1 << "\n";
+   mfem::out << "Item count: " << Size() << "\n";
+   mfem::out << "BlockArray size: " << Base::Size() << "\n";
+
+   // histogram of the number of slots scanned to find each item
+   const int H = 16;
+   int hist[H];
+   for (int i = 0; i < H; i++) { hist[i] = 0; }
+
+   for (int slot = 0; slot <= mask; slot++)
+   {
+      if (slot_ids[slot] < 0) { continue; }
+      int len = ((slot - (slot_hash[slot] >> shift)) & mask) + 1;
+      if (len >= H) { len = H-1; }
+      hist[len]++;
+   }
+
+   mfem::out << "Probe length histogram:\n";
+   for (int i = 1; i < H; i++)
+   {
+      mfem::out << "  length " << i << ": "
+                << hist[i] << " items" << std::endl;
+   }
+}
+
 
 template <typename int_type_const_iter>
 HashFunction &HashFunction::EncodeAndHashInts(int_type_const_iter begin,
@@ -11,6 +11,7 @@
 
 #include "batched.hpp"
 #include "native.hpp"
+#include "interleaved.hpp"
 #include "gpu_blas.hpp"
 #include "magma.hpp"
 
@@ -20,6 +21,7 @@ namespace mfem
 BatchedLinAlg::BatchedLinAlg()
 {
    backends[NATIVE].reset(new NativeBatchedLinAlg);
+   backends[INTERLEAVED].reset(new InterleavedBatchedLinAlg);
 
    if (Device::Allows(mfem::Backend::CUDA_MASK | mfem::Backend::HIP_MASK))
    {
@@ -84,6 +86,38 @@ void BatchedLinAlg::LUSolve(const DenseTensor &A, const Array<int> &P,
    Get(Instance().active_backend).LUSolve(A, P, x);
 }
 
+void BatchedLinAlg::Det(const DenseTensor &A, Vector &det)
+{
+   Get(Instance().active_backend).Det(A, det);
+}
+
+void BatchedLinAlg::CholeskyFactor(DenseTensor &A)
+{
+   Get(Instance().active_backend).CholeskyFactor(A);
+}
+
+void BatchedLinAlg::CholeskySolve(const DenseTensor &L, Vector &x)
+{
+   Get(Instance().active_backend).CholeskySolve(L, x);
+}
+
+void BatchedLinAlg::QRFactor(DenseTensor &A, Vector &tau)
+{
+   Get(Instance().active_backend).QRFactor(A, tau);
+}
+
+void BatchedLinAlg::QRSolve(const DenseTensor &QR, const Vector &tau,
+                            Vector &x)
+{
+   Get(Instance().active_backend).QRSolve(QR, tau, x);
+}
+
+void BatchedLinAlg::SymmetricEigensystem(const DenseTensor &A, Vector &lambda,
+                                         DenseTensor &V)
+{
+   Get(Instance().active_backend).SymmetricEigensystem(A, lambda, V);
+}
+
 bool BatchedLinAlg::IsAvailable(BatchedLinAlg::Backend backend)
 {
    return Instance().backends[backend] != nullptr;
@@ -119,4 +153,37 @@ void BatchedLinAlgBase::MultTranspose(const DenseTensor &A, const Vector &x,
    AddMult(A, x, y, 1.0, 0.0, Op::T);
 }
 
+void BatchedLinAlgBase::Det(const DenseTensor &A, Vector &det) const
+{
+   BatchedLinAlg::Get(BatchedLinAlg::NATIVE).Det(A, det);
+}
+
+void BatchedLinAlgBase::CholeskyFactor(DenseTensor &A) const
+{
+   BatchedLinAlg::Get(BatchedLinAlg::NATIVE).CholeskyFactor(A);
+}
+
+void BatchedLinAlgBase::CholeskySolve(const DenseTensor &L, Vector &x) const
+{
+   BatchedLinAlg::Get(BatchedLinAlg::NATIVE).CholeskySolve(L, x);
+}
+
+void BatchedLinAlgBase::QRFactor(DenseTensor &A, Vector &tau) const
+{
+   BatchedLinAlg::Get(BatchedLinAlg::NATIVE).QRFactor(A, tau);
+}
+
+void BatchedLinAlgBase::QRSolve(const DenseTensor &QR, const Vector &tau,
+                                Vector &x) const
+{
+   BatchedLinAlg::Get(BatchedLinAlg::NATIVE).QRSolve(QR, tau, x);
+}
+
+void BatchedLinAlgBase::SymmetricEigensystem(const DenseTensor &A,
+                                             Vector &lambda,
+                                             DenseTensor &V) const
+{
+   BatchedLinAlg::Get(BatchedLinAlg::NATIVE).SymmetricEigensystem(A, lambda, V);
+}
+
 }
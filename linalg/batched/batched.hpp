@@ -34,7 +34,8 @@ public:
    /// @brief Available backends for implementations of batched algorithms.
    ///
    /// The initially active backend will be the first available backend in this
-   /// order: MAGMA, GPU_BLAS, NATIVE.
+   /// order: MAGMA, GPU_BLAS, NATIVE. The INTERLEAVED backend is never active
+   /// initially, and has to be selected explicitly.
    enum Backend
    {
       /// @brief The standard MFEM backend, implemented using mfem::forall
@@ -45,6 +46,10 @@ public:
       GPU_BLAS,
       /// MAGMA backend, only available if MFEM is compiled with MAGMA support.
       MAGMA,
+      /// @brief Host backend using a batch-interleaved layout that vectorizes
+      /// across matrices, see InterleavedBatchedLinAlg. Best suited for large
+      /// batches of small matrices on the CPU.
+      INTERLEAVED,
       /// Counter for the number of backends.
       NUM_BACKENDS
    };
@@ -99,6 +104,51 @@ public:
    /// @warning P should use 1-based indexing. This is what LUFactor() generates
    /// for all available backends.
    static void LUSolve(const DenseTensor &A, const Array<int> &P, Vector &x);
+   /// @brief Computes the determinants of the blocks of the block diagonal
+   /// matrix $A$.
+   ///
+   /// $A$ is represented by the DenseTensor @a A with shape (n, n, n_mat). On
+   /// output, @a det has size n_mat.
+   static void Det(const DenseTensor &A, Vector &det);
+   /// @brief Replaces the symmetric positive definite block diagonal matrix $A$
+   /// with its Cholesky factors $L$, such that $L L^T = A$.
+   ///
+   /// $A$ is represented by the DenseTensor @a A with shape (n, n, n_mat). On
+   /// output, each block contains the lower triangular factor $L$ (the strictly
+   /// upper triangular part is set to zero).
+   static void CholeskyFactor(DenseTensor &A);
+   /// @brief Replaces $x$ with $A^{-1} x$, given the Cholesky factors @a L of
+   /// the block-diagonal matrix $A$.
+   ///
+   /// The Cholesky factors of $A$ should be obtained by first calling
+   /// CholeskyFactor(). $L$ has shape (n, n, n_mat) and $x$ has shape (n,
+   /// n_rhs, n_mat).
+   static void CholeskySolve(const DenseTensor &L, Vector &x);
+   /// @brief Replaces the block diagonal matrix $A$ with its Householder QR
+   /// factors. The Householder scaling factors are stored in @a tau.
+   ///
+   /// $A$ is represented by the DenseTensor @a A with shape (m, n, n_mat),
+   /// where m >= n. On output, $\tau$ has shape (n, n_mat). The storage format
+   /// is the same as LAPACK's xGEQRF.
+   static void QRFactor(DenseTensor &A, Vector &tau);
+   /// @brief Solves the least-squares problems $\min \| A x - b \|$, given
+   /// the QR factors @a QR and Householder scaling factors @a tau of the block
+   /// diagonal matrix $A$.
+   ///
+   /// The QR factors of $A$ should be obtained by first calling QRFactor().
+   /// $A$ has shape (m, n, n_mat) and @a x has shape (m, n_rhs, n_mat). On
+   /// input, @a x contains the right-hand sides $b$; on output, the first n
+   /// rows of each block of @a x contain the solutions.
+   static void QRSolve(const DenseTensor &QR, const Vector &tau, Vector &x);
+   /// @brief Computes the eigenvalues and eigenvectors of the symmetric block
+   /// diagonal matrix $A$.
+   ///
+   /// $A$ is represented by the DenseTensor @a A with shape (n, n, n_mat). On
+   /// output, @a lambda has shape (n, n_mat) and contains the eigenvalues of
+   /// each block in ascending order, and @a V has shape (n, n, n_mat) and
+   /// contains the corresponding orthonormal eigenvectors as columns.
+   static void SymmetricEigensystem(const DenseTensor &A, Vector &lambda,
+                                    DenseTensor &V);
    /// @brief Returns true if the requested backend is available.
    ///
    /// The available backends depend on which third-party libraries MFEM is
@@ -137,6 +187,32 @@ public:
    /// See BatchedLinAlg::LUSolve.
    virtual void LUSolve(const DenseTensor &LU, const Array<int> &P,
                         Vector &x) const = 0;
+   /// @brief See BatchedLinAlg::Det.
+   ///
+   /// The default implementation uses the NATIVE backend.
+   virtual void Det(const DenseTensor &A, Vector &det) const;
+   /// @brief See BatchedLinAlg::CholeskyFactor.
+   ///
+   /// The default implementation uses the NATIVE backend.
+   virtual void CholeskyFactor(DenseTensor &A) const;
+   /// @brief See BatchedLinAlg::CholeskySolve.
+   ///
+   /// The default implementation uses the NATIVE backend.
+   virtual void CholeskySolve(const DenseTensor &L, Vector &x) const;
+   /// @brief See BatchedLinAlg::QRFactor.
+   ///
+   /// The default implementation uses the NATIVE backend.
+   virtual void QRFactor(DenseTensor &A, Vector &tau) const;
+   /// @brief See BatchedLinAlg::QRSolve.
+   ///
+   /// The default implementation uses the NATIVE backend.
+   virtual void QRSolve(const DenseTensor &QR, const Vector &tau,
+                        Vector &x) const;
+   /// @brief See BatchedLinAlg::SymmetricEigensystem.
+   ///
+   /// The default implementation uses the NATIVE backend.
+   virtual void SymmetricEigensystem(const DenseTensor &A, Vector &lambda,
+                                     DenseTensor &V) const;
    /// Virtual destructor.
    virtual ~BatchedLinAlgBase() { }
 };
@@ -0,0 +1,537 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "interleaved.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace mfem
+{
+
+namespace
+{
+
+// In the kernels below, all arrays are stored in the batch-interleaved layout:
+// entry (i,j) of lane l of a (m x n) block is stored at index l + W*(i + m*j).
+// The innermost loops run over the lanes.
+constexpr int W = InterleavedBatchedLinAlg::lanes;
+
+// Gather the (rows x cols) matrices e0, ..., e0 + W - 1 from the standard
+// layout array @a src into the interleaved block @a dst. Lanes beyond @a n_mat
+// are padded with the identity.
+void GatherBlock(const real_t *src, int rows, int cols, int e0,
+                 int n_mat, real_t *dst)
+{
+   const int size = rows*cols;
+   for (int l = 0; l < W; l++)
+   {
+      const int e = e0 + l;
+      if (e < n_mat)
+      {
+         const real_t *s = src + size*e;
+         for (int k = 0; k < size; k++) { dst[l + W*k] = s[k]; }
+      }
+      else
+      {
+         for (int j = 0; j < cols; j++)
+         {
+            for (int i = 0; i < rows; i++)
+            {
+               dst[l + W*(i + rows*j)] = (i == j) ? 1.0 : 0.0;
+            }
+         }
+      }
+   }
+}
+
+// Scatter the interleaved block @a src back to the standard layout array @a dst
+// (inverse of GatherBlock, padded lanes are skipped).
+void ScatterBlock(const real_t *src, int rows, int cols, int e0,
+                  int n_mat, real_t *dst)
+{
+   const int size = rows*cols;
+   const int n_lanes = std::min(W, n_mat - e0);
+   for (int l = 0; l < n_lanes; l++)
+   {
+      real_t *d = dst + size*(e0 + l);
+      for (int k = 0; k < size; k++) { d[k] = src[l + W*k]; }
+   }
+}
+
+// LU factorization with partial pivoting of an interleaved block of (m x m)
+// matrices. The (0-based) pivots are stored in @a piv with the layout (W, m).
+// Returns false if a zero pivot was encountered in any lane.
+bool LUFactorBlock(real_t *a, int m, int *piv)
+{
+   bool ok = true;
+   for (int i = 0; i < m; i++)
+   {
+      // Pivoting is lane-dependent
+      for (int l = 0; l < W; l++)
+      {
+         int p = i;
+         real_t a_max = std::abs(a[l + W*(i + m*i)]);
+         for (int j = i + 1; j < m; j++)
+         {
+            const real_t b = std::abs(a[l + W*(j + m*i)]);
+            if (b > a_max) { a_max = b; p = j; }
+         }
+         piv[l + W*i] = p;
+         if (p != i)
+         {
+            for (int k = 0; k < m; k++)
+            {
+               std::swap(a[l + W*(i + m*k)], a[l + W*(p + m*k)]);
+            }
+         }
+      }
+
+      real_t a_ii_inv[W];
+      for (int l = 0; l < W; l++)
+      {
+         const real_t a_ii = a[l + W*(i + m*i)];
+         if (a_ii == 0.0) { ok = false; }
+         a_ii_inv[l] = 1.0/a_ii;
+      }
+      for (int j = i + 1; j < m; j++)
+      {
+         real_t *a_ji = a + W*(j + m*i);
+         for (int l = 0; l < W; l++) { a_ji[l] *= a_ii_inv[l]; }
+      }
+      for (int k = i + 1; k < m; k++)
+      {
+         const real_t *a_ik = a + W*(i + m*k);
+         for (int j = i + 1; j < m; j++)
+         {
+            const real_t *a_ji = a + W*(j + m*i);
+            real_t *a_jk = a + W*(j + m*k);
+            for (int l = 0; l < W; l++) { a_jk[l] -= a_ik[l]*a_ji[l]; }
+         }
+      }
+   }
+   return ok;
+}
+
+// Solve A x = b for a single right-hand side per lane, given the LU factors
+// computed by LUFactorBlock. The vector @a x has the layout (W, m).
+void LUSolveBlock(const real_t *a, int m, const int *piv, real_t *x)
+{
+   // x <- P x
+   for (int i = 0; i < m; i++)
+   {
+      for (int l = 0; l < W; l++)
+      {
+         std::swap(x[l + W*i], x[l + W*piv[l + W*i]]);
+      }
+   }
+   // x <- L^{-1} x
+   for (int j = 0; j < m; j++)
+   {
+      const real_t *x_j = x + W*j;
+      for (int i = j + 1; i < m; i++)
+      {
+         const real_t *a_ij = a + W*(i + m*j);
+         real_t *x_i = x + W*i;
+         for (int l = 0; l < W; l++) { x_i[l] -= a_ij[l]*x_j[l]; }
+      }
+   }
+   // x <- U^{-1} x
+   for (int j = m - 1; j >= 0; j--)
+   {
+      real_t *x_j = x + W*j;
+      const real_t *a_jj = a + W*(j + m*j);
+      for (int l = 0; l < W; l++) { x_j[l] /= a_jj[l]; }
+      for (int i = 0; i < j; i++)
+      {
+         const real_t *a_ij = a + W*(i + m*j);
+         real_t *x_i = x + W*i;
+         for (int l = 0; l < W; l++) { x_i[l] -= a_ij[l]*x_j[l]; }
+      }
+   }
+}
+
+// Cholesky factorization of an interleaved block of SPD (m x m) matrices. The
+// strictly upper triangular part is set to zero. Returns false if a
+// non-positive pivot was encountered in any lane.
+bool CholeskyFactorBlock(real_t *a, int m)
+{
+   bool ok = true;
+   for (int j = 0; j < m; j++)
+   {
+      real_t *a_jj = a + W*(j + m*j);
+      real_t l_jj_inv[W];
+      for (int l = 0; l < W; l++)
+      {
+         if (a_jj[l] <= 0.0) { ok = false; }
+         a_jj[l] = std::sqrt(std::abs(a_jj[l]));
+         l_jj_inv[l] = 1.0/a_jj[l];
+      }
+      for (int i = j + 1; i < m; i++)
+      {
+         real_t *a_ij = a + W*(i + m*j);
+         real_t *a_ji = a + W*(j + m*i);
+         for (int l = 0; l < W; l++)
+         {
+            a_ij[l] *= l_jj_inv[l];
+            a_ji[l] = 0.0;
+         }
+      }
+      for (int k = j + 1; k < m; k++)
+      {
+         const real_t *l_kj = a + W*(k + m*j);
+         for (int i = k; i < m; i++)
+         {
+            const real_t *l_ij = a + W*(i + m*j);
+            real_t *a_ik = a + W*(i + m*k);
+            for (int l = 0; l < W; l++) { a_ik[l] -= l_ij[l]*l_kj[l]; }
+         }
+      }
+   }
+   return ok;
+}
+
+// Solve A x = b for a single right-hand side per lane, given the Cholesky
+// factors computed by CholeskyFactorBlock. The vector @a x has the layout
+// (W, m).
+void CholeskySolveBlock(const real_t *a, int m, real_t *x)
+{
+   // x <- L^{-1} x
+   for (int j = 0; j < m; j++)
+   {
+      real_t *x_j = x + W*j;
+      const real_t *a_jj = a + W*(j + m*j);
+      for (int l = 0; l < W; l++) { x_j[l] /= a_jj[l]; }
+      for (int i = j + 1; i < m; i++)
+      {
+         const real_t *a_ij = a + W*(i + m*j);
+         real_t *x_i = x + W*i;
+         for (int l = 0; l < W; l++) { x_i[l] -= a_ij[l]*x_j[l]; }
+      }
+   }
+   // x <- L^{-T} x
+   for (int j = m - 1; j >= 0; j--)
+   {
+      real_t *x_j = x + W*j;
+      for (int i = j + 1; i < m; i++)
+      {
+         const real_t *a_ij = a + W*(i + m*j);
+         const real_t *x_i = x + W*i;
+         for (int l = 0; l < W; l++) { x_j[l] -= a_ij[l]*x_i[l]; }
+      }
+      const real_t *a_jj = a + W*(j + m*j);
+      for (int l = 0; l < W; l++) { x_j[l] /= a_jj[l]; }
+   }
+}
+
+// Gather the column @a r of the (rows x n_rhs) blocks of the standard layout
+// vector @a src into the interleaved vector @a dst with layout (W, rows).
+void GatherColumn(const real_t *src, int rows, int n_rhs, int r,
+                  int e0, int n_mat, real_t *dst)
+{
+   for (int l = 0; l < W; l++)
+   {
+      const int e = e0 + l;
+      if (e < n_mat)
+      {
+         const real_t *s = src + rows*(r + n_rhs*e);
+         for (int i = 0; i < rows; i++) { dst[l + W*i] = s[i]; }
+      }
+      else
+      {
+         for (int i = 0; i < rows; i++) { dst[l + W*i] = 0.0; }
+      }
+   }
+}
+
+// Inverse of GatherColumn, padded lanes are skipped.
+void ScatterColumn(const real_t *src, int rows, int n_rhs, int r,
+                   int e0, int n_mat, real_t *dst)
+{
+   const int n_lanes = std::min(W, n_mat - e0);
+   for (int l = 0; l < n_lanes; l++)
+   {
+      real_t *d = dst + rows*(r + n_rhs*(e0 + l));
+      for (int i = 0; i < rows; i++) { d[i] = src[l + W*i]; }
+   }
+}
+
+// Backend used for matrices larger than InterleavedBatchedLinAlg::max_size.
+const BatchedLinAlgBase &Fallback()
+{
+   return BatchedLinAlg::Get(BatchedLinAlg::NATIVE);
+}
+
+} // anonymous namespace
+
+void InterleavedBatchedLinAlg::Interleave(const DenseTensor &A, Vector &A_il)
+{
+   const int m = A.SizeI(), n = A.SizeJ(), n_mat = A.SizeK();
+   const int n_blocks = (n_mat + W - 1)/W;
+   A_il.SetSize(m*n*W*n_blocks);
+
+   const real_t *d_A = A.HostRead();
+   real_t *d_A_il = A_il.HostWrite();
+   for (int b = 0; b < n_blocks; b++)
+   {
+      GatherBlock(d_A, m, n, b*W, n_mat, d_A_il + m*n*W*b);
+   }
+}
+
+void InterleavedBatchedLinAlg::Deinterleave(const Vector &A_il, DenseTensor &A)
+{
+   const int m = A.SizeI(), n = A.SizeJ(), n_mat = A.SizeK();
+   const int n_blocks = (n_mat + W - 1)/W;
+   MFEM_VERIFY(A_il.Size() == m*n*W*n_blocks, "Incompatible sizes.");
+
+   const real_t *d_A_il = A_il.HostRead();
+   real_t *d_A = A.HostWrite();
+   for (int b = 0; b < n_blocks; b++)
+   {
+      ScatterBlock(d_A_il + m*n*W*b, m, n, b*W, n_mat, d_A);
+   }
+}
+
+void InterleavedBatchedLinAlg::AddMult(const DenseTensor &A, const Vector &x,
+                                       Vector &y, real_t alpha, real_t beta,
+                                       Op op) const
+{
+   const bool tr = (op == Op::T);
+   const int m = A.SizeI(), n = A.SizeJ(), n_mat = A.SizeK();
+   const int n_in = tr ? m : n;
+   const int n_out = tr ? n : m;
+   const int k = x.Size() / n_in / n_mat;
+
+   const real_t *d_A = A.HostRead();
+   const real_t *d_x = x.HostRead();
+   real_t *d_y = (beta == 0.0) ? y.HostWrite() : y.HostReadWrite();
+
+   Vector buf(m*n*W + (n_in + 2*n_out)*W);
+   real_t *a = buf.HostWrite();
+   real_t *xb = a + m*n*W;
+   real_t *yb = xb + n_in*W;
+   real_t *yb_old = yb + n_out*W;
+
+   for (int e0 = 0; e0 < n_mat; e0 += W)
+   {
+      GatherBlock(d_A, m, n, e0, n_mat, a);
+      for (int r = 0; r < k; r++)
+      {
+         GatherColumn(d_x, n_in, k, r, e0, n_mat, xb);
+         for (int i = 0; i < n_out*W; i++) { yb[i] = 0.0; }
+         for (int j = 0; j < n; j++)
+         {
+            for (int i = 0; i < m; i++)
+            {
+               const real_t *a_ij = a + W*(i + m*j);
+               // y(i) += A(i,j) x(j), or y(j) += A(i,j) x(i)
+               const real_t *x_in = xb + W*(tr ? i : j);
+               real_t *y_out = yb + W*(tr ? j : i);
+               for (int l = 0; l < W; l++) { y_out[l] += a_ij[l]*x_in[l]; }
+            }
+         }
+         if (beta != 0.0)
+         {
+            GatherColumn(d_y, n_out, k, r, e0, n_mat, yb_old);
+            for (int i = 0; i < n_out*W; i++)
+            {
+               yb[i] = alpha*yb[i] + beta*yb_old[i];
+            }
+         }
+         else
+         {
+            for (int i = 0; i < n_out*W; i++) { yb[i] *= alpha; }
+         }
+         ScatterColumn(yb, n_out, k, r, e0, n_mat, d_y);
+      }
+   }
+}
+
+void InterleavedBatchedLinAlg::Invert(DenseTensor &A) const
+{
+   const int m = A.SizeI(), n_mat = A.SizeK();
+   if (m > max_size) { return Fallback().Invert(A); }
+
+   real_t *d_A = A.HostReadWrite();
+   Vector buf(2*m*m*W + m*W);
+   real_t *a = buf.HostWrite();
+   real_t *inv = a + m*m*W;
+   real_t *x = inv + m*m*W;
+   Array<int> piv(m*W);
+   int *d_piv = piv.HostWrite();
+
+   bool ok = true;
+   for (int e0 = 0; e0 < n_mat; e0 += W)
+   {
+      GatherBlock(d_A, m, m, e0, n_mat, a);
+      ok = LUFactorBlock(a, m, d_piv) && ok;
+      // Solve for the columns of the identity
+      for (int j = 0; j < m; j++)
+      {
+         for (int i = 0; i < m; i++)
+         {
+            for (int l = 0; l < W; l++) { x[l + W*i] = (i == j) ? 1.0 : 0.0; }
+         }
+         LUSolveBlock(a, m, d_piv, x);
+         for (int i = 0; i < m*W; i++) { inv[i + m*W*j] = x[i]; }
+      }
+      ScatterBlock(inv, m, m, e0, n_mat, d_A);
+   }
+   MFEM_VERIFY(ok, "Batch matrix inversion failed");
+}
+
+void InterleavedBatchedLinAlg::LUFactor(DenseTensor &A, Array<int> &P) const
+{
+   const int m = A.SizeI(), n_mat = A.SizeK();
+   if (m > max_size) { return Fallback().LUFactor(A, P); }
+   P.SetSize(m*n_mat);
+
+   real_t *d_A = A.HostReadWrite();
+   int *d_P = P.HostWrite();
+   Vector buf(m*m*W);
+   real_t *a = buf.HostWrite();
+   Array<int> piv(m*W);
+   int *d_piv = piv.HostWrite();
+
+   bool ok = true;
+   for (int e0 = 0; e0 < n_mat; e0 += W)
+   {
+      GatherBlock(d_A, m, m, e0, n_mat, a);
+      ok = LUFactorBlock(a, m, d_piv) && ok;
+      ScatterBlock(a, m, m, e0, n_mat, d_A);
+      // Store 1-based pivots, compatible with the other backends
+      const int n_lanes = std::min(W, n_mat - e0);
+      for (int l = 0; l < n_lanes; l++)
+      {
+         for (int i = 0; i < m; i++)
+         {
+            d_P[i + m*(e0 + l)] = d_piv[l + W*i] + 1;
+         }
+      }
+   }
+   MFEM_VERIFY(ok, "Batch LU factorization failed");
+}
+
+void InterleavedBatchedLinAlg::LUSolve(const DenseTensor &LU,
+                                       const Array<int> &P, Vector &x) const
+{
+   const int m = LU.SizeI(), n_mat = LU.SizeK();
+   if (m > max_size) { return Fallback().LUSolve(LU, P, x); }
+   const int n_rhs = x.Size() / m / n_mat;
+
+   const real_t *d_LU = LU.HostRead();
+   const int *d_P = P.HostRead();
+   real_t *d_x = x.HostReadWrite();
+   Vector buf(m*m*W + m*W);
+   real_t *a = buf.HostWrite();
+   real_t *xb = a + m*m*W;
+   Array<int> piv(m*W);
+   int *d_piv = piv.HostWrite();
+
+   for (int e0 = 0; e0 < n_mat; e0 += W)
+   {
+      GatherBlock(d_LU, m, m, e0, n_mat, a);
+      for (int l = 0; l < W; l++)
+      {
+         const int e = e0 + l;
+         for (int i = 0; i < m; i++)
+         {
+            d_piv[l + W*i] = (e < n_mat) ? d_P[i + m*e] - 1 : i;
+         }
+      }
+      for (int r = 0; r < n_rhs; r++)
+      {
+         GatherColumn(d_x, m, n_rhs, r, e0, n_mat, xb);
+         LUSolveBlock(a, m, d_piv, xb);
+         ScatterColumn(xb, m, n_rhs, r, e0, n_mat, d_x);
+      }
+   }
+}
+
+void InterleavedBatchedLinAlg::CholeskyFactor(DenseTensor &A) const
+{
+   const int m = A.SizeI(), n_mat = A.SizeK();
+   if (m > max_size) { return Fallback().CholeskyFactor(A); }
+
+   real_t *d_A = A.HostReadWrite();
+   Vector buf(m*m*W);
+   real_t *a = buf.HostWrite();
+
+   bool ok = true;
+   for (int e0 = 0; e0 < n_mat; e0 += W)
+   {
+      GatherBlock(d_A, m, m, e0, n_mat, a);
+      ok = CholeskyFactorBlock(a, m) && ok;
+      ScatterBlock(a, m, m, e0, n_mat, d_A);
+   }
+   MFEM_VERIFY(ok, "Batch Cholesky factorization failed (matrix not SPD)");
+}
+
+void InterleavedBatchedLinAlg::CholeskySolve(const DenseTensor &L,
+                                             Vector &x) const
+{
+   const int m = L.SizeI(), n_mat = L.SizeK();
+   if (m > max_size) { return Fallback().CholeskySolve(L, x); }
+   const int n_rhs = x.Size() / m / n_mat;
+
+   const real_t *d_L = L.HostRead();
+   real_t *d_x = x.HostReadWrite();
+   Vector buf(m*m*W + m*W);
+   real_t *a = buf.HostWrite();
+   real_t *xb = a + m*m*W;
+
+   for (int e0 = 0; e0 < n_mat; e0 += W)
+   {
+      GatherBlock(d_L, m, m, e0, n_mat, a);
+      for (int r = 0; r < n_rhs; r++)
+      {
+         GatherColumn(d_x, m, n_rhs, r, e0, n_mat, xb);
+         CholeskySolveBlock(a, m, xb);
+         ScatterColumn(xb, m, n_rhs, r, e0, n_mat, d_x);
+      }
+   }
+}
+
+void InterleavedBatchedLinAlg::Det(const DenseTensor &A, Vector &det) const
+{
+   const int m = A.SizeI(), n_mat = A.SizeK();
+   if (m > max_size) { return Fallback().Det(A, det); }
+   MFEM_VERIFY(A.SizeJ() == m, "Blocks must be square.");
+   det.SetSize(n_mat);
+
+   const real_t *d_A = A.HostRead();
+   real_t *d_det = det.HostWrite();
+   Vector buf(m*m*W);
+   real_t *a = buf.HostWrite();
+   Array<int> piv(m*W);
+   int *d_piv = piv.HostWrite();
+
+   for (int e0 = 0; e0 < n_mat; e0 += W)
+   {
+      GatherBlock(d_A, m, m, e0, n_mat, a);
+      // A zero pivot gives a zero determinant
+      LUFactorBlock(a, m, d_piv);
+      real_t d[W];
+      for (int l = 0; l < W; l++) { d[l] = 1.0; }
+      for (int i = 0; i < m; i++)
+      {
+         const real_t *a_ii = a + W*(i + m*i);
+         for (int l = 0; l < W; l++)
+         {
+            d[l] *= (d_piv[l + W*i] == i) ? a_ii[l] : -a_ii[l];
+         }
+      }
+      const int n_lanes = std::min(W, n_mat - e0);
+      for (int l = 0; l < n_lanes; l++) { d_det[e0 + l] = d[l]; }
+   }
+}
+
+} // namespace mfem
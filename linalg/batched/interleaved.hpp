@@ -0,0 +1,69 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_INTERLEAVED_LINALG
+#define MFEM_INTERLEAVED_LINALG
+
+#include "batched.hpp"
+
+namespace mfem
+{
+
+/// @brief Host batched linear algebra backend using a batch-interleaved
+/// ("array of structures of arrays") layout.
+///
+/// The matrices are processed in blocks of #lanes consecutive matrices. Within
+/// a block, entry (i,j) of all the matrices is stored contiguously, so that the
+/// innermost loop of every kernel runs across the batch and is vectorized by
+/// the compiler (SIMD across matrices). This is efficient for many small
+/// matrices, where the standard per-matrix kernels vectorize poorly.
+///
+/// The interface uses the standard DenseTensor layout: the inputs are
+/// converted to the interleaved layout block by block, see Interleave() and
+/// Deinterleave(). Matrices larger than #max_size are handled by the NATIVE
+/// backend. The pivots computed by LUFactor() are compatible with the other
+/// backends.
+class InterleavedBatchedLinAlg : public BatchedLinAlgBase
+{
+public:
+   /// Number of matrices interleaved in one block.
+   static constexpr int lanes = 8;
+   /// Largest matrix size handled by the interleaved kernels.
+   static constexpr int max_size = 32;
+
+   /// @brief Convert the DenseTensor @a A with shape (m, n, n_mat) to the
+   /// interleaved layout.
+   ///
+   /// On output, @a A_il has size m*n*lanes*n_blocks, where n_blocks is
+   /// n_mat/lanes rounded up. Entry (i,j) of matrix k is stored at index
+   /// i + m*j, with the layout (lanes, m, n, n_blocks), i.e. at
+   /// (k % lanes) + lanes*(i + m*(j + n*(k / lanes))). Unused lanes in the last
+   /// block are padded with the identity.
+   static void Interleave(const DenseTensor &A, Vector &A_il);
+   /// @brief Convert @a A_il from the interleaved layout back to the standard
+   /// DenseTensor layout. The DenseTensor @a A must have the correct shape.
+   static void Deinterleave(const Vector &A_il, DenseTensor &A);
+
+   void AddMult(const DenseTensor &A, const Vector &x, Vector &y,
+                real_t alpha = 1.0, real_t beta = 1.0,
+                Op op = Op::N) const override;
+   void Invert(DenseTensor &A) const override;
+   void LUFactor(DenseTensor &A, Array<int> &P) const override;
+   void LUSolve(const DenseTensor &LU, const Array<int> &P,
+                Vector &x) const override;
+   void CholeskyFactor(DenseTensor &A) const override;
+   void CholeskySolve(const DenseTensor &L, Vector &x) const override;
+   void Det(const DenseTensor &A, Vector &det) const override;
+};
+
+} // namespace mfem
+
+#endif
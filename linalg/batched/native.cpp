@@ -14,6 +14,8 @@
 #include "../dtensor.hpp"
 #include "../../general/forall.hpp"
 
+#include <limits>
+
 namespace mfem
 {
 
@@ -185,4 +187,138 @@ void NativeBatchedLinAlg::LUSolve(const DenseTensor &LU, const Array<int> &P,
    });
 }
 
+void NativeBatchedLinAlg::Det(const DenseTensor &A, Vector &det) const
+{
+   const int m = A.SizeI();
+   const int n_mat = A.SizeK();
+   MFEM_VERIFY(A.SizeJ() == m, "Blocks must be square.");
+   det.SetSize(n_mat);
+
+   DenseTensor LU = A;
+   Array<int> P(m*n_mat);
+   auto d_LU = Reshape(LU.ReadWrite(), m, m, n_mat);
+   auto d_P = Reshape(P.Write(), m, n_mat);
+   auto d_det = det.Write();
+
+   mfem::forall(n_mat, [=] MFEM_HOST_DEVICE (int e)
+   {
+      // A zero pivot gives a zero determinant
+      kernels::LUFactor(&d_LU(0,0,e), m, &d_P(0,e));
+      real_t d = 1.0;
+      for (int i = 0; i < m; i++)
+      {
+         d *= (d_P(i,e) - 1 == i) ? d_LU(i,i,e) : -d_LU(i,i,e);
+      }
+      d_det[e] = d;
+   });
+}
+
+void NativeBatchedLinAlg::CholeskyFactor(DenseTensor &A) const
+{
+   const int m = A.SizeI();
+   const int NE = A.SizeK();
+
+   auto data_all = Reshape(A.ReadWrite(), m, m, NE);
+   Array<bool> pivot_flag(1);
+   pivot_flag[0] = true;
+   bool *d_pivot_flag = pivot_flag.ReadWrite();
+
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const bool flag = kernels::CholeskyFactor(&data_all(0,0,e), m);
+      if (!flag) { d_pivot_flag[0] = false; }
+   });
+
+   MFEM_VERIFY(pivot_flag.HostRead()[0],
+               "Batch Cholesky factorization failed (matrix not SPD)");
+}
+
+void NativeBatchedLinAlg::CholeskySolve(const DenseTensor &L, Vector &x) const
+{
+   const int m = L.SizeI();
+   const int n_mat = L.SizeK();
+   const int n_rhs = x.Size() / m / n_mat;
+
+   auto d_L = Reshape(L.Read(), m, m, n_mat);
+   auto d_x = Reshape(x.ReadWrite(), m, n_rhs, n_mat);
+
+   mfem::forall(n_mat * n_rhs, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int i_rhs = idx % n_rhs;
+      const int i_mat = idx / n_rhs;
+
+      kernels::CholeskySolve(&d_L(0,0,i_mat), m, &d_x(0,i_rhs,i_mat));
+   });
+}
+
+void NativeBatchedLinAlg::QRFactor(DenseTensor &A, Vector &tau) const
+{
+   const int m = A.SizeI();
+   const int n = A.SizeJ();
+   const int n_mat = A.SizeK();
+   MFEM_VERIFY(m >= n, "QR factorization requires m >= n.");
+   tau.SetSize(n*n_mat);
+
+   auto d_A = Reshape(A.ReadWrite(), m, n, n_mat);
+   auto d_tau = Reshape(tau.Write(), n, n_mat);
+
+   mfem::forall(n_mat, [=] MFEM_HOST_DEVICE (int i)
+   {
+      kernels::QRFactor(&d_A(0,0,i), m, n, &d_tau(0,i));
+   });
+}
+
+void NativeBatchedLinAlg::QRSolve(const DenseTensor &QR, const Vector &tau,
+                                  Vector &x) const
+{
+   const int m = QR.SizeI();
+   const int n = QR.SizeJ();
+   const int n_mat = QR.SizeK();
+   const int n_rhs = x.Size() / m / n_mat;
+
+   auto d_QR = Reshape(QR.Read(), m, n, n_mat);
+   auto d_tau = Reshape(tau.Read(), n, n_mat);
+   auto d_x = Reshape(x.ReadWrite(), m, n_rhs, n_mat);
+
+   mfem::forall(n_mat * n_rhs, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int i_rhs = idx % n_rhs;
+      const int i_mat = idx / n_rhs;
+
+      kernels::QRSolve(&d_QR(0,0,i_mat), m, n, &d_tau(0,i_mat),
+                       &d_x(0,i_rhs,i_mat));
+   });
+}
+
+void NativeBatchedLinAlg::SymmetricEigensystem(const DenseTensor &A,
+                                               Vector &lambda,
+                                               DenseTensor &V) const
+{
+   const int m = A.SizeI();
+   const int n_mat = A.SizeK();
+   MFEM_VERIFY(A.SizeJ() == m, "Blocks must be square.");
+
+   DenseTensor work = A;
+   lambda.SetSize(m*n_mat);
+   V.SetSize(m, m, n_mat);
+
+   const real_t tol = 2*std::numeric_limits<real_t>::epsilon();
+   auto d_A = Reshape(work.ReadWrite(), m, m, n_mat);
+   auto d_lambda = Reshape(lambda.Write(), m, n_mat);
+   auto d_V = Reshape(V.Write(), m, m, n_mat);
+   Array<bool> converged_flag(1);
+   converged_flag[0] = true;
+   bool *d_converged_flag = converged_flag.ReadWrite();
+
+   mfem::forall(n_mat, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const bool flag = kernels::SymmetricEigensystem(
+                           &d_A(0,0,i), m, &d_lambda(0,i), &d_V(0,0,i), tol);
+      if (!flag) { d_converged_flag[0] = false; }
+   });
+
+   MFEM_VERIFY(converged_flag.HostRead()[0],
+               "Batch Jacobi eigensolver did not converge");
+}
+
 }
@@ -26,6 +26,14 @@ public:
    void LUFactor(DenseTensor &A, Array<int> &P) const override;
    void LUSolve(const DenseTensor &LU, const Array<int> &P,
                 Vector &x) const override;
+   void Det(const DenseTensor &A, Vector &det) const override;
+   void CholeskyFactor(DenseTensor &A) const override;
+   void CholeskySolve(const DenseTensor &L, Vector &x) const override;
+   void QRFactor(DenseTensor &A, Vector &tau) const override;
+   void QRSolve(const DenseTensor &QR, const Vector &tau,
+                Vector &x) const override;
+   void SymmetricEigensystem(const DenseTensor &A, Vector &lambda,
+                             DenseTensor &V) const override;
 };
 
 } // namespace mfem
@@ -23,6 +23,10 @@ BatchedDirectSolver::BatchedDirectSolver(const DenseTensor &A_, Mode mode_,
    {
       BatchedLinAlg::Get(backend).LUFactor(A, P);
    }
+   else if (mode == CHOLESKY)
+   {
+      BatchedLinAlg::Get(backend).CholeskyFactor(A);
+   }
    else
    {
       BatchedLinAlg::Get(backend).Invert(A);
@@ -36,6 +40,11 @@ void BatchedDirectSolver::Mult(const Vector &x, Vector &y) const
       y = x;
       BatchedLinAlg::Get(backend).LUSolve(A, P, y);
    }
+   else if (mode == CHOLESKY)
+   {
+      y = x;
+      BatchedLinAlg::Get(backend).CholeskySolve(A, y);
+   }
    else
    {
       BatchedLinAlg::Get(backend).Mult(A, x, y);
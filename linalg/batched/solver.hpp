@@ -18,11 +18,13 @@
 namespace mfem
 {
 
-/// @brief Solve block-diagonal systems using batched LU or inverses.
+/// @brief Solve block-diagonal systems using batched LU, Cholesky or inverses.
 ///
 /// LU factorization is more numerically stable, but exposes less fine-grained
 /// parallelism. Inverse matrices have worse conditioning (and increased setup
 /// time), but solving the system is more efficient in parallel (e.g. on GPUs).
+/// Cholesky factorization requires symmetric positive definite blocks (e.g.
+/// element mass matrices), and needs no pivoting.
 class BatchedDirectSolver : public Solver
 {
 public:
@@ -30,10 +32,11 @@ public:
    enum Mode
    {
       LU, ///< LU factorization.
-      INVERSE ///< Inverse matrices.
+      INVERSE, ///< Inverse matrices.
+      CHOLESKY ///< Cholesky factorization (SPD blocks only).
    };
 protected:
-   DenseTensor A; ///< The LU factors/inverses of the input matrices.
+   DenseTensor A; ///< Factors/inverses of the input matrices.
    Array<int> P; ///< Pivots (needed only for LU factors).
    Mode mode; ///< Solver mode.
    BatchedLinAlg::Backend backend; ///< Requested batched linear algebra backend.
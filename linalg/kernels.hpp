@@ -1936,6 +1936,264 @@ inline bool LUFactor(real_t *A, const int m, int *ipiv, const real_t tol=0.0)
    return pivot_flag;
 }
 
+/// @brief Compute the Cholesky factorization of the symmetric positive definite
+/// m x m matrix @a A.
+///
+/// The lower triangular factor L, such that L.L^t = A, overwrites the lower
+/// triangular part of @a A; the strictly upper triangular part is set to zero.
+///
+/// @param [in, out] A matrix
+/// @param [in] m size of the square matrix
+/// @param [in] tol optional fuzzy comparison tolerance. Defaults to 0.0.
+///
+/// @return true if the factorization succeeds, false otherwise (non-positive
+/// pivot).
+MFEM_HOST_DEVICE
+inline bool CholeskyFactor(real_t *A, const int m, const real_t tol=0.0)
+{
+   bool pivot_flag = true;
+
+   for (int j = 0; j < m; j++)
+   {
+      const real_t a_jj = A[j + m*j];
+      if (a_jj <= tol) { pivot_flag = false; }
+
+      const real_t l_jj = sqrt(fabs(a_jj));
+      const real_t l_jj_inv = 1.0 / l_jj;
+      A[j + m*j] = l_jj;
+      for (int i = j+1; i < m; i++)
+      {
+         A[i + m*j] *= l_jj_inv;
+         A[j + m*i] = 0.0;
+      }
+
+      for (int k = j+1; k < m; k++)
+      {
+         const real_t l_kj = A[k + m*j];
+         for (int i = k; i < m; i++)
+         {
+            A[i + m*k] -= A[i + m*j] * l_kj;
+         }
+      }
+   }
+
+   return pivot_flag;
+}
+
+/// @brief Assuming L.L^t = A factored matrix of size (m x m), compute
+/// x <- A^{-1} x, for a vector x of length m.
+//
+// @param [in] data Cholesky factor L of A
+// @param [in] m square matrix height
+// @param [in, out] x vector storing right-hand side and then solution
+MFEM_HOST_DEVICE
+inline void CholeskySolve(const real_t *data, const int m, real_t *x)
+{
+   // x <- L^{-1} x
+   for (int j = 0; j < m; j++)
+   {
+      const real_t x_j = (x[j] /= data[j + j * m]);
+      for (int i = j + 1; i < m; i++)
+      {
+         x[i] -= data[i + j * m] * x_j;
+      }
+   }
+   // x <- L^{-t} x
+   for (int j = m - 1; j >= 0; j--)
+   {
+      real_t x_j = x[j];
+      for (int i = j + 1; i < m; i++)
+      {
+         x_j -= data[i + j * m] * x[i];
+      }
+      x[j] = x_j / data[j + j * m];
+   }
+}
+
+/// @brief Compute the Householder QR factorization of the m x n matrix @a A,
+/// with m >= n.
+///
+/// On output, the upper triangular part of @a A contains the factor R, and the
+/// Householder vectors v_j (with implicit unit entry v_j(j) = 1) are stored
+/// below the diagonal. The orthogonal factor is Q = H_0 H_1 ... H_{n-1} with
+/// H_j = I - tau_j v_j v_j^t. This is the same storage convention as LAPACK's
+/// xGEQRF.
+///
+/// @param [in, out] A matrix
+/// @param [in] m number of rows of @a A
+/// @param [in] n number of columns of @a A
+/// @param [out] tau array of Householder scaling factors (length n)
+MFEM_HOST_DEVICE
+inline void QRFactor(real_t *A, const int m, const int n, real_t *tau)
+{
+   for (int j = 0; j < n; j++)
+   {
+      real_t *v = A + j*m;
+      const real_t alpha = v[j];
+      real_t sigma = 0.0;
+      for (int i = j+1; i < m; i++) { sigma += v[i]*v[i]; }
+
+      if (sigma == 0.0)
+      {
+         tau[j] = 0.0;
+         continue;
+      }
+
+      const real_t norm = sqrt(alpha*alpha + sigma);
+      const real_t beta = (alpha <= 0.0) ? norm : -norm;
+      const real_t scale = 1.0 / (alpha - beta);
+      for (int i = j+1; i < m; i++) { v[i] *= scale; }
+      tau[j] = (beta - alpha) / beta;
+      v[j] = beta;
+
+      // Apply H_j to the remaining columns
+      for (int k = j+1; k < n; k++)
+      {
+         real_t *a = A + k*m;
+         real_t w = a[j];
+         for (int i = j+1; i < m; i++) { w += v[i]*a[i]; }
+         w *= tau[j];
+         a[j] -= w;
+         for (int i = j+1; i < m; i++) { a[i] -= w*v[i]; }
+      }
+   }
+}
+
+/// @brief Given the QR factorization of an m x n matrix A (m >= n) computed
+/// by QRFactor(), compute the least-squares solution of A x = b.
+///
+/// On input, @a x contains the right-hand side b (length m). On output, the
+/// first n entries of @a x contain the solution, and the remaining m - n
+/// entries contain the components of the residual in the orthogonal
+/// complement of the range of A.
+//
+// @param [in] data QR factorization of A
+// @param [in] m number of rows of A
+// @param [in] n number of columns of A
+// @param [in] tau Householder scaling factors
+// @param [in, out] x vector storing right-hand side and then solution
+MFEM_HOST_DEVICE
+inline void QRSolve(const real_t *data, const int m, const int n,
+                    const real_t *tau, real_t *x)
+{
+   // x <- Q^t x
+   for (int j = 0; j < n; j++)
+   {
+      const real_t *v = data + j*m;
+      real_t w = x[j];
+      for (int i = j+1; i < m; i++) { w += v[i]*x[i]; }
+      w *= tau[j];
+      x[j] -= w;
+      for (int i = j+1; i < m; i++) { x[i] -= w*v[i]; }
+   }
+   // x <- R^{-1} x
+   for (int j = n - 1; j >= 0; j--)
+   {
+      const real_t x_j = (x[j] /= data[j + j * m]);
+      for (int i = 0; i < j; i++)
+      {
+         x[i] -= data[i + j * m] * x_j;
+      }
+   }
+}
+
+/// @brief Compute the eigenvalues and eigenvectors of the symmetric n x n
+/// matrix @a A using the cyclic Jacobi method.
+///
+/// The matrix @a A is overwritten: on output it is (approximately) diagonal.
+/// The eigenvalues are returned in ascending order in @a lambda, and the
+/// corresponding orthonormal eigenvectors are stored in the columns of the
+/// n x n matrix @a V.
+///
+/// @param [in, out] A symmetric matrix
+/// @param [in] n size of the square matrix
+/// @param [out] lambda array of eigenvalues (length n)
+/// @param [out] V matrix of eigenvectors (size n x n)
+/// @param [in] tol relative tolerance for the off-diagonal part of @a A
+/// @param [in] max_sweeps maximum number of Jacobi sweeps
+///
+/// @return true if the iteration converged within @a max_sweeps sweeps.
+MFEM_HOST_DEVICE
+inline bool SymmetricEigensystem(real_t *A, const int n, real_t *lambda,
+                                 real_t *V, const real_t tol,
+                                 const int max_sweeps = 50)
+{
+   for (int j = 0; j < n; j++)
+   {
+      for (int i = 0; i < n; i++) { V[i + n*j] = (i == j) ? 1.0 : 0.0; }
+   }
+
+   bool converged = false;
+   for (int sweep = 0; sweep <= max_sweeps; sweep++)
+   {
+      real_t off = 0.0, diag = 0.0;
+      for (int q = 0; q < n; q++)
+      {
+         diag += A[q + n*q]*A[q + n*q];
+         for (int p = 0; p < q; p++) { off += 2.0*A[p + n*q]*A[p + n*q]; }
+      }
+      if (off <= tol*tol*diag) { converged = true; break; }
+      if (sweep == max_sweeps) { break; }
+
+      for (int p = 0; p < n - 1; p++)
+      {
+         for (int q = p + 1; q < n; q++)
+         {
+            const real_t a_pq = A[p + n*q];
+            if (a_pq == 0.0) { continue; }
+
+            // Rotation J = [c s; -s c] in the (p,q) plane, chosen such that
+            // (J^t A J)_pq = 0
+            const real_t theta = (A[q + n*q] - A[p + n*p]) / (2.0*a_pq);
+            const real_t t = (theta >= 0.0 ? 1.0 : -1.0) /
+                             (fabs(theta) + sqrt(theta*theta + 1.0));
+            const real_t c = 1.0 / sqrt(t*t + 1.0);
+            const real_t s = t*c;
+
+            // A <- A J, V <- V J
+            for (int k = 0; k < n; k++)
+            {
+               const real_t a_kp = A[k + n*p], a_kq = A[k + n*q];
+               A[k + n*p] = c*a_kp - s*a_kq;
+               A[k + n*q] = s*a_kp + c*a_kq;
+               const real_t v_kp = V[k + n*p], v_kq = V[k + n*q];
+               V[k + n*p] = c*v_kp - s*v_kq;
+               V[k + n*q] = s*v_kp + c*v_kq;
+            }
+            // A <- J^t A
+            for (int k = 0; k < n; k++)
+            {
+               const real_t a_pk = A[p + n*k], a_qk = A[q + n*k];
+               A[p + n*k] = c*a_pk - s*a_qk;
+               A[q + n*k] = s*a_pk + c*a_qk;
+            }
+            A[p + n*q] = A[q + n*p] = 0.0;
+         }
+      }
+   }
+
+   // Sort the eigenpairs in ascending order
+   for (int i = 0; i < n; i++) { lambda[i] = A[i + n*i]; }
+   for (int i = 0; i < n - 1; i++)
+   {
+      int i_min = i;
+      for (int j = i + 1; j < n; j++)
+      {
+         if (lambda[j] < lambda[i_min]) { i_min = j; }
+      }
+      if (i_min != i)
+      {
+         internal::Swap<real_t>(lambda[i], lambda[i_min]);
+         for (int k = 0; k < n; k++)
+         {
+            internal::Swap<real_t>(V[k + n*i], V[k + n*i_min]);
+         }
+      }
+   }
+
+   return converged;
+}
+
 } // namespace kernels
 
 } // namespace mfem
@@ -35,6 +35,7 @@
 #include "mma.hpp"
 #include "batched/batched.hpp"
 #include "batched/gpu_blas.hpp"
+#include "batched/interleaved.hpp"
 #include "batched/solver.hpp"
 #include "tensor.hpp"
 #include "filteredsolver.hpp"
@@ -525,6 +525,445 @@ const real_t RK8Solver::c[] =
 };
 
 
+LowStorageRKSolver::LowStorageRKSolver(int s_, const real_t *A_,
+                                       const real_t *B_)
+   : s(s_), A(A_), B(B_), c(s_)
+{
+   MFEM_VERIFY(A[0] == 0.0, "The first coefficient A[0] must be zero.");
+   // Track the time levels of the registers x and dx, in units of dt
+   real_t c_x = 0.0, c_dx = 0.0;
+   for (int i = 0; i < s; i++)
+   {
+      c[i] = c_x;
+      c_dx = A[i]*c_dx + 1.0;
+      c_x += B[i]*c_dx;
+   }
+}
+
+void LowStorageRKSolver::Init(TimeDependentOperator &f_)
+{
+   ODESolver::Init(f_);
+   dx.SetSize(f->Width(), mem_type);
+   k.SetSize(f->Width(), mem_type);
+}
+
+void LowStorageRKSolver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   for (int i = 0; i < s; i++)
+   {
+      f->SetTime(t + c[i]*dt);
+      f->Mult(x, k);
+      if (i == 0) { dx.Set(dt, k); }
+      else { add(A[i], dx, dt, k, dx); }
+      x.Add(B[i], dx);
+   }
+   t += dt;
+}
+
+const real_t LowStorageRK3Solver::A[] =
+{
+   0., -5./9., -153./128.
+};
+const real_t LowStorageRK3Solver::B[] =
+{
+   1./3., 15./16., 8./15.
+};
+
+const real_t LowStorageRK4Solver::A[] =
+{
+   0.,
+   -567301805773./1357537059087.,
+   -2404267990393./2016746695238.,
+   -3550918686646./2091501179385.,
+   -1275806237668./842570457699.
+};
+const real_t LowStorageRK4Solver::B[] =
+{
+   1432997174477./9575080441755.,
+   5161836677717./13612068292357.,
+   1720146321549./2090206949498.,
+   3134564353537./4481467310338.,
+   2277821191437./14882151754819.
+};
+
+void SSPRK104Solver::Init(TimeDependentOperator &f_)
+{
+   ODESolver::Init(f_);
+   q.SetSize(f->Width(), mem_type);
+   k.SetSize(f->Width(), mem_type);
+}
+
+void SSPRK104Solver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   // Stages 1-5: forward Euler steps of size dt/6
+   q = x;
+   for (int i = 0; i < 5; i++)
+   {
+      f->SetTime(t + i*dt/6);
+      f->Mult(x, k);
+      x.Add(dt/6, k);
+   }
+   // q <- q/25 + 9/25 x, x <- 15 q - 5 x (at time t + dt/3)
+   add(1./25., q, 9./25., x, q);
+   add(15., q, -5., x, x);
+   // Stages 6-9
+   for (int i = 0; i < 4; i++)
+   {
+      f->SetTime(t + dt/3 + i*dt/6);
+      f->Mult(x, k);
+      x.Add(dt/6, k);
+   }
+   // Stage 10
+   f->SetTime(t + dt);
+   f->Mult(x, k);
+   add(q, 3./5., x, x);
+   x.Add(dt/10, k);
+   t += dt;
+}
+
+real_t PIStepController::Factor(real_t err, bool accepted)
+{
+   if (!std::isfinite(err))
+   {
+      prev_rejected = true;
+      return min_factor;
+   }
+   // Avoid division by zero and excessive growth for tiny errors
+   err = std::max(err, real_t(1e-10));
+   real_t factor;
+   if (accepted)
+   {
+      factor = safety*pow(err, -kI/order)*pow(err_prev, kP/order);
+      factor = std::min(factor, prev_rejected ? real_t(1.0) : max_factor);
+      err_prev = std::max(err, real_t(1e-4));
+   }
+   else
+   {
+      factor = std::min(safety*pow(err, real_t(-1.0)/order), real_t(1.0));
+   }
+   prev_rejected = !accepted;
+   return std::max(factor, min_factor);
+}
+
+AdaptiveODESolver::AdaptiveODESolver(int est_order_)
+   : est_order(est_order_), controller(&default_controller), rel_tol(1e-6),
+     abs_tol(1e-6),
+     dt_min(0.0), dt_max(infinity()), dt_last(0.0), max_rejections(50),
+     num_accepted(0), num_rejected(0)
+{
+   default_controller.SetOrder(est_order);
+}
+
+void AdaptiveODESolver::SetController(ODEStepController &ctrl)
+{
+   ctrl.SetOrder(est_order);
+   controller = &ctrl;
+}
+
+void AdaptiveODESolver::Init(TimeDependentOperator &f_)
+{
+   ODESolver::Init(f_);
+   const int n = f->Width();
+   x_new.SetSize(n, mem_type);
+   err.SetSize(n, mem_type);
+   werr.SetSize(n, mem_type);
+   controller->Reset();
+   num_accepted = num_rejected = 0;
+   dt_last = 0.0;
+}
+
+real_t AdaptiveODESolver::ErrorNorm(const Vector &x, const Vector &x_new_,
+                                    const Vector &err_)
+{
+   const int n = x.Size();
+   const real_t rtol = rel_tol, atol = abs_tol;
+   const auto d_x = x.Read();
+   const auto d_x_new = x_new_.Read();
+   const auto d_err = err_.Read();
+   auto d_werr = werr.Write();
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const real_t scale = atol + rtol*fmax(fabs(d_x[i]), fabs(d_x_new[i]));
+      d_werr[i] = d_err[i]/scale;
+   });
+   real_t loc[2] = { werr*werr, real_t(n) };
+#ifdef MFEM_USE_MPI
+   if (comm != MPI_COMM_NULL)
+   {
+      real_t glob[2];
+      MPI_Allreduce(loc, glob, 2, MPITypeMap<real_t>::mpi_type, MPI_SUM,
+                    comm);
+      return sqrt(glob[0]/glob[1]);
+   }
+#endif
+   return sqrt(loc[0]/loc[1]);
+}
+
+void AdaptiveODESolver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   MFEM_VERIFY(dt > 0.0, "Invalid time step size: " << dt);
+   dt = std::min(std::max(dt, dt_min), dt_max);
+   for (int rejections = 0; ; rejections++)
+   {
+      TrialStep(x, t, dt, x_new, err);
+      const real_t err_norm = ErrorNorm(x, x_new, err);
+      const bool accepted = controller->Accept(err_norm) || dt <= dt_min;
+      const real_t factor = controller->Factor(err_norm, accepted);
+      if (accepted)
+      {
+         x = x_new;
+         t += dt;
+         dt_last = dt;
+         num_accepted++;
+         AcceptStep();
+         dt = std::min(dt*factor, dt_max);
+         return;
+      }
+      num_rejected++;
+      MFEM_VERIFY(rejections < max_rejections, "Too many rejected steps at t = "
+                  << t << ", dt = " << dt);
+      dt = std::max(dt*factor, dt_min);
+   }
+}
+
+void AdaptiveODESolver::Run(Vector &x, real_t &t, real_t &dt, real_t tf)
+{
+   while (t < tf)
+   {
+      const real_t dt_rem = tf - t;
+      const bool last = (dt >= dt_rem);
+      real_t dt_step = last ? dt_rem : dt;
+      Step(x, t, dt_step);
+      if (last && dt_last == dt_rem) { t = tf; }
+      else { dt = dt_step; }
+   }
+}
+
+void AdaptiveODESolver::PrintStatistics(std::ostream &os) const
+{
+   os << "Adaptive time stepping: " << num_accepted << " accepted steps, "
+      << num_rejected << " rejected steps, last step size " << dt_last
+      << '\n';
+}
+
+EmbeddedExplicitRKSolver::EmbeddedExplicitRKSolver(
+   int s_, const real_t *a_, const real_t *b_, const real_t *bhat_,
+   const real_t *c_, int est_order, bool fsal_)
+   : AdaptiveODESolver(est_order), s(s_), a(a_), b(b_), bhat(bhat_), c(c_),
+     fsal(fsal_), use_fsal(true), k0_valid(false)
+{
+   k = new Vector[s];
+}
+
+void EmbeddedExplicitRKSolver::Init(TimeDependentOperator &f_)
+{
+   AdaptiveODESolver::Init(f_);
+   const int n = f->Width();
+   y.SetSize(n, mem_type);
+   for (int i = 0; i < s; i++)
+   {
+      k[i].SetSize(n, mem_type);
+   }
+   k0_valid = false;
+}
+
+void EmbeddedExplicitRKSolver::TrialStep(const Vector &x, real_t t, real_t dt,
+                                         Vector &x_new_, Vector &err_)
+{
+   // The first stage does not depend on dt and is reused by rejected steps
+   if (!k0_valid)
+   {
+      f->SetTime(t);
+      f->Mult(x, k[0]);
+      k0_valid = true;
+   }
+   for (int l = 0, i = 1; i < s; i++)
+   {
+      add(x, a[l++]*dt, k[0], y);
+      for (int j = 1; j < i; j++)
+      {
+         y.Add(a[l++]*dt, k[j]);
+      }
+
+      f->SetTime(t + c[i-1]*dt);
+      f->Mult(y, k[i]);
+   }
+   x_new_ = x;
+   err_ = 0.0;
+   for (int i = 0; i < s; i++)
+   {
+      x_new_.Add(b[i]*dt, k[i]);
+      err_.Add((b[i] - bhat[i])*dt, k[i]);
+   }
+}
+
+void EmbeddedExplicitRKSolver::AcceptStep()
+{
+   if (fsal && use_fsal)
+   {
+      // The last stage is f(x_new, t + dt)
+      k[0].Swap(k[s-1]);
+   }
+   else
+   {
+      k0_valid = false;
+   }
+}
+
+EmbeddedExplicitRKSolver::~EmbeddedExplicitRKSolver()
+{
+   delete [] k;
+}
+
+const real_t BogackiShampine32Solver::a[] =
+{
+   1./2.,
+   0., 3./4.,
+   2./9., 1./3., 4./9.
+};
+const real_t BogackiShampine32Solver::b[] =
+{
+   2./9., 1./3., 4./9., 0.
+};
+const real_t BogackiShampine32Solver::bhat[] =
+{
+   7./24., 1./4., 1./3., 1./8.
+};
+const real_t BogackiShampine32Solver::c[] =
+{
+   1./2., 3./4., 1.
+};
+
+const real_t DormandPrince54Solver::a[] =
+{
+   1./5.,
+   3./40., 9./40.,
+   44./45., -56./15., 32./9.,
+   19372./6561., -25360./2187., 64448./6561., -212./729.,
+   9017./3168., -355./33., 46732./5247., 49./176., -5103./18656.,
+   35./384., 0., 500./1113., 125./192., -2187./6784., 11./84.
+};
+const real_t DormandPrince54Solver::b[] =
+{
+   35./384., 0., 500./1113., 125./192., -2187./6784., 11./84., 0.
+};
+const real_t DormandPrince54Solver::bhat[] =
+{
+   5179./57600., 0., 7571./16695., 393./640., -92097./339200., 187./2100.,
+   1./40.
+};
+const real_t DormandPrince54Solver::c[] =
+{
+   1./5., 3./10., 4./5., 8./9., 1., 1.
+};
+
+EmbeddedDIRKSolver::EmbeddedDIRKSolver(int s_, const real_t *a_,
+                                       const real_t *b_, const real_t *bhat_,
+                                       const real_t *c_, int est_order)
+   : AdaptiveODESolver(est_order), s(s_), a(a_), b(b_), bhat(bhat_), c(c_)
+{
+   k = new Vector[s];
+}
+
+void EmbeddedDIRKSolver::Init(TimeDependentOperator &f_)
+{
+   AdaptiveODESolver::Init(f_);
+   const int n = f->Width();
+   y.SetSize(n, mem_type);
+   for (int i = 0; i < s; i++)
+   {
+      k[i].SetSize(n, mem_type);
+      k[i] = 0.0;
+   }
+}
+
+void EmbeddedDIRKSolver::TrialStep(const Vector &x, real_t t, real_t dt,
+                                   Vector &x_new_, Vector &err_)
+{
+   //  c[0]   | a[0]
+   //  c[1]   | a[1] a[2]
+   //  ...    |    ...
+   //  c[s-1] | ...   a[s(s+1)/2-1]
+   // --------+---------------------
+   //         | b[0] b[1] ... b[s-1]
+   for (int l = 0, i = 0; i < s; i++)
+   {
+      y = x;
+      for (int j = 0; j < i; j++)
+      {
+         y.Add(a[l++]*dt, k[j]);
+      }
+      const real_t a_ii = a[l++];
+
+      f->SetTime(t + c[i]*dt);
+      if (a_ii == 0.0)
+      {
+         f->Mult(y, k[i]);
+      }
+      else
+      {
+         // The previous value of k[i] is used as initial guess
+         f->ImplicitSolve(a_ii*dt, y, k[i]);
+         if (f->ImplicitVarTypeIsState())
+         {
+            ComputeSlopeFromState(a_ii*dt, y, k[i]);
+         }
+      }
+   }
+   x_new_ = x;
+   err_ = 0.0;
+   for (int i = 0; i < s; i++)
+   {
+      x_new_.Add(b[i]*dt, k[i]);
+      err_.Add((b[i] - bhat[i])*dt, k[i]);
+   }
+}
+
+EmbeddedDIRKSolver::~EmbeddedDIRKSolver()
+{
+   delete [] k;
+}
+
+const real_t EmbeddedSDIRK22Solver::a[] =
+{
+   1. - M_SQRT1_2,
+   M_SQRT1_2, 1. - M_SQRT1_2
+};
+const real_t EmbeddedSDIRK22Solver::b[] =
+{
+   M_SQRT1_2, 1. - M_SQRT1_2
+};
+const real_t EmbeddedSDIRK22Solver::bhat[] =
+{
+   1., 0.
+};
+const real_t EmbeddedSDIRK22Solver::c[] =
+{
+   1. - M_SQRT1_2, 1.
+};
+
+const real_t EmbeddedSDIRK54Solver::a[] =
+{
+   1./4.,
+   1./2., 1./4.,
+   17./50., -1./25., 1./4.,
+   371./1360., -137./2720., 15./544., 1./4.,
+   25./24., -49./48., 125./16., -85./12., 1./4.
+};
+const real_t EmbeddedSDIRK54Solver::b[] =
+{
+   25./24., -49./48., 125./16., -85./12., 1./4.
+};
+const real_t EmbeddedSDIRK54Solver::bhat[] =
+{
+   59./48., -17./96., 225./32., -85./12., 0.
+};
+const real_t EmbeddedSDIRK54Solver::c[] =
+{
+   1./4., 3./4., 11./20., 1./2., 1.
+};
+
+
 AdamsBashforthSolver::AdamsBashforthSolver(int s_, const real_t *a_):
    stages(s_), state(s_)
 {
@@ -1600,4 +2039,197 @@ void IMEX_DIRK_RK3::Step(Vector &x, real_t &t, real_t &dt)
 
 }
 
+ParallelInTimeSolver::ParallelInTimeSolver(ODESolver &fine_,
+                                           ODESolver &coarse_, Type type_)
+   : fine(fine_), coarse(coarse_), type(type_), slices(1), fine_steps(10),
+     coarse_steps(1), max_iter(-1), print_level(0), num_iter(0),
+     rel_tol(1e-10), rank(0), nranks(1)
+{ }
+
+#ifdef MFEM_USE_MPI
+ParallelInTimeSolver::ParallelInTimeSolver(MPI_Comm time_comm_,
+                                           ODESolver &fine_,
+                                           ODESolver &coarse_, Type type_)
+   : ParallelInTimeSolver(fine_, coarse_, type_)
+{
+   time_comm = time_comm_;
+   MPI_Comm_rank(time_comm, &rank);
+   MPI_Comm_size(time_comm, &nranks);
+}
+#endif
+
+void ParallelInTimeSolver::SetSlices(int slices_per_rank)
+{
+   MFEM_VERIFY(slices_per_rank > 0, "invalid number of slices");
+   slices = slices_per_rank;
+   if (f) { Init(*f); }
+}
+
+void ParallelInTimeSolver::Init(TimeDependentOperator &f_)
+{
+   ODESolver::Init(f_);
+   const int n = f->Width();
+   U.resize(slices + 1);
+   FU.resize(slices);
+   GU.resize(slices);
+   for (auto &v : U) { v.SetSize(n, mem_type); }
+   for (auto &v : FU) { v.SetSize(n, mem_type); }
+   for (auto &v : GU) { v.SetSize(n, mem_type); }
+   u_in.SetSize(n, mem_type);
+   g.SetSize(n, mem_type);
+}
+
+void ParallelInTimeSolver::Propagate(ODESolver &solver, int nsteps,
+                                     Vector &x, real_t t0, real_t dT)
+{
+   solver.Init(*f);
+   real_t t = t0;
+   for (int i = 0; i < nsteps; i++)
+   {
+      real_t h = dT/nsteps;
+      solver.Step(x, t, h);
+   }
+}
+
+real_t ParallelInTimeSolver::Norm(const Vector &x) const
+{
+#ifdef MFEM_USE_MPI
+   if (space_comm != MPI_COMM_NULL)
+   {
+      return std::sqrt(InnerProduct(space_comm, x, x));
+   }
+#endif
+   return x.Norml2();
+}
+
+void ParallelInTimeSolver::RecvPrev(Vector &x)
+{
+#ifdef MFEM_USE_MPI
+   MPI_Recv(x.HostWrite(), x.Size(), MPITypeMap<real_t>::mpi_type, rank - 1,
+            0, time_comm, MPI_STATUS_IGNORE);
+#else
+   MFEM_CONTRACT_VAR(x);
+   MFEM_ABORT("no previous rank in serial");
+#endif
+}
+
+void ParallelInTimeSolver::SendNext(const Vector &x)
+{
+#ifdef MFEM_USE_MPI
+   MPI_Send(x.HostRead(), x.Size(), MPITypeMap<real_t>::mpi_type, rank + 1,
+            0, time_comm);
+#else
+   MFEM_CONTRACT_VAR(x);
+   MFEM_ABORT("no next rank in serial");
+#endif
+}
+
+void ParallelInTimeSolver::Step(Vector &x, real_t &t, real_t &dt)
+{
+   MFEM_VERIFY(f, "Init() must be called before Step()");
+   const int N = nranks*slices;
+   const int first = rank*slices;
+   const real_t dT = dt/N;
+   auto t_slice = [&](int j) { return t + (first + j)*dT; };
+
+   // Initial coarse sweep
+   if (rank == 0) { U[0] = x; }
+   else { RecvPrev(U[0]); }
+   for (int j = 0; j < slices; j++)
+   {
+      GU[j] = U[j];
+      Propagate(coarse, coarse_steps, GU[j], t_slice(j), dT);
+      U[j+1] = GU[j];
+   }
+   if (rank < nranks - 1) { SendNext(U[slices]); }
+
+   const int max_it = (max_iter < 0) ? N : max_iter;
+   for (num_iter = 1; num_iter <= max_it; num_iter++)
+   {
+      // F-relaxation, in parallel over all slices
+      for (int j = 0; j < slices; j++)
+      {
+         FU[j] = U[j];
+         Propagate(fine, fine_steps, FU[j], t_slice(j), dT);
+      }
+      if (type == MGRIT)
+      {
+         // C-relaxation: move the fine values to the slice boundaries
+#ifdef MFEM_USE_MPI
+         if (nranks > 1)
+         {
+            const int prev = (rank > 0) ? rank - 1 : MPI_PROC_NULL;
+            const int next = (rank < nranks - 1) ? rank + 1 : MPI_PROC_NULL;
+            MPI_Sendrecv(FU[slices-1].HostRead(), u_in.Size(),
+                         MPITypeMap<real_t>::mpi_type, next, 1,
+                         u_in.HostWrite(), u_in.Size(),
+                         MPITypeMap<real_t>::mpi_type, prev, 1, time_comm,
+                         MPI_STATUS_IGNORE);
+            if (rank > 0) { U[0] = u_in; }
+         }
+#endif
+         for (int j = 1; j < slices; j++) { U[j] = FU[j-1]; }
+         // Second F-relaxation, and coarse propagation of the relaxed values
+         for (int j = 0; j < slices; j++)
+         {
+            FU[j] = U[j];
+            Propagate(fine, fine_steps, FU[j], t_slice(j), dT);
+            GU[j] = U[j];
+            Propagate(coarse, coarse_steps, GU[j], t_slice(j), dT);
+         }
+      }
+
+      // Sequential coarse correction, tracking the change of the slice values
+      real_t loc[2] = { 0.0, 0.0 }; // max change, max norm
+      if (rank > 0)
+      {
+         RecvPrev(u_in);
+         u_in -= U[0];
+         loc[0] = Norm(u_in);
+         U[0] += u_in;
+      }
+      for (int j = 0; j < slices; j++)
+      {
+         g = U[j];
+         Propagate(coarse, coarse_steps, g, t_slice(j), dT);
+         // u_in <- G(U_j) + F(U_j^old) - G(U_j^old) - U_{j+1}^old
+         add(g, -1.0, GU[j], u_in);
+         u_in += FU[j];
+         u_in -= U[j+1];
+         loc[0] = std::max(loc[0], Norm(u_in));
+         U[j+1] += u_in;
+         loc[1] = std::max(loc[1], Norm(U[j+1]));
+         GU[j] = g;
+      }
+      if (rank < nranks - 1) { SendNext(U[slices]); }
+
+      real_t glob[2] = { loc[0], loc[1] };
+#ifdef MFEM_USE_MPI
+      if (nranks > 1)
+      {
+         MPI_Allreduce(loc, glob, 2, MPITypeMap<real_t>::mpi_type, MPI_MAX,
+                       time_comm);
+      }
+#endif
+      if (print_level > 0 && rank == 0)
+      {
+         mfem::out << "ParallelInTimeSolver iteration " << num_iter
+                   << ": relative change = " << glob[0]/glob[1] << '\n';
+      }
+      if (glob[0] <= rel_tol*glob[1]) { break; }
+   }
+   num_iter = std::min(num_iter, max_it);
+
+   // Return the solution at the end of the window on all ranks
+   x = U[slices];
+#ifdef MFEM_USE_MPI
+   if (nranks > 1)
+   {
+      MPI_Bcast(x.HostReadWrite(), x.Size(), MPITypeMap<real_t>::mpi_type,
+                nranks - 1, time_comm);
+   }
+#endif
+   t += dt;
+}
+
 }
@@ -368,6 +368,358 @@ public:
 };
 
 
+/** A low-storage explicit Runge-Kutta method in the 2N form of Williamson,
+    "Low-storage Runge-Kutta schemes", J. Comput. Phys. 35 (1980). Each stage
+    i = 0, ..., s-1 performs the in-place updates
+       dx <- A[i] dx + dt f(x, t + c[i] dt),
+       x  <- x + B[i] dx,
+    with A[0] = 0. Independently of the number of stages, only the register dx
+    and one vector for the evaluation of f are stored, compared to s stage
+    vectors for ExplicitRKSolver. The abscissae c are computed from A and B. */
+class LowStorageRKSolver : public ODESolver
+{
+private:
+   int s;
+   const real_t *A, *B;
+   Array<real_t> c;
+   Vector dx, k;
+
+public:
+   LowStorageRKSolver(int s_, const real_t *A_, const real_t *B_);
+
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+};
+
+
+/// Williamson's three stage, third order low-storage (2N) RK method.
+class LowStorageRK3Solver : public LowStorageRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t A[3], B[3];
+
+public:
+   LowStorageRK3Solver() : LowStorageRKSolver(3, A, B) { }
+};
+
+
+/** Five stage, fourth order low-storage (2N) RK method of Carpenter and
+    Kennedy, "Fourth-order 2N-storage Runge-Kutta schemes", NASA TM 109112
+    (1994), solution 3. */
+class LowStorageRK4Solver : public LowStorageRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t A[5], B[5];
+
+public:
+   LowStorageRK4Solver() : LowStorageRKSolver(5, A, B) { }
+};
+
+
+/** Ten stage, fourth order strong stability preserving (SSP) RK method with
+    SSP coefficient 6, in the low-storage implementation of Ketcheson,
+    "Highly efficient strong stability-preserving Runge-Kutta methods with
+    low-storage implementations", SIAM J. Sci. Comput. 30 (2008). Only one
+    additional register (plus one vector for the evaluation of f) is
+    stored. */
+class SSPRK104Solver : public ODESolver
+{
+private:
+   Vector q, k;
+
+public:
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+};
+
+
+/** Abstract base class for step size controllers, used by AdaptiveODESolver
+    to select the next step size from the scaled error estimate of the current
+    step. A scaled error estimate <= 1 corresponds to a step that satisfies the
+    requested tolerances. */
+class ODEStepController
+{
+protected:
+   /// Order of the error estimate, i.e. (lowest order of the pair) + 1.
+   int order = 1;
+
+public:
+   /// Set the order of the error estimate.
+   void SetOrder(int order_) { order = order_; }
+
+   /// Return true if a step with scaled error estimate @a err is accepted.
+   virtual bool Accept(real_t err) const { return err <= 1.0; }
+
+   /** @brief Return the factor by which the current step size is multiplied
+       to obtain the next step size (if @a accepted is true) or the size of the
+       repeated step (if @a accepted is false). */
+   virtual real_t Factor(real_t err, bool accepted) = 0;
+
+   /// Reset the controller history, e.g. when restarting time integration.
+   virtual void Reset() { }
+
+   virtual ~ODEStepController() { }
+};
+
+
+/** Proportional-integral (PI) step size controller, see e.g. Hairer and Wanner,
+    "Solving Ordinary Differential Equations II", Section IV.2. The step size
+    factor for accepted steps is
+       safety * err^(-kI/k) * err_prev^(kP/k),
+    where k is the order of the error estimate and err_prev is the error of the
+    previous accepted step. Rejected steps are repeated with the elementary
+    controller factor safety * err^(-1/k). All factors are limited to the
+    interval [min_factor, max_factor], and the step size is not increased
+    directly after a rejected step. With kP = 0 and kI = 1 this is the
+    elementary (integral) controller. */
+class PIStepController : public ODEStepController
+{
+protected:
+   real_t kI, kP, safety, min_factor, max_factor;
+   real_t err_prev;
+   bool prev_rejected;
+
+public:
+   PIStepController(real_t kI_ = 0.7, real_t kP_ = 0.4, real_t safety_ = 0.9,
+                    real_t min_factor_ = 0.2, real_t max_factor_ = 5.0)
+      : kI(kI_), kP(kP_), safety(safety_), min_factor(min_factor_),
+        max_factor(max_factor_) { Reset(); }
+
+   /// Set the interval of allowed step size factors.
+   void SetFactorLimits(real_t min_factor_, real_t max_factor_)
+   { min_factor = min_factor_; max_factor = max_factor_; }
+
+   /// Set the safety factor (< 1).
+   void SetSafetyFactor(real_t safety_) { safety = safety_; }
+
+   real_t Factor(real_t err, bool accepted) override;
+
+   void Reset() override { err_prev = 1.0; prev_rejected = false; }
+};
+
+
+/** Abstract base class for adaptive time stepping methods using an embedded
+    error estimate.
+
+    Each call to Step() performs one accepted time step, starting with the
+    trial step size @a dt [in]. Trial steps whose weighted RMS error estimate
+    exceeds the tolerances (see SetTolerances()) are rejected and repeated
+    with a smaller step size. On output, @a t [out] = @a t [in] + h, where h is
+    the accepted step size (see GetLastStepSize()), and @a dt [out] is the
+    step size proposed by the ODEStepController for the next step. Run()
+    additionally limits the last step to reach the final time exactly. */
+class AdaptiveODESolver : public ODESolver
+{
+protected:
+   int est_order;
+   PIStepController default_controller;
+   ODEStepController *controller;
+   real_t rel_tol, abs_tol;
+   real_t dt_min, dt_max, dt_last;
+   int max_rejections;
+   int num_accepted, num_rejected;
+   Vector x_new, err, werr;
+#ifdef MFEM_USE_MPI
+   MPI_Comm comm = MPI_COMM_NULL;
+#endif
+
+   /** @brief Compute a trial step of size @a dt from the solution @a x at
+       time @a t. The new solution is returned in @a x_new_ and the embedded
+       error estimate (difference between the two solutions of the pair) in
+       @a err_. Implementations should not modify @a x. */
+   virtual void TrialStep(const Vector &x, real_t t, real_t dt,
+                          Vector &x_new_, Vector &err_) = 0;
+
+   /// Called after a trial step was accepted.
+   virtual void AcceptStep() { }
+
+   /// Weighted RMS norm of the error estimate @a err_.
+   real_t ErrorNorm(const Vector &x, const Vector &x_new_,
+                    const Vector &err_);
+
+public:
+   /** @brief Construct the solver given the order of the error estimate,
+       @a est_order_, i.e. (lowest order of the embedded pair) + 1. */
+   AdaptiveODESolver(int est_order_);
+
+#ifdef MFEM_USE_MPI
+   /// Set the communicator used for the global reduction of the error norm.
+   void SetComm(MPI_Comm comm_) { comm = comm_; }
+#endif
+
+   /** @brief Set the relative and absolute tolerances. The error in component
+       i is scaled by abs_tol + rel_tol max(|x_i(t)|, |x_i(t+dt)|). */
+   void SetTolerances(real_t rel_tol_, real_t abs_tol_)
+   { rel_tol = rel_tol_; abs_tol = abs_tol_; }
+
+   /** @brief Set the minimum and maximum step sizes. Steps of the minimum size
+       are always accepted. */
+   void SetStepLimits(real_t dt_min_, real_t dt_max_)
+   { dt_min = dt_min_; dt_max = dt_max_; }
+
+   /// Set the maximum number of consecutive rejected trial steps.
+   void SetMaxRejections(int max_rej) { max_rejections = max_rej; }
+
+   /** @brief Set the step size controller. The controller is not owned, and
+       it must remain valid while this object is used. */
+   void SetController(ODEStepController &ctrl);
+
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+
+   void Run(Vector &x, real_t &t, real_t &dt, real_t tf) override;
+
+   /// Return the size of the last accepted step.
+   real_t GetLastStepSize() const { return dt_last; }
+
+   /// Return the number of accepted steps since the last call to Init().
+   int GetNumAcceptedSteps() const { return num_accepted; }
+
+   /// Return the number of rejected steps since the last call to Init().
+   int GetNumRejectedSteps() const { return num_rejected; }
+
+   /// Print the step statistics.
+   void PrintStatistics(std::ostream &os = mfem::out) const;
+};
+
+
+/** An adaptive explicit Runge-Kutta method defined by an embedded Butcher
+    tableau, using the same storage convention as ExplicitRKSolver:
+    +--------+-------------------------------+
+    | c[0]   | a[0]                          |
+    | c[1]   | a[1] a[2]                     |
+    | ...    |    ...                        |
+    | c[s-2] | ...   a[s(s-1)/2-1]           |
+    +--------+-------------------------------+
+    |        | b[0]    b[1]    ... b[s-1]    |
+    |        | bhat[0] bhat[1] ... bhat[s-1] |
+    +--------+-------------------------------+
+    The solution is advanced with the weights b. If the method has the
+    "first same as last" (FSAL) property, the last stage of an accepted step
+    is reused as the first stage of the next step; in this case, the solution
+    returned by Step() must not be modified before the next call to Step()
+    (otherwise, disable this with UseFSAL() or call Init()). */
+class EmbeddedExplicitRKSolver : public AdaptiveODESolver
+{
+private:
+   int s;
+   const real_t *a, *b, *bhat, *c;
+   bool fsal, use_fsal, k0_valid;
+   Vector y, *k;
+
+protected:
+   void TrialStep(const Vector &x, real_t t, real_t dt,
+                  Vector &x_new_, Vector &err_) override;
+
+   void AcceptStep() override;
+
+public:
+   EmbeddedExplicitRKSolver(int s_, const real_t *a_, const real_t *b_,
+                            const real_t *bhat_, const real_t *c_,
+                            int est_order, bool fsal_ = false);
+
+   /// Enable or disable the reuse of the last stage for FSAL methods.
+   void UseFSAL(bool use) { use_fsal = use; }
+
+   void Init(TimeDependentOperator &f_) override;
+
+   virtual ~EmbeddedExplicitRKSolver();
+};
+
+
+/// The Bogacki-Shampine 3(2) pair, 4 stages (FSAL).
+class BogackiShampine32Solver : public EmbeddedExplicitRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[6], b[4], bhat[4], c[3];
+
+public:
+   BogackiShampine32Solver()
+      : EmbeddedExplicitRKSolver(4, a, b, bhat, c, 3, true) { }
+};
+
+
+/// The Dormand-Prince 5(4) pair, 7 stages (FSAL).
+class DormandPrince54Solver : public EmbeddedExplicitRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[21], b[7], bhat[7], c[6];
+
+public:
+   DormandPrince54Solver()
+      : EmbeddedExplicitRKSolver(7, a, b, bhat, c, 5, true) { }
+};
+
+
+/** An adaptive diagonally implicit Runge-Kutta method defined by an embedded
+    Butcher tableau, where the lower triangular matrix A (including the
+    diagonal) is stored by rows:
+    +--------+----------------------------------+
+    | c[0]   | a[0]                             |
+    | c[1]   | a[1] a[2]                        |
+    | ...    |    ...                           |
+    | c[s-1] | ...   a[s(s+1)/2-1]              |
+    +--------+----------------------------------+
+    |        | b[0]    b[1]    ... b[s-1]       |
+    |        | bhat[0] bhat[1] ... bhat[s-1]    |
+    +--------+----------------------------------+
+    Stages with a zero diagonal entry are evaluated explicitly. */
+class EmbeddedDIRKSolver : public AdaptiveODESolver
+{
+private:
+   int s;
+   const real_t *a, *b, *bhat, *c;
+   Vector y, *k;
+
+protected:
+   void TrialStep(const Vector &x, real_t t, real_t dt,
+                  Vector &x_new_, Vector &err_) override;
+
+public:
+   EmbeddedDIRKSolver(int s_, const real_t *a_, const real_t *b_,
+                      const real_t *bhat_, const real_t *c_, int est_order);
+
+   void Init(TimeDependentOperator &f_) override;
+
+   bool SupportsImplicitVariableType(ImplicitVariableType var) const override
+   {
+      return (var == ImplicitVariableType::STATE ||
+              var == ImplicitVariableType::SLOPE);
+   }
+
+   virtual ~EmbeddedDIRKSolver();
+};
+
+
+/** Two stage, singly diagonal implicit Runge-Kutta (SDIRK) method of order 2
+    with an embedded first order error estimate. L-stable. Same method as
+    SDIRK23Solver(2). */
+class EmbeddedSDIRK22Solver : public EmbeddedDIRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[3], b[2], bhat[2], c[2];
+
+public:
+   EmbeddedSDIRK22Solver() : EmbeddedDIRKSolver(2, a, b, bhat, c, 2) { }
+};
+
+
+/** Five stage, singly diagonal implicit Runge-Kutta (SDIRK) method of order 4
+    with an embedded third order error estimate. L-stable. From Hairer and
+    Wanner, "Solving Ordinary Differential Equations II", Table IV.6.5. */
+class EmbeddedSDIRK54Solver : public EmbeddedDIRKSolver
+{
+private:
+   static MFEM_EXPORT const real_t a[15], b[5], bhat[5], c[5];
+
+public:
+   EmbeddedSDIRK54Solver() : EmbeddedDIRKSolver(5, a, b, bhat, c, 4) { }
+};
+
+
 /// Backward Euler ODE solver. L-stable.
 class BackwardEulerSolver : public ODESolver
 {
@@ -1090,6 +1442,112 @@ public:
 };
 
 
+/** @brief Parallel-in-time integration with Parareal or two-level MGRIT.
+
+    A call to Step() integrates over the time window [t, t+dt], which is split
+    into N = P s time slices of equal length, where P is the size of the time
+    communicator and s is the number of slices per rank, see SetSlices(). Rank
+    p owns the consecutive slices p s, ..., (p+1) s - 1. In each slice, the
+    fine propagator F performs SetFineSteps() steps of the fine ODESolver and
+    the coarse propagator G performs SetCoarseSteps() steps of the coarse
+    ODESolver.
+
+    After an initial sequential coarse sweep, every iteration applies the fine
+    propagator to all slices in parallel, followed by the sequential coarse
+    correction U_{n+1} <- G(U_n) + F(U_n^old) - G(U_n^old). With #PARAREAL
+    (MGRIT with F-relaxation), the first k slice values are exact after k
+    iterations. With #MGRIT, FCF-relaxation is used, which typically needs
+    fewer iterations at the cost of a second fine propagation per iteration.
+    The iteration stops when the relative change of the slice values is
+    below the tolerance, see SetTolerance(), or after at most N iterations,
+    when the result equals the sequential fine solution.
+
+    Both ODESolvers must be one-step methods: they are re-initialized with the
+    TimeDependentOperator passed to Init() at the start of every slice. The
+    solution at the end of the window is returned on all ranks of the time
+    communicator. When the operator is also distributed in space, the time
+    communicator connects the ranks with the same spatial rank, e.g. as
+    created by MPI_Comm_split with color equal to the spatial rank, and the
+    spatial communicator has to be set with SetSpaceComm(). */
+class ParallelInTimeSolver : public ODESolver
+{
+public:
+   enum Type { PARAREAL, MGRIT };
+
+protected:
+   ODESolver &fine, &coarse;
+   Type type;
+   int slices, fine_steps, coarse_steps;
+   int max_iter, print_level, num_iter;
+   real_t rel_tol;
+   int rank, nranks;
+#ifdef MFEM_USE_MPI
+   MPI_Comm time_comm = MPI_COMM_NULL;
+   MPI_Comm space_comm = MPI_COMM_NULL;
+#endif
+   /// Slice values: U[j] is the solution at the start of local slice j.
+   std::vector<Vector> U;
+   /// Fine and coarse propagation of the slice values U.
+   std::vector<Vector> FU, GU;
+   Vector u_in, g;
+
+   /// Advance @a x from @a t0 by @a dT, using @a nsteps steps of @a solver.
+   void Propagate(ODESolver &solver, int nsteps, Vector &x, real_t t0,
+                  real_t dT);
+
+   /// Norm of @a x, global over the spatial communicator, if set.
+   real_t Norm(const Vector &x) const;
+
+   /// Receive @a x from the previous rank in the time communicator.
+   void RecvPrev(Vector &x);
+   /// Send @a x to the next rank in the time communicator.
+   void SendNext(const Vector &x);
+
+public:
+   /// Serial time integration with Parareal or MGRIT.
+   ParallelInTimeSolver(ODESolver &fine_, ODESolver &coarse_,
+                        Type type_ = PARAREAL);
+
+#ifdef MFEM_USE_MPI
+   /// Distribute the time slices over the ranks in @a time_comm_.
+   ParallelInTimeSolver(MPI_Comm time_comm_, ODESolver &fine_,
+                        ODESolver &coarse_, Type type_ = PARAREAL);
+
+   /// Set the communicator used to compute norms of distributed vectors.
+   void SetSpaceComm(MPI_Comm space_comm_) { space_comm = space_comm_; }
+#endif
+
+   void SetType(Type type_) { type = type_; }
+
+   /// Set the number of time slices owned by each rank (default: 1).
+   void SetSlices(int slices_per_rank);
+
+   /// Set the number of fine steps per time slice (default: 10).
+   void SetFineSteps(int nsteps) { fine_steps = nsteps; }
+
+   /// Set the number of coarse steps per time slice (default: 1).
+   void SetCoarseSteps(int nsteps) { coarse_steps = nsteps; }
+
+   /** @brief Set the maximum number of iterations; a negative value (the
+       default) means the number of time slices. */
+   void SetMaxIter(int max_iter_) { max_iter = max_iter_; }
+
+   /// Set the relative tolerance on the change of the slice values.
+   void SetTolerance(real_t rel_tol_) { rel_tol = rel_tol_; }
+
+   void SetPrintLevel(int print_level_) { print_level = print_level_; }
+
+   void Init(TimeDependentOperator &f_) override;
+
+   void Step(Vector &x, real_t &t, real_t &dt) override;
+
+   /// Number of iterations performed in the last call to Step().
+   int GetNumIterations() const { return num_iter; }
+
+   /// Solution at the start of the local time slice @a j, 0 <= j <= slices.
+   const Vector &GetSliceSolution(int j) const { return U[j]; }
+};
+
 }
 
 #endif
@@ -452,6 +452,81 @@ void OperatorJacobiSmoother::Mult(const Vector &x, Vector &y) const
    });
 }
 
+BlockJacobiSmoother::BlockJacobiSmoother(const DenseTensor &blocks,
+                                         const Array<int> &block_dofs,
+                                         const Array<int> &ess_tdof_list,
+                                         const real_t dmpng)
+   :
+   Solver(block_dofs.Size()),
+   dofs(block_dofs),
+   damping(dmpng),
+   oper(NULL),
+   residual(height),
+   bx(height),
+   by(height)
+{
+   const int m = blocks.SizeI();
+   MFEM_VERIFY(blocks.SizeJ() == m && m*blocks.SizeK() == height,
+               "invalid block sizes");
+
+   // Replace the rows and columns of the essential dofs with the identity
+   DenseTensor ess_blocks(m, m, blocks.SizeK());
+   const real_t *h_blocks = blocks.HostRead();
+   std::copy(h_blocks, h_blocks + blocks.TotalSize(), ess_blocks.HostWrite());
+   if (ess_tdof_list.Size() > 0)
+   {
+      Array<int> pos(height);
+      pos = -1;
+      for (int p = 0; p < height; p++) { pos[dofs[p]] = p; }
+      const int *h_ess = ess_tdof_list.HostRead();
+      for (int i = 0; i < ess_tdof_list.Size(); i++)
+      {
+         const int p = pos[h_ess[i]];
+         MFEM_ASSERT(p >= 0, "essential dof " << h_ess[i]
+                     << " is not in a block");
+         DenseMatrix &B = ess_blocks(p / m);
+         const int r = p % m;
+         for (int j = 0; j < m; j++) { B(r, j) = B(j, r) = 0.0; }
+         B(r, r) = 1.0;
+      }
+   }
+   block_solver.reset(new BatchedDirectSolver(ess_blocks,
+                                              BatchedDirectSolver::LU));
+}
+
+BlockJacobiSmoother::~BlockJacobiSmoother() { }
+
+void BlockJacobiSmoother::Mult(const Vector &x, Vector &y) const
+{
+   MFEM_VERIFY(x.Size() == Width(), "invalid input vector");
+   MFEM_VERIFY(y.Size() == Height(), "invalid output vector");
+
+   if (iterative_mode)
+   {
+      MFEM_VERIFY(oper, "iterative_mode == true requires the forward operator");
+      oper->Mult(y, residual);  // r = A y
+      subtract(x, residual, residual); // r = x - A y
+   }
+   else
+   {
+      residual = x;
+      y.UseDevice(true);
+      y = 0.0;
+   }
+   const auto D = dofs.Read();
+   const auto R = residual.Read();
+   auto BX = bx.Write();
+   mfem::forall(height, [=] MFEM_HOST_DEVICE (int p) { BX[p] = R[D[p]]; });
+   block_solver->Mult(bx, by);
+   const auto BY = by.Read();
+   const real_t d = damping;
+   auto Y = y.ReadWrite();
+   mfem::forall(height, [=] MFEM_HOST_DEVICE (int p)
+   {
+      Y[D[p]] += d * BY[p];
+   });
+}
+
 OperatorChebyshevSmoother::OperatorChebyshevSmoother(const Operator &oper_,
                                                      const Vector &d,
                                                      const Array<int>& ess_tdofs,
@@ -496,6 +496,49 @@ public:
 };
 
 /// Chebyshev accelerated smoothing with given vector, no matrix necessary
+class BatchedDirectSolver;
+
+/// Block Jacobi smoother with small dense diagonal blocks.
+/** The blocks are typically obtained with BilinearForm::AssembleBlockDiagonal()
+    (blocks coupling the vector components of each node) or with
+    BilinearForm::AssembleElementBlockDiagonal() (element blocks for
+    discontinuous spaces). The blocks are factored once with a
+    BatchedDirectSolver, and each application of the smoother is a batched
+    solve. */
+class BlockJacobiSmoother : public Solver
+{
+public:
+   /** Setup a block Jacobi smoother with the blocks @a blocks, of dimensions
+       m x m x n. The rows and columns of block k correspond to the entries
+       block_dofs[m*k], ..., block_dofs[m*k+m-1], and @a block_dofs must be a
+       permutation of the entries of the input vectors.
+
+       As in OperatorJacobiSmoother, it is assumed that the underlying operator
+       acts as the identity on entries in @a ess_tdof_list: the corresponding
+       rows and columns of the blocks are replaced with the identity. */
+   BlockJacobiSmoother(const DenseTensor &blocks,
+                       const Array<int> &block_dofs,
+                       const Array<int> &ess_tdof_list,
+                       const real_t damping=1.0);
+
+   ~BlockJacobiSmoother();
+
+   /// Approach the solution of the linear system by applying block Jacobi
+   /// smoothing.
+   void Mult(const Vector &x, Vector &y) const;
+
+   /** @brief Set the forward operator, used only when iterative_mode is true.
+       The blocks are not recomputed. */
+   void SetOperator(const Operator &op) { oper = &op; }
+
+private:
+   std::unique_ptr<BatchedDirectSolver> block_solver;
+   Array<int> dofs;
+   const real_t damping;
+   const Operator *oper; // not owned
+   mutable Vector residual, bx, by;
+};
+
 /** Potentially useful with tensorized operators, for example. This is just a
     very basic Chebyshev iteration, if you want tolerances, iteration control,
     etc. wrap this with SLISolver. */
@@ -18,6 +18,7 @@
 #include "../general/binaryio.hpp"
 #include "../general/text.hpp"
 #include "../general/device.hpp"
+#include "../general/forall.hpp"
 #include "../general/tic_toc.hpp"
 #include "../general/gecko.hpp"
 #include "../general/kdtree.hpp"
@@ -38,6 +39,10 @@
 #include <unordered_set>
 #include <list>
 
+#ifdef MFEM_USE_OPENMP
+#include <omp.h>
+#endif
+
 // Include the METIS header, if using version 5. If using METIS 4, the needed
 // declarations are inlined below, i.e. no header is needed.
 #if defined(MFEM_USE_METIS) && defined(MFEM_USE_METIS_5)
@@ -5335,6 +5340,100 @@ Mesh::Mesh(Mesh *orig_mesh, int ref_factor, int ref_type)
    MakeRefined_(*orig_mesh, ref_factors, ref_type);
 }
 
+// Compute the physical coordinates of the points RG.RefPts in all elements of
+// the single-geometry mesh @a mesh. The result @a X has the layout (sdim,
+// npts, NE). The coordinates are interpolated from the element-wise nodes with
+// the tensor-product kernels of QuadratureInterpolator when possible, or with
+// a dense interpolation matrix otherwise. Returns false if @a mesh is not
+// supported, in which case @a X is not set.
+static bool GetRefinedPoints(Mesh &mesh, const RefinedGeometry &RG,
+                             Vector &X)
+{
+   const int dim = mesh.Dimension();
+   const int sdim = mesh.SpaceDimension();
+   const int ne = mesh.GetNE();
+   const int npts = RG.RefPts.GetNPoints();
+
+   // Without nodes, view the vertex coordinates as an order 1 H1 field.
+   std::unique_ptr<H1_FECollection> vertex_fec;
+   std::unique_ptr<FiniteElementSpace> vertex_fes;
+   const FiniteElementSpace *fes = mesh.GetNodalFESpace();
+   Vector nodes;
+   if (fes)
+   {
+      if (!QuadratureInterpolator::SupportsFESpace(*fes) ||
+          fes->GetTypicalFE()->GetMapType() != FiniteElement::VALUE)
+      {
+         return false;
+      }
+      nodes.MakeRef(*mesh.GetNodes(), 0, mesh.GetNodes()->Size());
+   }
+   else
+   {
+      vertex_fec.reset(new H1_FECollection(1, dim));
+      vertex_fes.reset(new FiniteElementSpace(&mesh, vertex_fec.get(), sdim));
+      fes = vertex_fes.get();
+      mesh.GetVertices(nodes);
+   }
+
+   const FiniteElement *fe = fes->GetTypicalFE();
+   const int nd = fe->GetDof();
+   const TensorBasisElement *tfe = dynamic_cast<const TensorBasisElement*>(fe);
+   const bool tensor = tfe && Geometry::IsTensorProduct(fe->GetGeomType());
+
+   const Operator *R = fes->GetElementRestriction(
+                          tensor ? ElementDofOrdering::LEXICOGRAPHIC :
+                          ElementDofOrdering::NATIVE);
+   Vector xe(R->Height());
+   R->Mult(nodes, xe);
+   X.SetSize(sdim*npts*ne);
+
+   if (tensor)
+   {
+      // The points RG.RefPts are the tensor product of the 1D points, in
+      // lexicographic order.
+      const int d1d = fe->GetOrder() + 1;
+      const int q1d = RG.Times + 1;
+      const int max_1d = DeviceDofQuadLimits::Get().MAX_INTERP_1D;
+      if (d1d > max_1d || q1d > max_1d) { return false; }
+
+      const Poly_1D::Basis &basis1d = tfe->GetBasis1D();
+      Vector B(q1d*d1d), shape(d1d);
+      real_t *b = B.HostWrite();
+      for (int i = 0; i < q1d; i++)
+      {
+         basis1d.Eval(RG.RefPts[i].x, shape);
+         for (int j = 0; j < d1d; j++) { b[i + q1d*j] = shape(j); }
+      }
+      QuadratureInterpolator::TensorEvalKernels::Run(
+         dim, QVectorLayout::byVDIM, sdim, d1d, q1d, ne, B.Read(), xe.Read(),
+         X.Write(), sdim, d1d, q1d);
+      return true;
+   }
+
+   Vector B(npts*nd), shape(nd);
+   real_t *b = B.HostWrite();
+   for (int i = 0; i < npts; i++)
+   {
+      fe->CalcShape(RG.RefPts[i], shape);
+      for (int j = 0; j < nd; j++) { b[i + npts*j] = shape(j); }
+   }
+   const auto d_B = Reshape(B.Read(), npts, nd);
+   const auto d_xe = Reshape(xe.Read(), nd, sdim, ne);
+   auto d_X = Reshape(X.Write(), sdim, npts, ne);
+   mfem::forall(npts*ne, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = k % npts, e = k / npts;
+      for (int c = 0; c < sdim; c++)
+      {
+         real_t x = 0.0;
+         for (int j = 0; j < nd; j++) { x += d_B(i, j) * d_xe(j, c, e); }
+         d_X(c, i, e) = x;
+      }
+   });
+   return true;
+}
+
 void Mesh::MakeRefined_(Mesh &orig_mesh, const Array<int> &ref_factors,
                         int ref_type)
 {
@@ -5382,6 +5481,45 @@ void Mesh::MakeRefined_(Mesh &orig_mesh, const Array<int> &ref_factors,
    DenseMatrix phys_pts;
    GeometryRefiner refiner(q_type);
 
+   // With a single geometry and refinement factor, the points of the
+   // refinement template are evaluated in all elements at once.
+   Vector batch_pts;
+   const bool batched = orig_ne > 0 && !var_order && !orig_mesh.NURBSext &&
+                        orig_mesh.GetNumGeometries(Dim) == 1 &&
+                        GetRefinedPoints(orig_mesh, *refiner.Refine(
+                                            orig_mesh.GetElementGeometry(0),
+                                            min_ref), batch_pts);
+   const real_t *h_batch_pts = batched ? batch_pts.HostRead() : nullptr;
+
+   // Return in rdofs the vertex indices and in phys_pts the coordinates of
+   // the template points of the element el, in the ordering of rfes.
+   auto GetElementPoints = [&](int el, const RefinedGeometry &RG,
+                               const int *c2h_map)
+   {
+      if (batched)
+      {
+         rfes.GetElementToDofTable().GetRow(el, rdofs);
+         const int npts = RG.RefPts.Size();
+         const real_t *X = h_batch_pts + spaceDim*npts*el;
+         phys_pts.SetSize(spaceDim, npts);
+         for (int i = 0; i < npts; i++)
+         {
+            for (int d = 0; d < spaceDim; d++)
+            {
+               phys_pts(d, c2h_map[i]) = X[d + spaceDim*i];
+            }
+         }
+      }
+      else
+      {
+         rfes.GetElementDofs(el, rdofs);
+         const FiniteElement *rfe = rfes.GetFE(el);
+         orig_mesh.GetElementTransformation(el)->Transform(rfe->GetNodes(),
+                                                           phys_pts);
+      }
+      MFEM_ASSERT(rdofs.Size() == RG.RefPts.Size(), "");
+   };
+
    // Add refined elements and set vertex coordinates
    for (int el = 0; el < orig_ne; el++)
    {
@@ -5390,12 +5528,8 @@ void Mesh::MakeRefined_(Mesh &orig_mesh, const Array<int> &ref_factors,
       int nvert = Geometry::NumVerts[geom];
       RefinedGeometry &RG = *refiner.Refine(geom, ref_factors[el]);
 
-      rfes.GetElementDofs(el, rdofs);
-      MFEM_ASSERT(rdofs.Size() == RG.RefPts.Size(), "");
-      const FiniteElement *rfe = rfes.GetFE(el);
-      orig_mesh.GetElementTransformation(el)->Transform(rfe->GetNodes(),
-                                                        phys_pts);
       const int *c2h_map = rfec.GetDofMap(geom, ref_factors[el]);
+      GetElementPoints(el, RG, c2h_map);
       for (int i = 0; i < phys_pts.Width(); i++)
       {
          vertices[rdofs[i]].SetCoords(spaceDim, phys_pts.GetColumn(i));
@@ -5468,16 +5602,13 @@ void Mesh::MakeRefined_(Mesh &orig_mesh, const Array<int> &ref_factors,
          Geometry::Type geom = orig_mesh.GetElementBaseGeometry(iel);
          int nvert = Geometry::NumVerts[geom];
          RefinedGeometry &RG = *refiner.Refine(geom, ref_factors[iel]);
-         rfes.GetElementDofs(iel, rdofs);
-         const FiniteElement *rfe = rfes.GetFE(iel);
-         orig_mesh.GetElementTransformation(iel)->Transform(rfe->GetNodes(),
-                                                            phys_pts);
+         const int *c2h_map = rfec.GetDofMap(geom, ref_factors[iel]);
+         GetElementPoints(iel, RG, c2h_map);
          const int *node_map = NULL;
          const H1_FECollection *h1_fec =
             dynamic_cast<const H1_FECollection *>(nodal_fec);
          if (h1_fec != NULL) { node_map = h1_fec->GetDofMap(geom); }
          const int *vertex_map = vertex_fec.GetDofMap(geom);
-         const int *c2h_map = rfec.GetDofMap(geom, ref_factors[iel]);
          for (int jel = 0; jel < RG.RefGeoms.Size()/nvert; jel++)
          {
             nodal_fes->GetElementVDofs(el_counter++, dofs);
@@ -8330,6 +8461,11 @@ void Mesh::GetVertexToVertexTable(DSTable &v_to_v) const
 
 int Mesh::GetElementToEdgeTable(Table &e_to_f)
 {
+   if (sort_based_topology && !edge_vertex && Dim > 1)
+   {
+      return GetSortedElementToEdgeTable(e_to_f);
+   }
+
    int i, NumberOfEdges;
 
    DSTable v_to_v(NumOfVertices);
@@ -8367,6 +8503,307 @@ int Mesh::GetElementToEdgeTable(Table &e_to_f)
    return NumberOfEdges;
 }
 
+#ifdef MFEM_USE_OPENMP
+bool Mesh::sort_based_topology = true;
+#else
+bool Mesh::sort_based_topology = false;
+#endif
+
+// Parallel loop and atomic operations of the sort-based topology
+// construction, using nt threads
+#ifdef MFEM_USE_OPENMP
+#define MFEM_TOPOLOGY_PARALLEL_FOR _Pragma("omp parallel for num_threads(nt)")
+#define MFEM_TOPOLOGY_ATOMIC _Pragma("omp atomic")
+#define MFEM_TOPOLOGY_ATOMIC_CAPTURE _Pragma("omp atomic capture")
+#else
+#define MFEM_TOPOLOGY_PARALLEL_FOR
+#define MFEM_TOPOLOGY_ATOMIC
+#define MFEM_TOPOLOGY_ATOMIC_CAPTURE
+#endif
+
+// Number of threads used by the sort-based topology construction
+static int TopologyNumThreads(int n)
+{
+#ifdef MFEM_USE_OPENMP
+   return std::max(1, std::min(omp_get_max_threads(), n/4096));
+#else
+   MFEM_CONTRACT_VAR(n);
+   return 1;
+#endif
+}
+
+// First index of the chunk t of nt chunks of [0, n)
+static inline int ChunkBegin(int n, int t, int nt)
+{
+   return static_cast<int>(static_cast<long long>(n)*t/nt);
+}
+
+/* Number the keys k(i) = (keys[0][i], ..., keys[nk-1][i]), 0 <= i < n, where
+   n is the size of the key arrays, by their first occurrence among the first
+   @a m keys. This is the numbering obtained by inserting the first m keys one
+   by one in a DSTable or an STable3D. On return, ids[i] is the number of k(i),
+   or -1 if k(i), i >= m, is not one of the first m keys. Returns the number of
+   distinct keys among the first m.
+
+   The keys are sorted by a counting sort on keys[0], whose values are in
+   [0, nrows), followed by an insertion sort of the (short) rows by the other
+   keys and by the index i. */
+static int NumberKeysByFirstOccurrence(int nk, const Array<int> *keys,
+                                       int nrows, int m, Array<int> &ids)
+{
+   const int n = keys[0].Size();
+   const int nt = TopologyNumThreads(n);
+   const int *k0 = keys[0].GetData();
+   ids.SetSize(n);
+
+   Array<int> row_offsets(nrows+1), pos(nrows), perm(n), first(n);
+   row_offsets = 0;
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int i = 0; i < n; i++)
+   {
+      MFEM_TOPOLOGY_ATOMIC
+      row_offsets[k0[i]+1]++;
+   }
+   row_offsets.PartialSum();
+   std::copy(row_offsets.begin(), row_offsets.end()-1, pos.begin());
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int i = 0; i < n; i++)
+   {
+      int slot;
+      MFEM_TOPOLOGY_ATOMIC_CAPTURE
+      slot = pos[k0[i]]++;
+      perm[slot] = i;
+   }
+
+   auto less = [&](int i, int j)
+   {
+      for (int k = 1; k < nk; k++)
+      {
+         if (keys[k][i] != keys[k][j]) { return keys[k][i] < keys[k][j]; }
+      }
+      return i < j;
+   };
+   auto same_key = [&](int i, int j)
+   {
+      for (int k = 1; k < nk; k++)
+      {
+         if (keys[k][i] != keys[k][j]) { return false; }
+      }
+      return true;
+   };
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int r = 0; r < nrows; r++)
+   {
+      int *row = perm.GetData() + row_offsets[r];
+      const int size = row_offsets[r+1] - row_offsets[r];
+      for (int a = 1; a < size; a++)
+      {
+         const int i = row[a];
+         int b = a;
+         for ( ; b > 0 && less(i, row[b-1]); b--) { row[b] = row[b-1]; }
+         row[b] = i;
+      }
+      // The first index of each run of equal keys is the first occurrence.
+      for (int a = 0, s = 0; a < size; a++)
+      {
+         if (!same_key(row[a], row[s])) { s = a; }
+         first[row[a]] = row[s];
+      }
+   }
+
+   // Exclusive prefix sum of the first occurrences, computed by chunks
+   Array<int> chunk_sum(nt+1);
+   chunk_sum = 0;
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int t = 0; t < nt; t++)
+   {
+      int sum = 0;
+      for (int i = ChunkBegin(m, t, nt); i < ChunkBegin(m, t+1, nt); i++)
+      {
+         ids[i] = sum;
+         sum += (first[i] == i);
+      }
+      chunk_sum[t+1] = sum;
+   }
+   chunk_sum.PartialSum();
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int t = 0; t < nt; t++)
+   {
+      for (int i = ChunkBegin(m, t, nt); i < ChunkBegin(m, t+1, nt); i++)
+      {
+         ids[i] += chunk_sum[t];
+      }
+   }
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int i = 0; i < n; i++)
+   {
+      if (first[i] != i || i >= m)
+      {
+         ids[i] = (first[i] < m) ? ids[first[i]] : -1;
+      }
+   }
+   return chunk_sum[nt];
+}
+
+int Mesh::GetSortedElementToEdgeTable(Table &e_to_f)
+{
+   // The edges of the elements are followed by the edges of the boundary
+   // elements (by the boundary elements themselves in 2D).
+   const int NE = NumOfElements, NBE = NumOfBdrElements;
+   Array<int> offsets(NE + NBE + 1);
+   offsets[0] = 0;
+   for (int i = 0; i < NE; i++)
+   {
+      offsets[i+1] = offsets[i] + elements[i]->GetNEdges();
+   }
+   for (int i = 0; i < NBE; i++)
+   {
+      const int nbe = (Dim == 2) ? 1 : boundary[i]->GetNEdges();
+      offsets[NE+i+1] = offsets[NE+i] + nbe;
+   }
+
+   Array<int> keys[2], ids;
+   keys[0].SetSize(offsets[NE+NBE]);
+   keys[1].SetSize(offsets[NE+NBE]);
+   const int nt = TopologyNumThreads(NE + NBE);
+   MFEM_CONTRACT_VAR(nt); // unused without OpenMP
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int i = 0; i < NE + NBE; i++)
+   {
+      const Element *el = (i < NE) ? elements[i] : boundary[i-NE];
+      const int *v = el->GetVertices();
+      for (int j = offsets[i]; j < offsets[i+1]; j++)
+      {
+         int v0 = v[0], v1 = v[1];
+         if (i < NE || Dim == 3)
+         {
+            const int *ev = el->GetEdgeVertices(j - offsets[i]);
+            v0 = v[ev[0]];
+            v1 = v[ev[1]];
+         }
+         keys[0][j] = std::min(v0, v1);
+         keys[1][j] = std::max(v0, v1);
+      }
+   }
+   const int num_edges = NumberKeysByFirstOccurrence(2, keys, NumOfVertices,
+                                                     offsets[NE], ids);
+
+   auto fill_table = [&](int first, int nrows, Table &table)
+   {
+      table.MakeI(nrows);
+      for (int i = 0; i < nrows; i++)
+      {
+         table.AddColumnsInRow(i, offsets[first+i+1] - offsets[first+i]);
+      }
+      table.MakeJ();
+      MFEM_TOPOLOGY_PARALLEL_FOR
+      for (int i = 0; i < nrows; i++)
+      {
+         for (int j = offsets[first+i]; j < offsets[first+i+1]; j++)
+         {
+            table.AddConnection(i, ids[j]);
+         }
+      }
+      table.ShiftUpI();
+   };
+   fill_table(0, NE, e_to_f);
+   if (Dim == 2)
+   {
+      be_to_face.SetSize(NBE);
+      for (int i = 0; i < NBE; i++) { be_to_face[i] = ids[offsets[NE+i]]; }
+   }
+   else
+   {
+      if (bel_to_edge == NULL) { bel_to_edge = new Table; }
+      fill_table(NE, NBE, *bel_to_edge);
+   }
+   return num_edges;
+}
+
+void Mesh::GetSortedElementToFaceTable()
+{
+   // The faces of the elements are followed by the boundary elements.
+   const int NE = NumOfElements, NBE = NumOfBdrElements;
+   Array<int> offsets(NE + NBE + 1);
+   offsets[0] = 0;
+   for (int i = 0; i < NE; i++)
+   {
+      offsets[i+1] = offsets[i] + elements[i]->GetNFaces();
+   }
+   for (int i = 0; i < NBE; i++) { offsets[NE+i+1] = offsets[NE+i] + 1; }
+
+   Array<int> keys[3], ids;
+   for (int k = 0; k < 3; k++) { keys[k].SetSize(offsets[NE+NBE]); }
+   const int nt = TopologyNumThreads(NE + NBE);
+   MFEM_CONTRACT_VAR(nt); // unused without OpenMP
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int i = 0; i < NE + NBE; i++)
+   {
+      const Element *el = (i < NE) ? elements[i] : boundary[i-NE];
+      const int *v = el->GetVertices();
+      for (int j = offsets[i]; j < offsets[i+1]; j++)
+      {
+         int fv[4], nfv;
+         if (i < NE)
+         {
+            const int *lfv = el->GetFaceVertices(j - offsets[i]);
+            nfv = el->GetNFaceVertices(j - offsets[i]);
+            for (int k = 0; k < nfv; k++) { fv[k] = v[lfv[k]]; }
+         }
+         else
+         {
+            nfv = el->GetNVertices();
+            for (int k = 0; k < nfv; k++) { fv[k] = v[k]; }
+         }
+         // As in STable3D, a face is identified by its 3 smallest vertices.
+         std::sort(fv, fv + nfv);
+         for (int k = 0; k < 3; k++) { keys[k][j] = fv[k]; }
+      }
+   }
+   NumOfFaces = NumberKeysByFirstOccurrence(3, keys, NumOfVertices,
+                                            offsets[NE], ids);
+
+   // Repeated faces of an element (e.g. in periodic meshes) are listed once,
+   // as in Table::Push().
+   auto is_repeated = [&](int j, int i)
+   {
+      for (int k = offsets[i]; k < j; k++)
+      {
+         if (ids[k] == ids[j]) { return true; }
+      }
+      return false;
+   };
+   delete el_to_face;
+   el_to_face = new Table;
+   el_to_face->MakeI(NE);
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int i = 0; i < NE; i++)
+   {
+      for (int j = offsets[i]; j < offsets[i+1]; j++)
+      {
+         if (!is_repeated(j, i)) { el_to_face->AddAColumnInRow(i); }
+      }
+   }
+   el_to_face->MakeJ();
+   MFEM_TOPOLOGY_PARALLEL_FOR
+   for (int i = 0; i < NE; i++)
+   {
+      for (int j = offsets[i]; j < offsets[i+1]; j++)
+      {
+         if (!is_repeated(j, i)) { el_to_face->AddConnection(i, ids[j]); }
+      }
+   }
+   el_to_face->ShiftUpI();
+
+   be_to_face.SetSize(NBE);
+   for (int i = 0; i < NBE; i++)
+   {
+      be_to_face[i] = ids[offsets[NE+i]];
+      MFEM_VERIFY(be_to_face[i] >= 0,
+                  "boundary element " << i << " is not a face of the mesh");
+   }
+}
+
 const Table & Mesh::ElementToElementTable()
 {
    if (el_to_el)
@@ -8775,6 +9212,12 @@ STable3D *Mesh::GetFacesTable()
 
 STable3D *Mesh::GetElementToFaceTable(int ret_ftbl)
 {
+   if (sort_based_topology && !ret_ftbl)
+   {
+      GetSortedElementToFaceTable();
+      return NULL;
+   }
+
    Array<int> v;
    STable3D *faces_tbl;
 
@@ -320,6 +320,15 @@ public:
    // (true) is set in mesh_readers.cpp.
    static bool remove_unused_vertices;
 
+   // Global parameter that can be used to select the construction of the edge
+   // and face tables in GetElementToEdgeTable() and GetElementToFaceTable():
+   // when true, the tables are built by sorting the vertex keys of all the
+   // edges and faces with OpenMP threads; when false, the keys are inserted one
+   // by one in a DSTable or an STable3D. Both give the same numbering of the
+   // edges and faces. The default is true when MFEM is built with OpenMP; on a
+   // single thread, the sort-based construction is slower.
+   static bool sort_based_topology;
+
    /// Map from boundary or interior face indices to mesh face indices.
    const Array<int>& GetFaceIndices(FaceType ftype) const;
    /// Inverse of the map FaceIndices(ftype)
@@ -597,6 +606,11 @@ protected:
        to vertex 1, etc. Returns the number of the edges. */
    int GetElementToEdgeTable(Table &);
 
+   /// Sort-based versions of GetElementToEdgeTable() and
+   /// GetElementToFaceTable(), see #sort_based_topology.
+   int GetSortedElementToEdgeTable(Table &);
+   void GetSortedElementToFaceTable();
+
    /// Used in GenerateFaces()
    void AddPointFaceElement(int lf, int gf, int el);
 
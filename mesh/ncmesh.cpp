@@ -16,6 +16,7 @@
 #include <string>
 #include <cmath>
 #include <map>
+#include <unordered_map>
 
 #include "ncmesh_tables.hpp"
 
@@ -1946,36 +1947,75 @@ void NCMesh::RefineElement(const Refinement & ref)
 
 void NCMesh::Refine(const Array<Refinement>& refinements)
 {
-   // push all refinements on the stack in reverse order
-   ref_stack.Reserve(refinements.Size());
-   for (int i = refinements.Size()-1; i >= 0; i--)
+   // The refinements are processed level by level, from the coarsest elements
+   // to the finest. Each element is refined once per batch: a repeated or a
+   // forced refinement of an element that is still waiting in the batch is
+   // merged into its pending refinement, which may stop the propagation of
+   // forced refinements earlier than refining the element twice.
+   std::vector<Array<int>> level_queue; // pending refinements, by level
+   Array<int> level_done;               // number of processed items per level
+   Array<Refinement> pending;           // the refinements in the queues
+   std::unordered_map<int, int> pending_id; // element -> index in 'pending'
+
+   auto schedule = [&](const Refinement &ref) -> int
+   {
+      auto it = pending_id.find(ref.index);
+      if (it != pending_id.end())
+      {
+         // add the new directions to the pending refinement
+         Refinement &pr = pending[it->second];
+         for (int i = 0; i < 3; i++)
+         {
+            if (pr.s[i] <= 0.0 && ref.s[i] > 0.0) { pr.s[i] = ref.s[i]; }
+         }
+         return -1;
+      }
+
+      int depth = 0;
+      for (int e = ref.index; elements[e].parent >= 0; e = elements[e].parent)
+      {
+         depth++;
+      }
+      if (depth >= (int) level_queue.size())
+      {
+         level_queue.resize(depth+1);
+         level_done.SetSize(depth+1, 0);
+      }
+      pending_id[ref.index] = pending.Size();
+      level_queue[depth].Append(pending.Size());
+      pending.Append(ref);
+      return depth;
+   };
+
+   for (int i = 0; i < refinements.Size(); i++)
    {
       Refinement ref = refinements[i];  // Copy
       ref.index = leaf_elements[ref.index];
-      ref_stack.Append(ref);
+      schedule(ref);
    }
 
-   // keep refining as long as the stack contains something
+   // the previous leaves can be patched locally if there are no ghosts
+   local_leaf_update = (NGhostElements == 0);
+
    int nforced = 0;
-   while (ref_stack.Size())
+   for (int level = 0; level < (int) level_queue.size(); )
    {
-      Refinement ref = ref_stack.Last();
-      ref_stack.DeleteLast();
+      if (level_done[level] == level_queue[level].Size()) { level++; continue; }
 
-      int size = ref_stack.Size();
-      RefineElement(ref);
-      nforced += ref_stack.Size() - size;
-   }
+      const Refinement ref = pending[level_queue[level][level_done[level]++]];
+      pending_id.erase(ref.index);
 
-   /* TODO: the current algorithm of forced refinements is not optimal. As
-      forced refinements spread through the mesh, some may not be necessary in
-      the end, since the affected elements may still be scheduled for refinement
-      that could stop the propagation. We should introduce the member
-      Element::ref_pending that would show the intended refinement in the batch.
-      A forced refinement would be combined with ref_pending to (possibly) stop
-      the propagation earlier.
+      RefineElement(ref);
 
-      Update: what about a FIFO instead of ref_stack? */
+      // schedule the forced refinements, possibly on coarser levels
+      for (int i = 0; i < ref_stack.Size(); i++)
+      {
+         const int depth = schedule(ref_stack[i]);
+         if (depth >= 0 && depth < level) { level = depth; }
+      }
+      nforced += ref_stack.Size();
+      ref_stack.DeleteAll();
+   }
 
 #if defined(MFEM_DEBUG) && !defined(MFEM_USE_MPI)
    mfem::out << "Refined " << refinements.Size() << " + " << nforced
@@ -2332,6 +2372,14 @@ void NCMesh::Derefine(const Array<int> &derefs)
       DerefineElement(parent);
    }
 
+   // the previous leaves can be patched locally if there are no ghosts, with
+   // the derefined leaves replaced by their parents
+   if (NGhostElements == 0)
+   {
+      leaf_elements = fine_coarse;
+      local_leaf_update = true;
+   }
+
    // update leaf_elements, Element::index etc.
    Update();
 
@@ -2448,16 +2496,75 @@ void NCMesh::CollectLeafElements(int elem, int state, Array<int> &ghosts,
    }
 }
 
+int NCMesh::GetSFCState(int elem) const
+{
+   const Element &el = elements[elem];
+   if (el.parent < 0) { return root_state[elem]; }
+
+   const Element &pa = elements[el.parent];
+   const int state = GetSFCState(el.parent);
+
+   int ch = 0;
+   while (pa.child[ch] != elem) { ch++; }
+
+   // follow the transitions of CollectLeafElements
+   if (pa.Geom() == Geometry::SQUARE && pa.ref_type == Refinement::XY)
+   {
+      for (int i = 0; i < 4; i++)
+      {
+         if (quad_hilbert_child_order[state][i] == ch)
+         {
+            return quad_hilbert_child_state[state][i];
+         }
+      }
+   }
+   else if (pa.Geom() == Geometry::CUBE && pa.ref_type == Refinement::XYZ)
+   {
+      for (int i = 0; i < 8; i++)
+      {
+         if (hex_hilbert_child_order[state][i] == ch)
+         {
+            return hex_hilbert_child_state[state][i];
+         }
+      }
+   }
+   return state;
+}
+
 void NCMesh::UpdateLeafElements()
 {
    Array<int> ghosts;
 
-   // collect leaf elements in leaf_elements and ghosts elements in ghosts from
-   // all roots
-   leaf_elements.SetSize(0);
-   for (int i = 0, counter = 0; i < root_state.Size(); i++)
+   if (local_leaf_update)
    {
-      CollectLeafElements(i, root_state[i], ghosts, counter);
+      // 'leaf_elements' holds the previous leaves in SFC order, where Refine
+      // left the refined leaves and Derefine replaced the derefined leaves by
+      // their parents. Replacing each refined leaf by its subtree and each run
+      // of a derefined parent by the parent gives the same order as
+      // collecting the leaves from the roots.
+      Array<int> old_leaves;
+      old_leaves.Swap(leaf_elements);
+      leaf_elements.Reserve(old_leaves.Size());
+
+      for (int i = 0, counter = 0; i < old_leaves.Size(); i++)
+      {
+         const int elem = old_leaves[i];
+         if (i > 0 && elem == old_leaves[i-1]) { continue; }
+
+         const int state = elements[elem].ref_type ? GetSFCState(elem) : 0;
+         CollectLeafElements(elem, state, ghosts, counter);
+      }
+      local_leaf_update = false;
+   }
+   else
+   {
+      // collect leaf elements in leaf_elements and ghosts elements in ghosts
+      // from all roots
+      leaf_elements.SetSize(0);
+      for (int i = 0, counter = 0; i < root_state.Size(); i++)
+      {
+         CollectLeafElements(i, root_state[i], ghosts, counter);
+      }
    }
 
    NElements = leaf_elements.Size();
@@ -600,13 +600,17 @@ protected: // implementation
        this mechanism. The new elements "sign in" to the nodes by increasing the
        reference counts of their vertices and edges. The parent element "signs
        off" its nodes by decrementing the ref counts. */
-   struct Node : public Hashed2
+   struct Node : public OpenHashed2
    {
       char vert_refc, edge_refc;
+   private:
+      // NOTE: declared here to fill the padding after the ref counts
+      bool scaleSet; ///< Indicates whether scale is set and cannot be changed
+   public:
       int vert_index, edge_index;
 
-      Node() : vert_refc(0), edge_refc(0), vert_index(-1), edge_index(-1),
-         scale(0.5), scaleSet(false) {}
+      Node() : vert_refc(0), edge_refc(0), scaleSet(false), vert_index(-1),
+         edge_index(-1), scale(0.5) {}
       ~Node();
 
       bool HasVertex() const { return vert_refc > 0; }
@@ -621,7 +625,6 @@ protected: // implementation
 
    private:
       real_t scale;  ///< Scale from struct Refinement, default 0.5
-      bool scaleSet; ///< Indicates whether scale is set and cannot be changed
 #ifdef MFEM_USE_DOUBLE
       static constexpr real_t scaleTol = 1.0e-8; ///< Scale comparison tolerance
 #else
@@ -633,7 +636,7 @@ protected: // implementation
        node IDs. A face knows about the one or two elements that are using it. A
        face that is not on the boundary and only has one element referencing it
        is either a master or a slave face. */
-   struct Face : public Hashed4
+   struct Face : public OpenHashed4
    {
       int attribute; ///< boundary element attribute, -1 if internal face
       int index;     ///< face number in the Mesh
@@ -680,8 +683,8 @@ protected: // implementation
 
 
    // primary data
-   HashTable<Node> nodes; // associative container holding all Nodes
-   HashTable<Face> faces; // associative container holding all Faces
+   OpenHashTable<Node> nodes; // associative container holding all Nodes
+   OpenHashTable<Face> faces; // associative container holding all Faces
 
    bool using_scaling = false; // Whether Node::scale is being used
 
@@ -786,6 +789,12 @@ protected:
 
    Array<int> leaf_elements; ///< finest elements, in Mesh ordering (+ ghosts)
    Array<int> leaf_sfc_index; ///< natural tree ordering of leaf elements
+
+   /** If true, the next UpdateLeafElements() patches the previous
+       'leaf_elements' instead of collecting the leaves from the roots. Set by
+       Refine() and Derefine() when there are no ghost elements. */
+   bool local_leaf_update = false;
+
    Array<int> vertex_nodeId; ///< vertex-index to node-id map, see UpdateVertices
 
    NCList face_list; ///< lazy-initialized list of faces, see GetFaceList
@@ -797,7 +806,9 @@ protected:
 
    Table element_vertex; ///< leaf-element to vertex table, see FindSetNeighbors
 
-   /// Update the leaf elements indices in leaf_elements
+   /** Update the leaf elements indices in leaf_elements. After Refine() and
+       Derefine() only the refined and derefined leaves are visited, see
+       local_leaf_update. */
    void UpdateLeafElements();
 
    /** @brief This method assigns indices to vertices (Node::vert_index) that
@@ -828,6 +839,10 @@ protected:
    void CollectLeafElements(int elem, int state, Array<int> &ghosts,
                             int &counter);
 
+   /** Return the space-filling curve state of the element @a elem, i.e., the
+       @a state passed to CollectLeafElements for this element. */
+   int GetSFCState(int elem) const;
+
    /** Try to find a space-filling curve friendly orientation of the root
        elements: set 'root_state' based on the ordering of coarse elements. Note
        that the coarse mesh itself must be ordered as an SFC by e.g.
@@ -853,7 +868,7 @@ protected:
    // refinement/derefinement
 
    Array<Refinement> ref_stack; ///< stack of scheduled refinements (temporary)
-   HashTable<Node> shadow; ///< temporary storage for reparented nodes
+   OpenHashTable<Node> shadow; ///< temporary storage for reparented nodes
    Array<Triple<int, int, int> > reparents; ///< scheduled node reparents (tmp)
    Array<real_t> reparent_scale;  ///< scale associated with reparents (tmp)
 
@@ -82,17 +82,17 @@ protected:
     * @brief Accessor for parent nodes
     * @details Required to bypass access protection in parent class.
     *
-    * @return const HashTable<Node>&
+    * @return const OpenHashTable<Node>&
     */
-   const HashTable<Node> &ParentNodes() const { return parent_->nodes; }
+   const OpenHashTable<Node> &ParentNodes() const { return parent_->nodes; }
 
    /**
     * @brief Accessor for parent faces
     * @details Required to bypass access protection in parent class.
     *
-    * @return const HashTable<Face>&
+    * @return const OpenHashTable<Face>&
     */
-   const HashTable<Face> &ParentFaces() const { return parent_->faces; }
+   const OpenHashTable<Face> &ParentFaces() const { return parent_->faces; }
 };
 
 } // namespace mfem
@@ -16,6 +16,7 @@
 #include "psubmesh.hpp"
 #include "ptransfermap.hpp"
 #include "submesh_utils.hpp"
+#include "../../general/forall.hpp"
 
 using namespace mfem;
 
@@ -113,9 +114,12 @@ ParTransferMap::ParTransferMap(const ParFiniteElementSpace &src,
                                        src_sm->GetParentElementIDMap(),
                                        sub_to_parent_map_);
 
+      SubMeshUtils::BuildFaceOrientationMap(
+         src, src_sm->GetParentFaceOrientations(), sub_to_parent_map_,
+         dst.GetVSize(), true, face_ori_rows_, face_ori_map_);
+
       root_gc_ = &dst.GroupComm();
       CommunicateIndicesSet(sub_to_parent_map_, dst.GetVSize());
-      sub_fes_ = &src;
    }
    else if (ParSubMesh::IsParSubMesh(dst.GetParMesh()))
    {
@@ -126,7 +130,9 @@ ParTransferMap::ParTransferMap(const ParFiniteElementSpace &src,
                                        dst_sm->GetFrom(),
                                        dst_sm->GetParentElementIDMap(),
                                        sub_to_parent_map_);
-      sub_fes_ = &dst;
+      SubMeshUtils::BuildFaceOrientationMap(
+         dst, dst_sm->GetParentFaceOrientations(), sub_to_parent_map_,
+         src.GetVSize(), false, face_ori_rows_, face_ori_map_);
    }
    else
    {
@@ -142,187 +148,160 @@ ParTransferMap::ParTransferMap(const ParGridFunction &src,
 void ParTransferMap::Transfer(const ParGridFunction &src,
                               ParGridFunction &dst) const
 {
-   if (category_ == TransferCategory::ParentToSubMesh)
+   if (category_ == TransferCategory::SubMeshToSubMesh)
    {
-      // dst = S1^T src
-      src.HostRead();
-      dst.HostWrite(); // dst is fully overwritten
-      for (int i = 0; i < sub_to_parent_map_.Size(); i++)
-      {
-         real_t s = 1.0;
-         int j = FiniteElementSpace::DecodeDof(sub_to_parent_map_[i], s);
-         dst(i) = s * src(j);
-      }
-
-      CorrectFaceOrientations(*sub_fes_, src, dst);
+      dst_to_parent->Transfer(dst, z_);
+      src_to_parent->Transfer(src, z_);
+      parent_to_dst->Transfer(z_, dst);
+      return;
    }
-   else if (category_ == TransferCategory::SubMeshToParent)
-   {
-      // dst = G S1 src
-      //     = G z
-      //
-      // G is identity if the partitioning matches
-
-      src.HostRead();
-      dst.HostReadWrite(); // dst is only partially overwritten
-      for (int i = 0; i < sub_to_parent_map_.Size(); i++)
-      {
-         real_t s = 1.0;
-         int j = FiniteElementSpace::DecodeDof(sub_to_parent_map_[i], s);
-         dst(j) = s * src(i);
-      }
+   const ParGridFunction *src_ptr = &src;
+   ParGridFunction *dst_ptr = &dst;
+   Transfer(Array<const ParGridFunction*>(&src_ptr, 1),
+            Array<ParGridFunction*>(&dst_ptr, 1));
+}
 
-      CorrectFaceOrientations(*sub_fes_, src, dst,
-                              &sub_to_parent_map_);
+void ParTransferMap::Transfer(const Array<const ParGridFunction*> &src,
+                              const Array<ParGridFunction*> &dst) const
+{
+   MFEM_VERIFY(src.Size() == dst.Size(),
+               "The numbers of source and destination fields differ");
+   const int nf = src.Size();
 
-      CommunicateSharedVdofs(dst);
+   if (category_ == TransferCategory::SubMeshToSubMesh)
+   {
+      for (int f = 0; f < nf; f++) { Transfer(*src[f], *dst[f]); }
+      return;
    }
-   else if (category_ == TransferCategory::SubMeshToSubMesh)
+   MFEM_VERIFY(category_ == TransferCategory::ParentToSubMesh ||
+               category_ == TransferCategory::SubMeshToParent,
+               "unknown TransferCategory: " << category_);
+
+   // ParentToSubMesh: dst = S1^T src
+   // SubMeshToParent: dst = G S1 src, where G is identity if the partitioning
+   // matches. In this case, dst is only partially overwritten.
+   const bool to_parent = category_ == TransferCategory::SubMeshToParent;
+   src_ptrs_.SetSize(nf);
+   dst_ptrs_.SetSize(nf);
+   const real_t **h_src = src_ptrs_.HostWrite();
+   real_t **h_dst = dst_ptrs_.HostWrite();
+   for (int f = 0; f < nf; f++)
    {
-      dst_to_parent->Transfer(dst, z_);
-      src_to_parent->Transfer(src, z_);
-      parent_to_dst->Transfer(z_, dst);
+      h_src[f] = src[f]->Read();
+      h_dst[f] = to_parent ? dst[f]->ReadWrite() : dst[f]->Write();
    }
-   else
+
+   const int n = sub_to_parent_map_.Size();
+   const auto d_map = sub_to_parent_map_.Read();
+   const auto d_src = src_ptrs_.Read();
+   const auto d_dst = dst_ptrs_.Read();
+   mfem::forall(nf*n, [=] MFEM_HOST_DEVICE (int k)
    {
-      MFEM_ABORT("unknown TransferCategory: " << category_);
+      const int f = k / n, i = k % n;
+      const int m = d_map[i];
+      const int j = (m >= 0) ? m : -1 - m;
+      const real_t s = (m >= 0) ? 1.0 : -1.0;
+      if (to_parent) { d_dst[f][j] = s * d_src[f][i]; }
+      else { d_dst[f][i] = s * d_src[f][j]; }
+   });
+
+   const int nr = face_ori_rows_.Size();
+   const auto d_rows = face_ori_rows_.Read();
+   face_ori_vals_.SetSize(nr);
+   for (int f = 0; f < nf; f++)
+   {
+      if (nr > 0)
+      {
+         face_ori_map_.Mult(*src[f], face_ori_vals_);
+         const auto d_vals = face_ori_vals_.Read();
+         auto d_y = dst[f]->ReadWrite();
+         mfem::forall(nr, [=] MFEM_HOST_DEVICE (int r)
+         {
+            d_y[d_rows[r]] = d_vals[r];
+         });
+      }
+      if (to_parent) { CommunicateSharedVdofs(*dst[f]); }
    }
 }
 
 void ParTransferMap::CommunicateIndicesSet(Array<int> &map, int dst_sz)
 {
-   indices_set_local_.SetSize(dst_sz);
-   indices_set_local_ = 0;
+   Array<int> indices_set_local(dst_sz);
+   indices_set_local = 0;
    for (int i = 0; i < map.Size(); i++)
    {
-      indices_set_local_[(map[i]>=0)?map[i]:(-map[i]-1)] = 1;
+      indices_set_local[(map[i]>=0)?map[i]:(-map[i]-1)] = 1;
    }
-   indices_set_global_ = indices_set_local_;
-   root_gc_->Reduce(indices_set_global_, GroupCommunicator::Sum);
-   root_gc_->Bcast(indices_set_global_);
-}
-
-void ParTransferMap::CommunicateSharedVdofs(Vector &f) const
-{
-   // f is usually defined on the root vdofs
+   Array<int> indices_set_global(indices_set_local);
+   root_gc_->Reduce(indices_set_global, GroupCommunicator::Sum);
+   root_gc_->Bcast(indices_set_global);
 
    const Table &group_ldof = root_gc_->GroupLDofTable();
 
-   // Identify indices that were only set by other ranks and clear the dof.
-   for (int i = 0; i < group_ldof.Size_of_connections(); i++)
-   {
-      const int j = group_ldof.GetJ()[i];
-      if (indices_set_global_[j] != 0 && indices_set_local_[j] == 0)
-      {
-         f(j) = 0.0;
-      }
-   }
-
-   // TODO: do the reduce only on dofs of interest
-   root_gc_->Reduce<real_t>(f.HostReadWrite(), GroupCommunicator::Sum);
-
-   // Indices that were set from this rank or other ranks have been summed up
-   // and therefore need to be "averaged". Note that this results in the exact
-   // value that is desired.
+   // Indices that were only set by other ranks are cleared before the
+   // reduction.
+   shared_clear_.SetSize(0);
    for (int i = 0; i < group_ldof.Size_of_connections(); i++)
    {
       const int j = group_ldof.GetJ()[i];
-      if (indices_set_global_[j] != 0)
+      if (indices_set_global[j] != 0 && indices_set_local[j] == 0)
       {
-         f(j) /= indices_set_global_[j];
+         shared_clear_.Append(j);
       }
    }
 
-   // Indices for dofs that are shared between processors need to be divided by
-   // the whole group size that share this dof.
-   for (int gr = 1; gr < group_ldof.Size(); gr++)
+   // Indices that were set from this rank or other ranks are summed up by the
+   // reduction and therefore need to be "averaged". Note that this results in
+   // the exact value that is desired. Indices for dofs that are shared between
+   // processors and not set by any rank need to be divided by the whole group
+   // size that share this dof.
+   shared_scaled_.SetSize(0);
+   std::vector<real_t> scale;
+   for (int gr = 0; gr < group_ldof.Size(); gr++)
    {
       for (int i = 0; i < group_ldof.RowSize(gr); i++)
       {
          const int j = group_ldof.GetRow(gr)[i];
-         if (indices_set_global_[j] == 0)
+         if (indices_set_global[j] != 0)
          {
-            f(j) /= root_gc_->GetGroupTopology().GetGroupSize(gr);
+            shared_scaled_.Append(j);
+            scale.push_back(1.0 / indices_set_global[j]);
+         }
+         else if (gr > 0)
+         {
+            shared_scaled_.Append(j);
+            scale.push_back(
+               1.0 / root_gc_->GetGroupTopology().GetGroupSize(gr));
          }
       }
    }
-
-   root_gc_->Bcast<real_t>(f.HostReadWrite());
+   shared_scale_.SetSize((int)scale.size());
+   for (int i = 0; i < shared_scale_.Size(); i++)
+   {
+      shared_scale_[i] = scale[i];
+   }
 }
 
-void
-ParTransferMap::CorrectFaceOrientations(const ParFiniteElementSpace &fes,
-                                        const Vector &src,
-                                        Vector &dst,
-                                        const Array<int> *sub_to_parent_map)
+void ParTransferMap::CommunicateSharedVdofs(Vector &f) const
 {
-   const FiniteElementCollection * fec = fes.FEColl();
-
-   ParSubMesh * mesh = dynamic_cast<ParSubMesh*>(fes.GetParMesh());
-
-   const Array<int>& parent_face_ori = mesh->GetParentFaceOrientations();
-
-   if (parent_face_ori.Size() == 0) { return; }
+   // f is usually defined on the root vdofs. The group communication is done
+   // on the host.
+   real_t *h_f = f.HostReadWrite();
 
-   DofTransformation doftrans(fes.GetVDim(), fes.GetOrdering());
-
-   int dim = mesh->Dimension();
-   bool face = (dim == 3);
-
-   Array<int> vdofs;
-   Array<int> Fo(1);
-   Vector face_vector;
-
-   for (int i = 0; i < (face ? mesh->GetNumFaces() : mesh->GetNE()); i++)
+   for (int i = 0; i < shared_clear_.Size(); i++)
    {
-      if (parent_face_ori[i] == 0) { continue; }
-
-      Geometry::Type geom = face ? mesh->GetFaceGeometry(i) :
-                            mesh->GetElementGeometry(i);
-
-      if (!fec->DofTransformationForGeometry(geom)) { continue; }
-      doftrans.SetDofTransformation(*fec->DofTransformationForGeometry(geom));
-
-      Fo[0] = parent_face_ori[i];
-      doftrans.SetFaceOrientations(Fo);
-
-      if (face)
-      {
-         fes.GetFaceVDofs(i, vdofs);
-      }
-      else
-      {
-         fes.GetElementVDofs(i, vdofs);
-      }
-
-      if (sub_to_parent_map)
-      {
-         src.GetSubVector(vdofs, face_vector);
-         doftrans.TransformPrimal(face_vector);
-      }
-      else
-      {
-         dst.GetSubVector(vdofs, face_vector);
-         doftrans.InvTransformPrimal(face_vector);
-      }
-
-      for (int j = 0; j < vdofs.Size(); j++)
-      {
-         real_t s = 1.0;
-         int k = FiniteElementSpace::DecodeDof(vdofs[j], s);
+      h_f[shared_clear_[i]] = 0.0;
+   }
 
-         if (sub_to_parent_map)
-         {
-            real_t sps = 1.0;
-            int spk = FiniteElementSpace::DecodeDof((*sub_to_parent_map)[k],
-                                                    sps);
-            s *= sps;
-            k = spk;
-         }
+   // TODO: do the reduce only on dofs of interest
+   root_gc_->Reduce<real_t>(h_f, GroupCommunicator::Sum);
 
-         dst[k] = s * face_vector[j];
-      }
+   for (int i = 0; i < shared_scaled_.Size(); i++)
+   {
+      h_f[shared_scaled_[i]] *= shared_scale_[i];
    }
+
+   root_gc_->Bcast<real_t>(h_f);
 }
 
 #endif // MFEM_USE_MPI
@@ -66,13 +66,27 @@ public:
     */
    void Transfer(const ParGridFunction &src, ParGridFunction &dst) const;
 
+   /**
+    * @brief Transfer several source ParGridFunction%s to the destination
+    * ParGridFunction%s.
+    *
+    * All the ParGridFunction%s in @a src and @a dst must be defined on the
+    * source and destination spaces of the map, respectively. The precomputed
+    * maps are applied to all the fields in a single kernel.
+    *
+    * @param src The source ParGridFunction%s
+    * @param dst The destination ParGridFunction%s
+    */
+   void Transfer(const Array<const ParGridFunction*> &src,
+                 const Array<ParGridFunction*> &dst) const;
+
 private:
    /**
     * @brief Communicate from each local processor which index in map is set.
     *
-    * The result is accumulated in the member variable indices_set_global_ and
-    * indicates which and how many processors in total will set a certain degree
-    * of freedom.
+    * The number of processors setting each shared degree of freedom is used to
+    * precompute the shared vdofs cleared and scaled by
+    * CommunicateSharedVdofs().
     *
     * Convenience method for tidyness. Uses and changes member variables.
     */
@@ -88,26 +102,33 @@ private:
     */
    void CommunicateSharedVdofs(Vector &f) const;
 
-   static void CorrectFaceOrientations(const ParFiniteElementSpace &fes,
-                                       const Vector &src,
-                                       Vector &dst,
-                                       const Array<int> *s2p_map = NULL);
-
    TransferCategory category_;
 
    /// Mapping of the ParGridFunction defined on the SubMesh to the
    /// ParGridFunction of its parent ParMesh.
    Array<int> sub_to_parent_map_;
 
-   /// Set of indices in the dof map that are set by the local rank.
-   Array<int> indices_set_local_;
+   /// Entries of the destination that are corrected for the orientation of
+   /// the parent faces, and the correction map, see
+   /// SubMeshUtils::BuildFaceOrientationMap().
+   Array<int> face_ori_rows_;
+   SparseMatrix face_ori_map_;
+
+   /// Corrected values of the entries face_ori_rows_.
+   mutable Vector face_ori_vals_;
+
+   /// Data of the source and destination fields of a transfer.
+   mutable Array<const real_t*> src_ptrs_;
+   mutable Array<real_t*> dst_ptrs_;
 
-   /// Set of indices in the dof map that are set by all ranks. The number is
-   /// accumulated by summation.
-   Array<int> indices_set_global_;
+   /// Shared vdofs of the parent that are only set by other ranks, cleared
+   /// before the reduction.
+   Array<int> shared_clear_;
 
-   /// Pointer to the finite element space defined on the SubMesh.
-   const ParFiniteElementSpace *sub_fes_ = nullptr;
+   /// Shared vdofs of the parent that are scaled after the reduction, by the
+   /// inverse of the number of ranks setting them or sharing them.
+   Array<int> shared_scaled_;
+   Vector shared_scale_;
 
    /// @name Needed for ParSubMesh-to-ParSubMesh transfer
    ///@{
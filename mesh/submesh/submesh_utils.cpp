@@ -15,6 +15,7 @@
 #include "pncsubmesh.hpp"
 #include "psubmesh.hpp"
 
+#include <map>
 #include <numeric>
 
 namespace mfem
@@ -216,6 +217,113 @@ void BuildVdofToVdofMap(const FiniteElementSpace& subfes,
 
 }
 
+void BuildFaceOrientationMap(const FiniteElementSpace& subfes,
+                             const Array<int>& parent_face_ori,
+                             const Array<int>& sub_to_parent_map,
+                             int parent_vsize, bool to_parent,
+                             Array<int>& rows, SparseMatrix& C)
+{
+   rows.SetSize(0);
+   SparseMatrix empty;
+   C.Swap(empty);
+   if (parent_face_ori.Size() == 0) { return; }
+
+   const FiniteElementCollection *fec = subfes.FEColl();
+   const Mesh *mesh = subfes.GetMesh();
+   const bool face = (mesh->Dimension() == 3);
+
+   DofTransformation doftrans(subfes.GetVDim(), subfes.GetOrdering());
+   Array<int> vdofs;
+   Array<int> Fo(1);
+   DenseMatrix T;
+
+   // Entries (column, value) of each corrected row. As in the face by face
+   // correction, the last face setting an entry determines its value.
+   std::map<int, std::vector<std::pair<int, real_t>>> row_entries;
+
+   for (int i = 0; i < (face ? mesh->GetNumFaces() : mesh->GetNE()); i++)
+   {
+      if (parent_face_ori[i] == 0) { continue; }
+
+      Geometry::Type geom = face ? mesh->GetFaceGeometry(i) :
+                            mesh->GetElementGeometry(i);
+
+      if (!fec->DofTransformationForGeometry(geom)) { continue; }
+      doftrans.SetDofTransformation(*fec->DofTransformationForGeometry(geom));
+
+      Fo[0] = parent_face_ori[i];
+      doftrans.SetFaceOrientations(Fo);
+
+      if (face)
+      {
+         subfes.GetFaceVDofs(i, vdofs);
+      }
+      else
+      {
+         subfes.GetElementVDofs(i, vdofs);
+      }
+
+      // Matrix of the transformation of the (signed) face vector.
+      const int n = vdofs.Size();
+      T.Diag(1.0, n);
+      for (int l = 0; l < n; l++)
+      {
+         if (to_parent)
+         {
+            doftrans.TransformPrimal(T.GetColumn(l));
+         }
+         else
+         {
+            doftrans.InvTransformPrimal(T.GetColumn(l));
+         }
+      }
+
+      for (int j = 0; j < n; j++)
+      {
+         real_t s = 1.0;
+         int row = FiniteElementSpace::DecodeDof(vdofs[j], s);
+         if (to_parent)
+         {
+            real_t sps = 1.0;
+            row = FiniteElementSpace::DecodeDof(sub_to_parent_map[row], sps);
+            s *= sps;
+         }
+
+         std::vector<std::pair<int, real_t>> &entries = row_entries[row];
+         entries.clear();
+         for (int l = 0; l < n; l++)
+         {
+            if (T(j, l) == 0.0) { continue; }
+            real_t sl = 1.0;
+            int col = FiniteElementSpace::DecodeDof(vdofs[l], sl);
+            if (!to_parent)
+            {
+               // The face vector is read from the transferred values.
+               real_t sps = 1.0;
+               col = FiniteElementSpace::DecodeDof(sub_to_parent_map[col], sps);
+               sl *= sps;
+            }
+            entries.emplace_back(col, s * sl * T(j, l));
+         }
+      }
+   }
+
+   if (row_entries.empty()) { return; }
+
+   SparseMatrix Cmat((int)row_entries.size(),
+                     to_parent ? subfes.GetVSize() : parent_vsize);
+   rows.SetSize((int)row_entries.size());
+   int r = 0;
+   for (const auto &re : row_entries)
+   {
+      rows[r] = re.first;
+      for (const auto &e : re.second) { Cmat.Add(r, e.first, e.second); }
+      r++;
+   }
+   Cmat.Finalize();
+   C.Swap(Cmat);
+}
+
 Array<int> BuildFaceMap(const Mesh& pm, const Mesh& sm,
                         const Array<int> &parent_element_ids)
 {
@@ -99,6 +99,30 @@ void BuildVdofToVdofMap(const FiniteElementSpace& subfes,
                         const Array<int>& parent_element_ids,
                         Array<int>& vdof_to_vdof_map);
 
+/**
+ * @brief Build the linear map that corrects the orientation of the face dofs
+ * of a SubMesh space after the vdof to vdof transfer.
+ *
+ * The corrected entries @a rows of the destination vector are given by @a C
+ * applied to the source vector. The destination is the SubMesh vector if
+ * @a to_parent is false, in which case @a C includes the transfer from the
+ * parent vector, and the parent vector otherwise. @a rows is empty if no
+ * correction is needed.
+ *
+ * @param[in] subfes The finite element space on the SubMesh
+ * @param[in] parent_face_ori The parent face orientations of the SubMesh
+ * @param[in] sub_to_parent_map The map built by BuildVdofToVdofMap
+ * @param[in] parent_vsize The size of the parent vector
+ * @param[in] to_parent The direction of the transfer
+ * @param[out] rows The corrected entries of the destination vector
+ * @param[out] C The correction map
+ */
+void BuildFaceOrientationMap(const FiniteElementSpace& subfes,
+                             const Array<int>& parent_face_ori,
+                             const Array<int>& sub_to_parent_map,
+                             int parent_vsize, bool to_parent,
+                             Array<int>& rows, SparseMatrix& C);
+
 /**
  * @brief Identify the root parent of a given SubMesh.
  *
@@ -12,6 +12,7 @@
 #include "submesh.hpp"
 #include "transfermap.hpp"
 #include "submesh_utils.hpp"
+#include "../../general/forall.hpp"
 
 using namespace mfem;
 
@@ -111,7 +112,9 @@ TransferMap::TransferMap(const FiniteElementSpace &src,
                                        src_sm->GetFrom(),
                                        src_sm->GetParentElementIDMap(),
                                        sub_to_parent_map_);
-      sub_fes_ = &src;
+      SubMeshUtils::BuildFaceOrientationMap(
+         src, src_sm->GetParentFaceOrientations(), sub_to_parent_map_,
+         dst.GetVSize(), true, face_ori_rows_, face_ori_map_);
    }
    else if (SubMesh::IsSubMesh(dst.GetMesh()))
    {
@@ -122,7 +125,9 @@ TransferMap::TransferMap(const FiniteElementSpace &src,
                                        dst_sm->GetFrom(),
                                        dst_sm->GetParentElementIDMap(),
                                        sub_to_parent_map_);
-      sub_fes_ = &dst;
+      SubMeshUtils::BuildFaceOrientationMap(
+         dst, dst_sm->GetParentFaceOrientations(), sub_to_parent_map_,
+         src.GetVSize(), false, face_ori_rows_, face_ori_map_);
    }
    else
    {
@@ -137,121 +142,75 @@ TransferMap::TransferMap(const GridFunction &src,
 
 void TransferMap::Transfer(const GridFunction &src, GridFunction &dst) const
 {
-   if (category_ == TransferCategory::ParentToSubMesh)
-   {
-      // dst = S1^T src
-      src.HostRead();
-      dst.HostWrite(); // dst is fully overwritten
-      for (int i = 0; i < sub_to_parent_map_.Size(); i++)
-      {
-         real_t s = 1.0;
-         int j = FiniteElementSpace::DecodeDof(sub_to_parent_map_[i], s);
-         dst(i) = s * src(j);
-      }
-
-      CorrectFaceOrientations(*sub_fes_, src, dst);
-   }
-   else if (category_ == TransferCategory::SubMeshToParent)
-   {
-      // dst = G S1 src
-      //     = G z
-      //
-      // G is identity if the partitioning matches
-
-      src.HostRead();
-      dst.HostReadWrite(); // dst is only partially overwritten
-      for (int i = 0; i < sub_to_parent_map_.Size(); i++)
-      {
-         real_t s = 1.0;
-         int j = FiniteElementSpace::DecodeDof(sub_to_parent_map_[i], s);
-         dst(j) = s * src(i);
-      }
-
-      CorrectFaceOrientations(*sub_fes_, src, dst,
-                              &sub_to_parent_map_);
-   }
-   else if (category_ == TransferCategory::SubMeshToSubMesh)
+   if (category_ == TransferCategory::SubMeshToSubMesh)
    {
       dst_to_parent->Transfer(dst, z_);
       src_to_parent->Transfer(src, z_);
       parent_to_dst->Transfer(z_, dst);
+      return;
    }
-   else
-   {
-      MFEM_ABORT("unknown TransferCategory: " << category_);
-   }
+   const GridFunction *src_ptr = &src;
+   GridFunction *dst_ptr = &dst;
+   Transfer(Array<const GridFunction*>(&src_ptr, 1),
+            Array<GridFunction*>(&dst_ptr, 1));
 }
 
-void TransferMap::CorrectFaceOrientations(const FiniteElementSpace &fes,
-                                          const Vector &src,
-                                          Vector &dst,
-                                          const Array<int> *sub_to_parent_map)
+void TransferMap::Transfer(const Array<const GridFunction*> &src,
+                           const Array<GridFunction*> &dst) const
 {
-   const FiniteElementCollection * fec = fes.FEColl();
-
-   SubMesh * mesh = dynamic_cast<SubMesh*>(fes.GetMesh());
-
-   const Array<int>& parent_face_ori = mesh->GetParentFaceOrientations();
-
-   if (parent_face_ori.Size() == 0) { return; }
+   MFEM_VERIFY(src.Size() == dst.Size(),
+               "The numbers of source and destination fields differ");
+   const int nf = src.Size();
 
-   DofTransformation doftrans(fes.GetVDim(), fes.GetOrdering());
-
-   int dim = mesh->Dimension();
-   bool face = (dim == 3);
-
-   Array<int> vdofs;
-   Array<int> Fo(1);
-   Vector face_vector;
-
-   for (int i = 0; i < (face ? mesh->GetNumFaces() : mesh->GetNE()); i++)
+   if (category_ == TransferCategory::SubMeshToSubMesh)
    {
-      if (parent_face_ori[i] == 0) { continue; }
-
-      Geometry::Type geom = face ? mesh->GetFaceGeometry(i) :
-                            mesh->GetElementGeometry(i);
-
-      if (!fec->DofTransformationForGeometry(geom)) { continue; }
-      doftrans.SetDofTransformation(*fec->DofTransformationForGeometry(geom));
-
-      Fo[0] = parent_face_ori[i];
-      doftrans.SetFaceOrientations(Fo);
-
-      if (face)
-      {
-         fes.GetFaceVDofs(i, vdofs);
-      }
-      else
-      {
-         fes.GetElementVDofs(i, vdofs);
-      }
-
-      if (sub_to_parent_map)
-      {
-         src.GetSubVector(vdofs, face_vector);
-         doftrans.TransformPrimal(face_vector);
-      }
-      else
-      {
-         dst.GetSubVector(vdofs, face_vector);
-         doftrans.InvTransformPrimal(face_vector);
-      }
+      for (int f = 0; f < nf; f++) { Transfer(*src[f], *dst[f]); }
+      return;
+   }
+   MFEM_VERIFY(category_ == TransferCategory::ParentToSubMesh ||
+               category_ == TransferCategory::SubMeshToParent,
+               "unknown TransferCategory: " << category_);
+
+   // ParentToSubMesh: dst = S1^T src
+   // SubMeshToParent: dst = G S1 src, where G is identity if the partitioning
+   // matches. In this case, dst is only partially overwritten.
+   const bool to_parent = category_ == TransferCategory::SubMeshToParent;
+   src_ptrs_.SetSize(nf);
+   dst_ptrs_.SetSize(nf);
+   const real_t **h_src = src_ptrs_.HostWrite();
+   real_t **h_dst = dst_ptrs_.HostWrite();
+   for (int f = 0; f < nf; f++)
+   {
+      h_src[f] = src[f]->Read();
+      h_dst[f] = to_parent ? dst[f]->ReadWrite() : dst[f]->Write();
+   }
 
-      for (int j = 0; j < vdofs.Size(); j++)
+   const int n = sub_to_parent_map_.Size();
+   const auto d_map = sub_to_parent_map_.Read();
+   const auto d_src = src_ptrs_.Read();
+   const auto d_dst = dst_ptrs_.Read();
+   mfem::forall(nf*n, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int f = k / n, i = k % n;
+      const int m = d_map[i];
+      const int j = (m >= 0) ? m : -1 - m;
+      const real_t s = (m >= 0) ? 1.0 : -1.0;
+      if (to_parent) { d_dst[f][j] = s * d_src[f][i]; }
+      else { d_dst[f][i] = s * d_src[f][j]; }
+   });
+
+   const int nr = face_ori_rows_.Size();
+   if (nr == 0) { return; }
+   const auto d_rows = face_ori_rows_.Read();
+   face_ori_vals_.SetSize(nr);
+   for (int f = 0; f < nf; f++)
+   {
+      face_ori_map_.Mult(*src[f], face_ori_vals_);
+      const auto d_vals = face_ori_vals_.Read();
+      auto d_y = dst[f]->ReadWrite();
+      mfem::forall(nr, [=] MFEM_HOST_DEVICE (int r)
       {
-         real_t s = 1.0;
-         int k = FiniteElementSpace::DecodeDof(vdofs[j], s);
-
-         if (sub_to_parent_map)
-         {
-            real_t sps = 1.0;
-            int spk = FiniteElementSpace::DecodeDof((*sub_to_parent_map)[k],
-                                                    sps);
-            s *= sps;
-            k = spk;
-         }
-
-         dst[k] = s * face_vector[j];
-      }
+         d_y[d_rows[r]] = d_vals[r];
+      });
    }
 }
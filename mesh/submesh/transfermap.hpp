@@ -63,12 +63,21 @@ public:
     */
    void Transfer(const GridFunction &src, GridFunction &dst) const;
 
-private:
+   /**
+    * @brief Transfer several source GridFunction%s to the destination
+    * GridFunction%s.
+    *
+    * All the GridFunction%s in @a src and @a dst must be defined on the source
+    * and destination spaces of the map, respectively. The precomputed maps
+    * are applied to all the fields in a single kernel.
+    *
+    * @param src The source GridFunction%s
+    * @param dst The destination GridFunction%s
+    */
+   void Transfer(const Array<const GridFunction*> &src,
+                 const Array<GridFunction*> &dst) const;
 
-   static void CorrectFaceOrientations(const FiniteElementSpace &fes,
-                                       const Vector &src,
-                                       Vector &dst,
-                                       const Array<int> *s2p_map = NULL);
+private:
 
    TransferCategory category_;
 
@@ -76,8 +85,18 @@ private:
    /// of its parent Mesh.
    Array<int> sub_to_parent_map_;
 
-   /// Pointer to the finite element space defined on the SubMesh.
-   const FiniteElementSpace *sub_fes_ = nullptr;
+   /// Entries of the destination that are corrected for the orientation of
+   /// the parent faces, and the correction map, see
+   /// SubMeshUtils::BuildFaceOrientationMap().
+   Array<int> face_ori_rows_;
+   SparseMatrix face_ori_map_;
+
+   /// Corrected values of the entries face_ori_rows_.
+   mutable Vector face_ori_vals_;
+
+   /// Data of the source and destination fields of a transfer.
+   mutable Array<const real_t*> src_ptrs_;
+   mutable Array<real_t*> dst_ptrs_;
 
    /// @name Needed for SubMesh-to-SubMesh transfer
    ///@{
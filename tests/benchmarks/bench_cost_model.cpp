@@ -0,0 +1,155 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+/*
+  This benchmark compares the measured performance of the action of scalar mass
+  and diffusion operators, for the different assembly levels, with the memory
+  traffic and floating point operations estimated by
+  BilinearForm::GetCostModel().
+
+  The "GB/s" and "GFLOP/s" counters are the rates achieved by the action, i.e.
+  the modeled bytes and flops divided by the measured time, and "AI" is the
+  modeled arithmetic intensity in flops/byte. When the peak bandwidth (GB/s)
+  and flop rate (GFLOP/s) of the machine are given in the benchmark context,
+  "Roofline" is the fraction of the attainable rate,
+  min(peak_gflops, AI*peak_bw), that is achieved.
+
+   * --benchmark_filter=[Mass/Diffusion][PARTIAL/ELEMENT/FULL]/[1-max_order]
+   * --benchmark_context=device=[cpu/cuda/hip]
+   * --benchmark_context=peak_bw=<GB/s>,peak_gflops=<GFLOP/s>
+*/
+
+// The maximum polynomial order used for benchmarking
+const int max_order = 6;
+// The maximum number of dofs for benchmarking
+const int max_dofs = 4e6;
+
+// Peak bandwidth (GB/s) and flop rate (GFLOP/s), zero if not given
+static double peak_bw = 0.0, peak_gflops = 0.0;
+
+template <typename BFI>
+struct CostModelProblem
+{
+   const int p, dim = 3;
+   Mesh mesh;
+   H1_FECollection fec;
+   FiniteElementSpace fes;
+   ConstantCoefficient one;
+   GridFunction x, y;
+   BilinearForm a;
+   OperatorCostModel cost;
+
+   CostModelProblem(AssemblyLevel assembly, int p, int N):
+      p(p),
+      mesh(Mesh::MakeCartesian3D(N,N,N,Element::HEXAHEDRON)),
+      fec(p, dim, BasisType::GaussLobatto),
+      fes(&mesh, &fec),
+      one(1.0),
+      x(&fes),
+      y(&fes),
+      a(&fes)
+   {
+      x.Randomize(1);
+      a.SetAssemblyLevel(assembly);
+      a.AddDomainIntegrator(new BFI(one));
+      a.Assemble();
+      a.Mult(x, y);
+      MFEM_DEVICE_SYNC;
+      cost = a.GetCostModel();
+   }
+
+   void benchmark_action()
+   {
+      a.Mult(x, y);
+      MFEM_DEVICE_SYNC;
+   }
+};
+
+#define CostModel_Action(assembly,KER)\
+static void KER##assembly(bm::State &state){\
+   const int dim = 3;\
+   const int p = state.range(1);\
+   const int target_dofs = state.range(0);\
+   const int elem_dofs = pow(p+1, dim);\
+   const int N = pow(target_dofs / elem_dofs, 1.0/dim) + 1;\
+   CostModelProblem<KER##Integrator> ker(AssemblyLevel::assembly, p, N);\
+   if (!ker.cost.complete) { state.SkipWithError("INCOMPLETE_MODEL"); }\
+   while (state.KeepRunning()) { ker.benchmark_action(); }\
+   const double gb = 1e-9 * ker.cost.bytes_per_apply;\
+   const double gflop = 1e-9 * ker.cost.flops_per_apply;\
+   const double iters = state.iterations();\
+   state.counters["GB/s"] = bm::Counter(gb*iters, bm::Counter::kIsRate);\
+   state.counters["GFLOP/s"] = bm::Counter(gflop*iters, bm::Counter::kIsRate);\
+   state.counters["AI"] = bm::Counter(ker.cost.ArithmeticIntensity());\
+   state.counters["Stored(MB)"] = bm::Counter(1e-6*ker.cost.stored_bytes);\
+   if (peak_bw > 0.0 && peak_gflops > 0.0)\
+   {\
+      const double roof = std::min(peak_gflops,\
+                                   ker.cost.ArithmeticIntensity()*peak_bw);\
+      state.counters["Roofline"] =\
+         bm::Counter(gflop*iters/roof, bm::Counter::kIsRate);\
+   }\
+   state.counters["Dofs"] = bm::Counter(ker.fes.GetTrueVSize());\
+   state.counters["Order"] = bm::Counter(ker.p);}\
+BENCHMARK(KER##assembly)->ArgsProduct({\
+      benchmark::CreateRange(1024, max_dofs, /*step=*/4),\
+      benchmark::CreateDenseRange(1, max_order, /*step=*/1)\
+    })->Unit(bm::kMillisecond);
+
+CostModel_Action(PARTIAL,Mass)
+CostModel_Action(PARTIAL,Diffusion)
+CostModel_Action(ELEMENT,Mass)
+CostModel_Action(ELEMENT,Diffusion)
+CostModel_Action(FULL,Mass)
+CostModel_Action(FULL,Diffusion)
+
+/**
+ * @brief main entry point
+ * --benchmark_filter=DiffusionPARTIAL/4096
+ * --benchmark_context=device=cpu,peak_bw=100,peak_gflops=1000
+ */
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+
+   // Device setup, cpu by default
+   std::string device_config = "cpu";
+   auto global_context = bmi::GetGlobalContext();
+   if (global_context != nullptr)
+   {
+      const auto device = global_context->find("device");
+      if (device != global_context->end())
+      {
+         mfem::out << device->first << " : " << device->second << std::endl;
+         device_config = device->second;
+      }
+      const auto bw = global_context->find("peak_bw");
+      if (bw != global_context->end()) { peak_bw = std::stod(bw->second); }
+      const auto gf = global_context->find("peak_gflops");
+      if (gf != global_context->end())
+      {
+         peak_gflops = std::stod(gf->second);
+      }
+   }
+   Device device(device_config.c_str());
+   device.Print();
+
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
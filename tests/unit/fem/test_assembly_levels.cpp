@@ -316,6 +316,74 @@ TEST_CASE("H(div) Element Assembly", "[AssemblyLevel][GPU]")
    }
 }
 
+TEST_CASE("H(curl) Element Assembly", "[AssemblyLevel][GPU]")
+{
+   const auto fname = GENERATE(
+                         "../../data/inline-quad.mesh",
+                         "../../data/star-q3.mesh",
+                         "../../data/inline-hex.mesh",
+                         "../../data/fichera-q2.mesh"
+                      );
+   const auto order = GENERATE(1, 2);
+   const auto problem = GENERATE(Problem::Mass, Problem::Diffusion);
+
+   CAPTURE(fname, order, getString(problem));
+
+   Mesh mesh(fname);
+   const int dim = mesh.Dimension();
+   const int ne = mesh.GetNE();
+
+   ND_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   std::unique_ptr<BilinearFormIntegrator> integ;
+   if (problem == Problem::Mass) { integ.reset(new VectorFEMassIntegrator); }
+   else if (problem == Problem::Diffusion)
+   {
+      integ.reset(new CurlCurlIntegrator);
+   }
+
+   const FiniteElement &fe = *fes.GetFE(0);
+   {
+      ElementTransformation &T = *mesh.GetElementTransformation(0);
+      integ->SetIntegrationRule(MassIntegrator::GetRule(fe, fe, T));
+   }
+
+   const TensorBasisElement *tbe =
+      dynamic_cast<const TensorBasisElement*>(&fe);
+   MFEM_VERIFY(tbe, "");
+   const int ndof = fes.GetFE(0)->GetDof();
+   const Array<int> &dof_map = tbe->GetDofMap();
+
+   Vector ea_data(ne*ndof*ndof);
+   integ->AssembleEA(fes, ea_data, false);
+   const auto ea_mats = Reshape(ea_data.HostRead(), ndof, ndof, ne);
+
+   DenseMatrix elmat;
+   for (int e = 0; e < ne; ++e)
+   {
+      const FiniteElement &el = *fes.GetFE(e);
+      ElementTransformation &T = *mesh.GetElementTransformation(e);
+      integ->AssembleElementMatrix(el, T, elmat);
+
+      for (int i = 0; i < ndof; ++i)
+      {
+         const int ii_s = dof_map[i];
+         const int ii = ii_s >= 0 ? ii_s : -1 - ii_s;
+         const int s_i = ii_s >= 0 ? 1 : -1;
+         for (int j = 0; j < ndof; ++j)
+         {
+            const int jj_s = dof_map[j];
+            const int jj = jj_s >= 0 ? jj_s : -1 - jj_s;
+            const int s_j = jj_s >= 0 ? 1 : -1;
+            elmat(ii, jj) -= s_i*s_j*ea_mats(i, j, e);
+         }
+      }
+
+      REQUIRE(elmat.MaxMaxNorm() == MFEM_Approx(0.0, 1e-10));
+   }
+}
+
 TEST_CASE("NormalTraceJumpIntegrator Element Assembly", "[AssemblyLevel][GPU]")
 {
    const auto fname = GENERATE(
@@ -391,6 +459,180 @@ TEST_CASE("NormalTraceJumpIntegrator Element Assembly", "[AssemblyLevel][GPU]")
    }
 }
 
+TEST_CASE("H1 Matrix-Free Diffusion", "[AssemblyLevel][GPU]")
+{
+   const auto fname = GENERATE(
+                         "../../data/star-q3.mesh",
+                         "../../data/amr-quad.mesh",
+                         "../../data/fichera-q2.mesh",
+                         "../../data/fichera-amr.mesh"
+                      );
+   const auto order = GENERATE(1, 2, 3);
+   const bool variable_coeff = GENERATE(false, true);
+
+   CAPTURE(fname, order, variable_coeff);
+
+   Mesh mesh(fname);
+   const int dim = mesh.Dimension();
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   ConstantCoefficient one(1.0);
+   FunctionCoefficient coeff([](const Vector &x) { return 1.0 + x*x; });
+   Coefficient &q = variable_coeff ? (Coefficient&)coeff : (Coefficient&)one;
+
+   BilinearForm a_pa(&fes), a_mf(&fes);
+   a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_mf.SetAssemblyLevel(AssemblyLevel::NONE);
+   a_pa.AddDomainIntegrator(new DiffusionIntegrator(q));
+   a_mf.AddDomainIntegrator(new DiffusionIntegrator(q));
+   a_pa.Assemble();
+   a_mf.Assemble();
+
+   GridFunction x(&fes), y_pa(&fes), y_mf(&fes);
+   x.Randomize(1);
+   a_pa.Mult(x, y_pa);
+   a_mf.Mult(x, y_mf);
+   y_mf -= y_pa;
+   REQUIRE(y_mf.Normlinf() == MFEM_Approx(0.0, 1e-10, 1e-10));
+
+   Vector diag_pa(fes.GetTrueVSize()), diag_mf(fes.GetTrueVSize());
+   a_pa.AssembleDiagonal(diag_pa);
+   a_mf.AssembleDiagonal(diag_mf);
+   diag_mf -= diag_pa;
+   REQUIRE(diag_mf.Normlinf() == MFEM_Approx(0.0, 1e-10, 1e-10));
+}
+
+TEST_CASE("H1 Fused Sum Partial Assembly", "[AssemblyLevel][GPU]")
+{
+   const auto fname = GENERATE(
+                         "../../data/star-q3.mesh",
+                         "../../data/fichera-q2.mesh"
+                      );
+   const auto order = GENERATE(1, 2, 3);
+   const bool variable_coeff = GENERATE(false, true);
+
+   CAPTURE(fname, order, variable_coeff);
+
+   Mesh mesh(fname);
+   const int dim = mesh.Dimension();
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   ConstantCoefficient one(1.0);
+   FunctionCoefficient coeff([](const Vector &x) { return 1.0 + x*x; });
+   Coefficient &q = variable_coeff ? (Coefficient&)coeff : (Coefficient&)one;
+   VectorFunctionCoefficient vel(dim, velocity_function);
+
+   const IntegrationRule &ir =
+      IntRules.Get(mesh.GetTypicalElementGeometry(), 2*order + 2);
+
+   BilinearForm a_fused(&fes), a_ref(&fes);
+   a_fused.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_ref.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+
+   SumIntegrator *sum = new SumIntegrator;
+   sum->AddIntegrator(new MassIntegrator(q));
+   sum->AddIntegrator(new DiffusionIntegrator(q));
+   sum->AddIntegrator(new ConvectionIntegrator(vel, -0.5));
+   sum->SetIntRule(&ir);
+   a_fused.AddDomainIntegrator(sum);
+
+   a_ref.AddDomainIntegrator(new MassIntegrator(q, &ir));
+   a_ref.AddDomainIntegrator(new DiffusionIntegrator(q, &ir));
+   a_ref.AddDomainIntegrator(new ConvectionIntegrator(vel, -0.5));
+   (*a_ref.GetDBFI())[2]->SetIntRule(&ir);
+
+   a_fused.Assemble();
+   a_ref.Assemble();
+   REQUIRE(sum->IsFusedPA());
+
+   GridFunction x(&fes), y_fused(&fes), y_ref(&fes);
+   x.Randomize(1);
+   a_fused.Mult(x, y_fused);
+   a_ref.Mult(x, y_ref);
+   y_ref -= y_fused;
+   REQUIRE(y_ref.Normlinf() == MFEM_Approx(0.0, 1e-10, 1e-10));
+
+   // The transpose falls back to the individual integrators
+   a_fused.MultTranspose(x, y_fused);
+   a_ref.MultTranspose(x, y_ref);
+   y_ref -= y_fused;
+   REQUIRE(y_ref.Normlinf() == MFEM_Approx(0.0, 1e-10, 1e-10));
+}
+
+TEST_CASE("Assembly Level Cost Model", "[AssemblyLevel]")
+{
+   const int order = GENERATE(1, 3);
+   CAPTURE(order);
+
+   Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+   H1_FECollection fec(order, 2);
+   FiniteElementSpace fes(&mesh, &fec);
+   const int ne = mesh.GetNE(), D = order + 1;
+   const IntegrationRule &ir = IntRules.Get(Geometry::SQUARE, 2*order + 2);
+   const int Q = order + 2;
+   REQUIRE(ir.GetNPoints() == Q*Q);
+
+   auto cost_model = [&](AssemblyLevel assembly, bool diffusion)
+   {
+      BilinearForm a(&fes);
+      a.SetAssemblyLevel(assembly);
+      if (diffusion) { a.AddDomainIntegrator(new DiffusionIntegrator(&ir)); }
+      else { a.AddDomainIntegrator(new MassIntegrator(&ir)); }
+      a.Assemble();
+      if (assembly == AssemblyLevel::FULL)
+      {
+         REQUIRE(a.GetCostModel().flops_per_apply ==
+                 2.0*a.SpMat().NumNonZeroElems());
+      }
+      return a.GetCostModel();
+   };
+
+   const auto *R = dynamic_cast<const ElementRestriction*>(
+                      fes.GetElementRestriction(
+                         ElementDofOrdering::LEXICOGRAPHIC));
+   REQUIRE(R != nullptr);
+   const real_t r_bytes = sizeof(int)*(R->Offsets().Size() +
+                                       R->Indices().Size() +
+                                       R->GatherMap().Size());
+   // Sum-factorized interpolation from the dofs to the points of an element
+   const real_t interp = 2.0*D*D*Q + 2.0*D*Q*Q;
+
+   for (const bool diffusion : {false, true})
+   {
+      CAPTURE(diffusion);
+      const OperatorCostModel pa = cost_model(AssemblyLevel::PARTIAL, diffusion);
+      const OperatorCostModel ea = cost_model(AssemblyLevel::ELEMENT, diffusion);
+      const OperatorCostModel fa = cost_model(AssemblyLevel::FULL, diffusion);
+      const OperatorCostModel lg = cost_model(AssemblyLevel::LEGACY, diffusion);
+      REQUIRE((pa.complete && ea.complete && fa.complete && lg.complete));
+
+      // Quadrature data: one value per point for the mass, and the symmetric
+      // 2x2 matrix for the diffusion.
+      const int qdata = diffusion ? 3 : 1;
+      REQUIRE(pa.stored_bytes == sizeof(real_t)*ne*Q*Q*qdata + r_bytes);
+      const real_t pa_flops = diffusion ?
+                              ne*(4*interp + 8.0*Q*Q) : ne*(2*interp + Q*Q);
+      REQUIRE(pa.flops_per_apply == MFEM_Approx(pa_flops));
+
+      REQUIRE(ea.stored_bytes == sizeof(real_t)*ne*D*D*D*D + r_bytes);
+      REQUIRE(ea.flops_per_apply == 2.0*ne*D*D*D*D);
+
+      REQUIRE(fa.stored_bytes == MFEM_Approx(lg.stored_bytes));
+      REQUIRE(fa.bytes_per_apply > fa.stored_bytes);
+      REQUIRE(pa.ArithmeticIntensity() > fa.ArithmeticIntensity());
+   }
+
+   // Integrators without a cost model make the model incomplete
+   BilinearForm a(&fes);
+   a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a.AddDomainIntegrator(new MassIntegrator(&ir));
+   a.AddBoundaryIntegrator(new MassIntegrator);
+   a.Assemble();
+   REQUIRE_FALSE(a.GetCostModel().complete);
+}
+
 TEST_CASE("L2 Assembly Levels", "[AssemblyLevel], [PartialAssembly], [GPU]")
 {
    const bool dg = true;
@@ -591,6 +833,58 @@ TEST_CASE("Serial H1 Full Assembly", "[AssemblyLevel], [GPU]")
    TestH1FullAssembly(mesh, order);
 }
 
+TEST_CASE("Serial H(curl) and H(div) Full Assembly", "[AssemblyLevel], [GPU]")
+{
+   const auto order = GENERATE(1, 2);
+   const auto mesh_fname = GENERATE(
+                              "../../data/star.mesh",
+                              "../../data/fichera.mesh"
+                           );
+   const auto space = GENERATE(FiniteElement::CURL, FiniteElement::DIV);
+   const auto problem = GENERATE(Problem::Mass, Problem::Diffusion);
+
+   CAPTURE(mesh_fname, order, space, getString(problem));
+
+   Mesh mesh(mesh_fname);
+   const int dim = mesh.Dimension();
+
+   std::unique_ptr<FiniteElementCollection> fec;
+   if (space == FiniteElement::CURL)
+   {
+      fec.reset(new ND_FECollection(order, dim));
+   }
+   else
+   {
+      fec.reset(new RT_FECollection(order - 1, dim));
+   }
+   FiniteElementSpace fes(&mesh, fec.get());
+
+   auto make_integ = [&]() -> BilinearFormIntegrator*
+   {
+      if (problem == Problem::Mass) { return new VectorFEMassIntegrator; }
+      if (space == FiniteElement::CURL) { return new CurlCurlIntegrator; }
+      return new DivDivIntegrator;
+   };
+
+   BilinearForm a_fa(&fes), a_legacy(&fes);
+   a_fa.SetAssemblyLevel(AssemblyLevel::FULL);
+   a_fa.AddDomainIntegrator(make_integ());
+   a_legacy.AddDomainIntegrator(make_integ());
+   a_fa.SetDiagonalPolicy(Operator::DIAG_ONE);
+   a_legacy.SetDiagonalPolicy(Operator::DIAG_ONE);
+   a_fa.Assemble();
+   a_legacy.Assemble();
+   a_legacy.Finalize();
+
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+   OperatorHandle A_fa, A_legacy;
+   a_fa.FormSystemMatrix(ess_tdof_list, A_fa);
+   a_legacy.FormSystemMatrix(ess_tdof_list, A_legacy);
+
+   TestSameSparseMatrices(A_fa, A_legacy);
+}
+
 TEST_CASE("Full Assembly Connectivity", "[AssemblyLevel], [GPU]")
 {
    const int order = GENERATE(1, 2, 3);
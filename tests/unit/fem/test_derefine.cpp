@@ -296,6 +296,88 @@ TEST_CASE("AMR Coarsen L2 Element","[AMR][Coarsen][CUDA]")
    }
 }
 
+// Compare the refinement update operator, which is applied in batches, with
+// the assembled refinement matrix.
+TEST_CASE("Refinement Update Operator", "[AMR][CUDA]")
+{
+   auto el_type = GENERATE(Element::TRIANGLE, Element::QUADRILATERAL,
+                           Element::TETRAHEDRON, Element::HEXAHEDRON,
+                           Element::WEDGE);
+   auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   dimension = (el_type <= Element::QUADRILATERAL) ? 2 : 3;
+
+   Mesh mesh = (dimension == 2) ?
+               Mesh::MakeCartesian2D(3, 3, el_type, true) :
+               Mesh::MakeCartesian3D(2, 2, 2, el_type);
+   mesh.EnsureNCMesh(true);
+
+   H1_FECollection h1_fec(3, dimension);
+   ND_FECollection nd_fec(2, dimension);
+   L2_FECollection l2_fec(2, dimension);
+   std::vector<FiniteElementSpace*> spaces, matrix_spaces;
+   for (FiniteElementCollection *fec :
+        std::vector<FiniteElementCollection*> {&h1_fec, &nd_fec, &l2_fec})
+   {
+      // The assembled refinement matrix does not apply DOF transformations
+      if (fec == &nd_fec && (el_type == Element::TETRAHEDRON ||
+                             el_type == Element::WEDGE)) { continue; }
+      const int vdim = (fec == &nd_fec) ? 1 : dimension;
+      spaces.push_back(new FiniteElementSpace(&mesh, fec, vdim, ordering));
+      matrix_spaces.push_back(
+         new FiniteElementSpace(&mesh, fec, vdim, ordering));
+      matrix_spaces.back()->SetUpdateOperatorType(Operator::MFEM_SPARSEMAT);
+   }
+
+   for (int iter = 0; iter < 3; iter++)
+   {
+      // Random conforming coarse vectors
+      std::vector<Vector> coarse(spaces.size());
+      for (int s = 0; s < (int) spaces.size(); s++)
+      {
+         Vector tx(spaces[s]->GetTrueVSize());
+         tx.Randomize(s + 1);
+         coarse[s].SetSize(spaces[s]->GetVSize());
+         const Operator *P = spaces[s]->GetProlongationMatrix();
+         if (P) { P->Mult(tx, coarse[s]); }
+         else { coarse[s] = tx; }
+      }
+
+      Array<int> refs;
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         if ((i + iter) % 3 == 0) { refs.Append(i); }
+      }
+      mesh.GeneralRefinement(refs, 1, 1);
+
+      for (int s = 0; s < (int) spaces.size(); s++)
+      {
+         spaces[s]->Update();
+         matrix_spaces[s]->Update();
+         const Operator *T = spaces[s]->GetUpdateOperator();
+         const Operator *M = matrix_spaces[s]->GetUpdateOperator();
+         REQUIRE(T->Height() == M->Height());
+         REQUIRE(T->Width() == M->Width());
+
+         const Vector &x = coarse[s];
+         Vector y(T->Height()), y_M(T->Height());
+         T->Mult(x, y);
+         M->Mult(x, y_M);
+         y -= y_M;
+         REQUIRE(y.Normlinf() < 1e-12 * y_M.Normlinf());
+
+         Vector xt(T->Height()), yt(T->Width()), yt_M(T->Width());
+         xt.Randomize(2);
+         T->MultTranspose(xt, yt);
+         M->MultTranspose(xt, yt_M);
+         yt -= yt_M;
+         REQUIRE(yt.Normlinf() < 1e-12 * yt_M.Normlinf());
+      }
+   }
+
+   for (auto *fes : spaces) { delete fes; }
+   for (auto *fes : matrix_spaces) { delete fes; }
+}
+
 #ifdef MFEM_USE_MPI
 
 void RefineRandomly(ParMesh& pmesh,
@@ -96,3 +96,137 @@ TEST_CASE("NonlinearForm Boundary Integrator", "[NonlinearForm]")
    u2 -= u1;
    REQUIRE(u2.Norml2() == MFEM_Approx(0.0, 1e-5));
 }
+
+TEST_CASE("Hyperelastic PA", "[NonlinearForm][PartialAssembly]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const int model_type = GENERATE(0, 1, 2);
+   const bool simplex = GENERATE(false, true);
+   CAPTURE(dim, order, model_type, simplex);
+
+   const Element::Type type = (dim == 2) ?
+                              (simplex ? Element::TRIANGLE :
+                               Element::QUADRILATERAL) :
+                              (simplex ? Element::TETRAHEDRON :
+                               Element::HEXAHEDRON);
+   Mesh mesh = (dim == 2) ? Mesh::MakeCartesian2D(3, 3, type) :
+               Mesh::MakeCartesian3D(2, 2, 2, type);
+
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim);
+
+   // Deformed configuration: a small random perturbation of the mesh nodes.
+   GridFunction x(&fes), dx(&fes);
+   mesh.GetNodes(x);
+   dx.Randomize(1);
+   x.Add(0.02, dx);
+
+   FunctionCoefficient mu([](const Vector &p) { return 1.0 + p(0); });
+   ConstantCoefficient K(5.0);
+   InverseHarmonicModel ih_model;
+   NeoHookeanModel nh_model(0.25, 5.0);
+   NeoHookeanModel nh_coeff_model(mu, K);
+   HyperelasticModel *model = (model_type == 0) ? (HyperelasticModel*)&ih_model :
+                              (model_type == 1) ? (HyperelasticModel*)&nh_model :
+                              (HyperelasticModel*)&nh_coeff_model;
+
+   NonlinearForm nlf_fa(&fes), nlf_pa(&fes);
+   nlf_fa.AddDomainIntegrator(new HyperelasticNLFIntegrator(model));
+   nlf_pa.AddDomainIntegrator(new HyperelasticNLFIntegrator(model));
+   nlf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   nlf_pa.Setup();
+
+   REQUIRE(nlf_pa.GetEnergy(x) == MFEM_Approx(nlf_fa.GetEnergy(x)));
+
+   Vector y_fa(fes.GetVSize()), y_pa(fes.GetVSize());
+   nlf_fa.Mult(x, y_fa);
+   nlf_pa.Mult(x, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-10 * y_fa.Normlinf()));
+
+   SparseMatrix &grad_fa = dynamic_cast<SparseMatrix&>(nlf_fa.GetGradient(x));
+   Operator &grad_pa = nlf_pa.GetGradient(x);
+
+   Vector v(fes.GetVSize());
+   v.Randomize(2);
+   grad_fa.Mult(v, y_fa);
+   grad_pa.Mult(v, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-10 * y_fa.Normlinf()));
+
+   Vector diag_fa(fes.GetVSize()), diag_pa(fes.GetVSize());
+   grad_fa.GetDiag(diag_fa);
+   grad_pa.AssembleDiagonal(diag_pa);
+   diag_pa -= diag_fa;
+   REQUIRE(diag_pa.Normlinf() ==
+           MFEM_Approx(0.0, 1e-10 * diag_fa.Normlinf()));
+}
+
+TEST_CASE("Hyperbolic PA", "[NonlinearForm][PartialAssembly]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const int flux_type = GENERATE(0, 1, 2);
+   const bool upwind = GENERATE(false, true);
+   CAPTURE(dim, order, flux_type, upwind);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   mesh.SetCurvature(2);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.05 * sin(M_PI * x(1));
+      y(1) += 0.05 * sin(M_PI * x(0));
+   });
+
+   BurgersFlux burgers(dim);
+   ShallowWaterFlux shallow_water(dim);
+   EulerFlux euler(dim, 1.4);
+   const FluxFunction &flux = (flux_type == 0) ? (FluxFunction&)burgers :
+                              (flux_type == 1) ? (FluxFunction&)shallow_water :
+                              (FluxFunction&)euler;
+   RusanovFlux rusanov(flux);
+   ComponentwiseUpwindFlux componentwise_upwind(flux);
+   const NumericalFlux &num_flux = upwind ?
+                                   (NumericalFlux&)componentwise_upwind :
+                                   (NumericalFlux&)rusanov;
+   const int num_equations = flux.num_equations;
+
+   L2_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec, num_equations);
+
+   // Random state with positive density/height and pressure
+   GridFunction x(&fes);
+   x.Randomize(1);
+   const int ndofs = fes.GetNDofs();
+   for (int c = 0; c < num_equations; c++)
+   {
+      const real_t base = (c == 0) ? 1.0 : (c == dim + 1) ? 2.5 : 0.0;
+      for (int i = 0; i < ndofs; i++)
+      {
+         x(i + c*ndofs) = base + 0.1 * x(i + c*ndofs);
+      }
+   }
+
+   HyperbolicFormIntegrator integ_fa(num_flux), integ_pa(num_flux);
+   NonlinearForm nlf_fa(&fes), nlf_pa(&fes);
+   nlf_fa.AddDomainIntegrator(&integ_fa);
+   nlf_fa.AddInteriorFaceIntegrator(&integ_fa);
+   nlf_fa.UseExternalIntegrators();
+   nlf_pa.AddDomainIntegrator(&integ_pa);
+   nlf_pa.AddInteriorFaceIntegrator(&integ_pa);
+   nlf_pa.UseExternalIntegrators();
+   nlf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   nlf_pa.Setup();
+
+   Vector y_fa(fes.GetVSize()), y_pa(fes.GetVSize());
+   nlf_fa.Mult(x, y_fa);
+   nlf_pa.Mult(x, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-12 * y_fa.Normlinf()));
+   REQUIRE(integ_pa.GetMaxCharSpeed() ==
+           MFEM_Approx(integ_fa.GetMaxCharSpeed()));
+}
@@ -0,0 +1,162 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace nurbs_patch
+{
+
+static real_t coeff_func(const Vector &x)
+{
+   return 1.0 + 0.25*x(0) + 0.5*x(1)*x(1) + 0.125*x(2);
+}
+
+static void vcoeff_func(const Vector &x, Vector &v)
+{
+   v(0) = 1.0 + x(0)*x(0);
+   v(1) = 2.0 + x(1);
+   v(2) = 1.5 + 0.5*x(2);
+}
+
+// Tensor product rules of the given order on the knot spans of each patch.
+static NURBSMeshRules *MakePatchRules(Mesh &mesh, int ir_order)
+{
+   const int dim = mesh.Dimension();
+   NURBSMeshRules *rules = new NURBSMeshRules(mesh.NURBSext->GetNP(), dim);
+   for (int p = 0; p < mesh.NURBSext->GetNP(); ++p)
+   {
+      Array<const KnotVector*> kv(dim);
+      mesh.NURBSext->GetPatchKnotVectors(p, kv);
+      std::vector<const IntegrationRule*> ir1D(dim);
+      const IntegrationRule *ir = &IntRules.Get(Geometry::SEGMENT, ir_order);
+      for (int d = 0; d < dim; ++d)
+      {
+         ir1D[d] = ir->ApplyToKnotIntervals(*kv[d]);
+      }
+      rules->SetPatchRules1D(p, ir1D);
+   }
+   rules->Finalize(mesh);
+   return rules;
+}
+
+enum class Integ { MASS, VECDIFF, VECDIFF_VQ, ELASTICITY };
+
+static BilinearFormIntegrator *MakeIntegrator(Integ type,
+                                              Coefficient &q,
+                                              VectorCoefficient &vq)
+{
+   switch (type)
+   {
+      case Integ::MASS: return new MassIntegrator(q);
+      case Integ::VECDIFF: return new VectorDiffusionIntegrator(q);
+      case Integ::VECDIFF_VQ: return new VectorDiffusionIntegrator(vq);
+      case Integ::ELASTICITY: return new ElasticityIntegrator(q, 1.5, 0.75);
+   }
+   return nullptr;
+}
+
+TEST_CASE("NURBS patch assembly", "[NURBS][PartialAssembly]")
+{
+   const Integ type = GENERATE(Integ::MASS, Integ::VECDIFF,
+                               Integ::VECDIFF_VQ, Integ::ELASTICITY);
+   const int ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   CAPTURE(int(type), ordering);
+
+   Mesh mesh("../../data/beam-hex-nurbs.mesh", 1, 1);
+   mesh.DegreeElevate(1);
+   mesh.UniformRefinement();
+
+   const FiniteElementCollection *fec = mesh.GetNodes()->OwnFEC();
+   const int vdim = (type == Integ::MASS) ? 1 : 3;
+   FiniteElementSpace fes(&mesh, fec, vdim, ordering);
+   std::unique_ptr<NURBSMeshRules> rules(
+      MakePatchRules(mesh, 2*fec->GetOrder()));
+
+   FunctionCoefficient q(coeff_func);
+   VectorFunctionCoefficient vq(3, vcoeff_func);
+
+   // Reference: element-wise assembly with the same rules.
+   BilinearForm a_elem(&fes);
+   BilinearFormIntegrator *integ_elem = MakeIntegrator(type, q, vq);
+   integ_elem->SetNURBSPatchIntRule(rules.get());
+   a_elem.AddDomainIntegrator(integ_elem);
+   a_elem.Assemble();
+   a_elem.Finalize();
+   const SparseMatrix &A_elem = a_elem.SpMat();
+
+   Vector x(fes.GetVSize()), y_elem(fes.GetVSize());
+   x.Randomize(1);
+   A_elem.Mult(x, y_elem);
+   Vector diag_elem;
+   A_elem.GetDiag(diag_elem);
+
+   SECTION("Partial assembly")
+   {
+      BilinearForm a_pa(&fes);
+      a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      BilinearFormIntegrator *integ = MakeIntegrator(type, q, vq);
+      integ->SetIntegrationMode(NonlinearFormIntegrator::Mode::PATCHWISE);
+      integ->SetNURBSPatchIntRule(rules.get());
+      a_pa.AddDomainIntegrator(integ);
+      a_pa.Assemble();
+
+      Vector y_pa(fes.GetVSize());
+      a_pa.Mult(x, y_pa);
+      y_pa -= y_elem;
+      REQUIRE(y_pa.Normlinf() <= 1e-12 * y_elem.Normlinf());
+
+      Vector diag_pa(fes.GetVSize());
+      a_pa.AssembleDiagonal(diag_pa);
+      diag_pa -= diag_elem;
+      REQUIRE(diag_pa.Normlinf() <= 1e-12 * diag_elem.Normlinf());
+   }
+
+   SECTION("Patch matrix")
+   {
+      BilinearForm a_patch(&fes);
+      BilinearFormIntegrator *integ = MakeIntegrator(type, q, vq);
+      integ->SetIntegrationMode(NonlinearFormIntegrator::Mode::PATCHWISE);
+      integ->SetNURBSPatchIntRule(rules.get());
+      a_patch.AddDomainIntegrator(integ);
+      a_patch.Assemble();
+      a_patch.Finalize();
+
+      Vector y_patch(fes.GetVSize());
+      a_patch.SpMat().Mult(x, y_patch);
+      y_patch -= y_elem;
+      REQUIRE(y_patch.Normlinf() <= 1e-12 * y_elem.Normlinf());
+   }
+
+#if defined(MFEM_USE_LAPACK) && !defined(MFEM_USE_SINGLE)
+   SECTION("Reduced patch matrix")
+   {
+      BilinearForm a_red(&fes);
+      BilinearFormIntegrator *integ = MakeIntegrator(type, q, vq);
+      integ->SetIntegrationMode(
+         NonlinearFormIntegrator::Mode::PATCHWISE_REDUCED);
+      integ->SetNURBSPatchIntRule(rules.get());
+      a_red.AddDomainIntegrator(integ);
+      a_red.Assemble();
+      a_red.Finalize();
+
+      // The reduced rules only approximate the full rules.
+      Vector y_red(fes.GetVSize());
+      a_red.SpMat().Mult(x, y_red);
+      y_red -= y_elem;
+      REQUIRE(y_red.Normlinf() <= 0.1 * y_elem.Normlinf());
+   }
+#endif
+}
+
+} // namespace nurbs_patch
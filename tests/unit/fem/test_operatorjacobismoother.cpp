@@ -138,3 +138,73 @@ TEST_CASE("OperatorJacobiSmoother Fichera", "[OperatorJacobiSmoother]")
       }
    }
 }
+
+TEST_CASE("BlockJacobiSmoother", "[BlockJacobiSmoother]")
+{
+   const int dimension = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   CAPTURE(dimension, order);
+
+   Mesh mesh = (dimension == 2) ?
+               Mesh::MakeCartesian2D(2, 2, Element::QUADRILATERAL, true) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   H1_FECollection fec(order, dimension);
+   FiniteElementSpace fespace(&mesh, &fec, dimension);
+   Array<int> ess_tdof_list;
+   Array<int> ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = 0;
+   ess_bdr[0] = 1;
+   fespace.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient lambda(2.0), mu(1.0);
+   BilinearForm paform(&fespace);
+   paform.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   paform.AddDomainIntegrator(new ElasticityIntegrator(lambda, mu));
+   paform.Assemble();
+   DenseTensor pa_blocks;
+   Array<int> pa_block_dofs;
+   paform.AssembleBlockDiagonal(pa_blocks, pa_block_dofs);
+   BlockJacobiSmoother pa_smoother(pa_blocks, pa_block_dofs, ess_tdof_list);
+
+   // Reference: blocks of the matrix with eliminated essential dofs
+   GridFunction x(&fespace), b(&fespace);
+   x = 0.0;
+   b = 1.0;
+   BilinearForm faform(&fespace);
+   faform.AddDomainIntegrator(new ElasticityIntegrator(lambda, mu));
+   faform.SetDiagonalPolicy(Matrix::DIAG_ONE);
+   faform.Assemble();
+   OperatorPtr A_fa;
+   Vector B, X;
+   faform.FormLinearSystem(ess_tdof_list, x, b, A_fa, X, B);
+   DenseTensor fa_blocks;
+   Array<int> fa_block_dofs;
+   faform.AssembleBlockDiagonal(fa_blocks, fa_block_dofs);
+   REQUIRE(fa_block_dofs.Size() == pa_block_dofs.Size());
+   Array<int> no_ess;
+   BlockJacobiSmoother fa_smoother(fa_blocks, fa_block_dofs, no_ess);
+
+   Vector xin(fespace.GetTrueVSize());
+   xin.Randomize(1);
+   Vector y_fa(xin.Size()), y_pa(xin.Size());
+   fa_smoother.Mult(xin, y_fa);
+   pa_smoother.Mult(xin, y_pa);
+
+   // Each block of y_fa solves the corresponding block system
+   const int vdim = fespace.GetVDim();
+   Vector xk(vdim), yk(vdim), rk(vdim);
+   for (int k = 0; k < fa_blocks.SizeK(); k++)
+   {
+      for (int r = 0; r < vdim; r++)
+      {
+         xk(r) = xin(fa_block_dofs[r + vdim*k]);
+         yk(r) = y_fa(fa_block_dofs[r + vdim*k]);
+      }
+      fa_blocks(k).Mult(yk, rk);
+      rk -= xk;
+      REQUIRE(rk.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   y_fa -= y_pa;
+   REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
+}
@@ -287,7 +287,7 @@ double test_vdiag_pa(int dim, int order)
    }
    else if (dim == 3)
    {
-      mesh = Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON, 1.0, 1.0, 1.0);
+      mesh = Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
    }
 
    H1_FECollection fec(order, dim);
@@ -485,4 +485,172 @@ TEST_CASE("Hcurl/Hdiv diagonal PA",
    }  // dimension
 }
 
+
+TEST_CASE("Convection Diagonal PA", "[PartialAssembly][AssembleDiagonal]")
+{
+   const int dimension = GENERATE(2, 3);
+   const int order = GENERATE(1, 2, 3);
+   CAPTURE(dimension, order);
+
+   Mesh mesh = (dimension == 2) ?
+               Mesh::MakeCartesian2D(2, 2, Element::QUADRILATERAL, true) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   H1_FECollection fec(order, dimension);
+   FiniteElementSpace fespace(&mesh, &fec);
+   VectorFunctionCoefficient vel(dimension, &vectorCoeffFunction);
+
+   BilinearForm paform(&fespace);
+   paform.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   paform.AddDomainIntegrator(new ConvectionIntegrator(vel));
+   paform.Assemble();
+   Vector pa_diag(fespace.GetVSize());
+   paform.AssembleDiagonal(pa_diag);
+
+   BilinearForm faform(&fespace);
+   faform.AddDomainIntegrator(new ConvectionIntegrator(vel));
+   faform.Assemble();
+   faform.Finalize();
+   Vector assembly_diag(fespace.GetVSize());
+   faform.SpMat().GetDiag(assembly_diag);
+
+   assembly_diag -= pa_diag;
+   REQUIRE(assembly_diag.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("Vector Block Diagonal PA",
+          "[AssembleDiagonal][PartialAssembly][VectorPA][VectorDiagonalPA]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   const int type = GENERATE(0, 1, 2, 3);
+   CAPTURE(dim, order, ordering, type);
+   // Elasticity PA only supports byNODES ordering
+   if (type == 3 && ordering == Ordering::byVDIM) { return; }
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(2, 2, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim, ordering);
+
+   // 0: vector mass with a vector coefficient, 1: vector mass with a matrix
+   // coefficient, 2: vector diffusion with a vector coefficient, 3: elasticity
+   VectorFunctionCoefficient vcoeff(dim, &vectorCoeffFunction);
+   MatrixFunctionCoefficient mcoeff(dim, &asymmetricMatrixCoeffFunction);
+   FunctionCoefficient lambda(&coeffFunction);
+   ConstantCoefficient mu(1.3);
+   auto integrator = [&]() -> BilinearFormIntegrator*
+   {
+      switch (type)
+      {
+         case 0: return new VectorMassIntegrator(vcoeff);
+         case 1: return new VectorMassIntegrator(mcoeff);
+         case 2: return new VectorDiffusionIntegrator(vcoeff);
+         default: return new ElasticityIntegrator(lambda, mu);
+      }
+   };
+
+   BilinearForm form_full(&fes);
+   form_full.AddDomainIntegrator(integrator());
+   form_full.Assemble();
+   form_full.Finalize();
+
+   BilinearForm form(&fes);
+   form.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   form.AddDomainIntegrator(integrator());
+   form.Assemble();
+
+   Vector diag(fes.GetVSize()), diag_full(fes.GetVSize());
+   if (type < 3)
+   {
+      form.AssembleDiagonal(diag);
+      form_full.SpMat().GetDiag(diag_full);
+      diag_full -= diag;
+      REQUIRE(diag_full.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   DenseTensor blocks, blocks_full;
+   Array<int> block_dofs, block_dofs_full;
+   form.AssembleBlockDiagonal(blocks, block_dofs);
+   form_full.AssembleBlockDiagonal(blocks_full, block_dofs_full);
+   REQUIRE(blocks.SizeK() == fes.GetNDofs());
+   REQUIRE(block_dofs.Size() == fes.GetVSize());
+
+   const SparseMatrix &A = form_full.SpMat();
+   real_t error = 0.0;
+   for (int k = 0; k < blocks.SizeK(); k++)
+   {
+      for (int r = 0; r < dim; r++)
+      {
+         REQUIRE(block_dofs[r + dim*k] == block_dofs_full[r + dim*k]);
+         for (int c = 0; c < dim; c++)
+         {
+            const int i = block_dofs[r + dim*k], j = block_dofs[c + dim*k];
+            error = std::max(error, std::abs(blocks(r, c, k) - A(i, j)));
+            error = std::max(error, std::abs(blocks(r, c, k) -
+                                             blocks_full(r, c, k)));
+         }
+      }
+   }
+   REQUIRE(error == MFEM_Approx(0.0));
+}
+
+TEST_CASE("DG Element Block Diagonal", "[AssembleDiagonal][PartialAssembly]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const auto assembly = GENERATE(AssemblyLevel::LEGACY,
+                                  AssemblyLevel::ELEMENT,
+                                  AssemblyLevel::PARTIAL);
+   CAPTURE(dim, order, assembly);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   L2_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec);
+   VectorFunctionCoefficient vel(dim, &vectorCoeffFunction);
+
+   auto add_integrators = [&](BilinearForm &a)
+   {
+      a.AddDomainIntegrator(new MassIntegrator);
+      a.AddInteriorFaceIntegrator(new DGTraceIntegrator(vel, 1.0, -0.5));
+      a.AddBdrFaceIntegrator(new DGTraceIntegrator(vel, 1.0, -0.5));
+   };
+
+   BilinearForm form_full(&fes);
+   add_integrators(form_full);
+   form_full.Assemble();
+   form_full.Finalize();
+
+   BilinearForm form(&fes);
+   form.SetAssemblyLevel(assembly);
+   add_integrators(form);
+   form.Assemble();
+   if (assembly == AssemblyLevel::LEGACY) { form.Finalize(); }
+
+   DenseTensor blocks;
+   Array<int> block_dofs;
+   form.AssembleElementBlockDiagonal(blocks, block_dofs);
+   REQUIRE(blocks.SizeK() == mesh.GetNE());
+   REQUIRE(block_dofs.Size() == fes.GetVSize());
+
+   const SparseMatrix &A = form_full.SpMat();
+   const int m = blocks.SizeI();
+   real_t error = 0.0;
+   for (int e = 0; e < blocks.SizeK(); e++)
+   {
+      for (int i = 0; i < m; i++)
+      {
+         for (int j = 0; j < m; j++)
+         {
+            const real_t a = A(block_dofs[i + m*e], block_dofs[j + m*e]);
+            error = std::max(error, std::abs(blocks(i, j, e) - a));
+         }
+      }
+   }
+   REQUIRE(error == MFEM_Approx(0.0));
+}
+
 } // namespace assemblediagonalpa
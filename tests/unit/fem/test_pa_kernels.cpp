@@ -693,6 +693,61 @@ TEST_CASE("PA Diffusion", "[PartialAssembly], [GPU]")
    test_pa_integrator<DiffusionIntegrator>();
 } // PA Diffusion test case
 
+template <typename INTEGRATOR>
+static void test_pa_nontensor_integrator(const char *fname)
+{
+   const bool all_tests = launch_all_non_regression_tests;
+   auto order = !all_tests ? GENERATE(1, 2) : GENERATE(1, 2, 3);
+   CAPTURE(fname, order);
+
+   Mesh mesh(fname);
+   if (mesh.GetNE() < 16) { mesh.UniformRefinement(); }
+   const int dim = mesh.Dimension();
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   GridFunction x(&fes), y_fa(&fes), y_pa(&fes);
+   x.Randomize(1);
+   FunctionCoefficient coeff(f1);
+
+   BilinearForm blf_fa(&fes);
+   blf_fa.AddDomainIntegrator(new INTEGRATOR(coeff));
+   blf_fa.Assemble();
+   blf_fa.Finalize();
+   blf_fa.Mult(x, y_fa);
+
+   BilinearForm blf_pa(&fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_pa.AddDomainIntegrator(new INTEGRATOR(coeff));
+   blf_pa.Assemble();
+   blf_pa.Mult(x, y_pa);
+
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0));
+
+   Vector diag_fa(fes.GetVSize()), diag_pa(fes.GetVSize());
+   blf_fa.SpMat().GetDiag(diag_fa);
+   blf_pa.AssembleDiagonal(diag_pa);
+   diag_pa -= diag_fa;
+   REQUIRE(diag_pa.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("PA Simplex and Mixed Meshes", "[PartialAssembly], [GPU]")
+{
+   auto fname = GENERATE("../../data/square-disc.mesh",
+                         "../../data/square-disc-p2.mesh",
+                         "../../data/star-mixed.mesh",
+                         "../../data/escher.mesh",
+                         "../../data/beam-wedge.mesh",
+                         "../../data/fichera-mixed.mesh");
+
+   SECTION("Mass") { test_pa_nontensor_integrator<MassIntegrator>(fname); }
+   SECTION("Diffusion")
+   {
+      test_pa_nontensor_integrator<DiffusionIntegrator>(fname);
+   }
+}
+
 TEST_CASE("PA Markers", "[PartialAssembly], [GPU]")
 {
    const bool all_tests = launch_all_non_regression_tests;
@@ -924,6 +979,100 @@ TEST_CASE("PA DG Diffusion", "[PartialAssembly], [GPU]")
    test_dg_diffusion<SymmetricMatrixConstantCoefficient>(fes);
 }
 
+TEST_CASE("PA DG Diffusion Nonconforming", "[PartialAssembly], [GPU]")
+{
+   const auto mesh_fname = GENERATE("../../data/star.mesh",
+                                    "../../data/star-q3.mesh",
+                                    "../../data/fichera.mesh");
+   const int order = GENERATE(1, 2);
+   CAPTURE(order, mesh_fname);
+
+   Mesh mesh = Mesh::LoadFromFile(mesh_fname);
+   const int dim = mesh.Dimension();
+   mesh.EnsureNCMesh();
+   srand(0);
+   mesh.RandomRefinement(0.5);
+
+   DG_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   test_dg_diffusion<ConstantCoefficient>(fes);
+   test_dg_diffusion<MatrixConstantCoefficient>(fes);
+}
+
+template <typename FES = FiniteElementSpace>
+void test_dg_elasticity(FES &fes, const real_t alpha)
+{
+   using GF_t = typename ParTypeHelper<FES>::GF_t;
+   using BLF_t = typename ParTypeHelper<FES>::BLF_t;
+
+   GF_t x(&fes), y_fa(&fes), y_pa(&fes);
+   x.Randomize(1);
+
+   ConstantCoefficient lambda(2.0);
+   FunctionCoefficient mu([](const Vector &xvec)
+   {
+      return 1.0 + xvec(0)*xvec(0);
+   });
+   const real_t kappa = 10.0;
+
+   IntegrationRules irs(0, Quadrature1D::GaussLobatto);
+   const IntegrationRule &ir = irs.Get(fes.GetMesh()->GetTypicalFaceGeometry(),
+                                       2*fes.GetMaxElementOrder());
+
+   auto add_integrators = [&](BLF_t &blf)
+   {
+      blf.AddInteriorFaceIntegrator(
+         new DGElasticityIntegrator(lambda, mu, alpha, kappa));
+      blf.AddBdrFaceIntegrator(
+         new DGElasticityIntegrator(lambda, mu, alpha, kappa));
+      (*blf.GetFBFI())[0]->SetIntegrationRule(ir);
+      (*blf.GetBFBFI())[0]->SetIntegrationRule(ir);
+   };
+
+   BLF_t blf_fa(&fes);
+   add_integrators(blf_fa);
+   blf_fa.Assemble();
+   blf_fa.Finalize();
+   blf_fa.Mult(x, y_fa);
+
+   BLF_t blf_pa(&fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   add_integrators(blf_pa);
+   blf_pa.Assemble();
+   blf_pa.Mult(x, y_pa);
+
+   y_fa -= y_pa;
+
+   REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("PA DG Elasticity", "[PartialAssembly], [GPU]")
+{
+   const auto mesh_fname = GENERATE("../../data/star.mesh",
+                                    "../../data/star-q3.mesh",
+                                    "../../data/fichera.mesh",
+                                    "../../data/fichera-q3.mesh");
+   const int order = GENERATE(1, 2);
+   const bool nonconforming = GENERATE(false, true);
+   const real_t alpha = GENERATE(-1.0, 1.0);
+   CAPTURE(order, mesh_fname, nonconforming, alpha);
+
+   Mesh mesh = Mesh::LoadFromFile(mesh_fname);
+   const int dim = mesh.Dimension();
+   if (nonconforming)
+   {
+      mesh.EnsureNCMesh();
+      srand(0);
+      mesh.RandomRefinement(0.5);
+   }
+
+   DG_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec, dim);
+
+   test_dg_elasticity(fes, alpha);
+}
+
 #ifdef MFEM_USE_MPI
 
 TEST_CASE("Parallel PA DG Diffusion", "[PartialAssembly][Parallel][GPU]")
@@ -0,0 +1,85 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("PMultigridSolver", "[PMultigridSolver][Multigrid]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(3, 4);
+   CAPTURE(dim, order);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL, true) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = 1;
+   ConstantCoefficient one(1.0), mass_coeff(0.1);
+   auto add_integrators = [&](BilinearForm &a)
+   {
+      a.AddDomainIntegrator(new DiffusionIntegrator(one));
+      a.AddDomainIntegrator(new MassIntegrator(mass_coeff));
+   };
+
+   PMultigridSolver mg(fes, ess_bdr, add_integrators);
+   // Orders p, p/2, ..., 1
+   REQUIRE(mg.NumLevels() == (order == 4 ? 3 : 2));
+   for (int level = 1; level < mg.NumLevels(); level++)
+   {
+      REQUIRE(mg.GetMaxEigenvalueEstimate(level) > 1.0);
+   }
+
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+   GridFunction x(&fes);
+   x = 0.0;
+
+   OperatorPtr A;
+   Vector B, X;
+   mg.FormFineLinearSystem(x, b, A, X, B);
+   REQUIRE(A->Height() == fes.GetTrueVSize());
+
+   CGSolver cg;
+   cg.SetRelTol(1e-10);
+   cg.SetMaxIter(100);
+   cg.SetPrintLevel(-1);
+   cg.SetOperator(*A);
+   cg.SetPreconditioner(mg);
+   cg.Mult(B, X);
+   REQUIRE(cg.GetConverged());
+   REQUIRE(cg.GetNumIterations() < 30);
+   mg.RecoverFineFEMSolution(X, b, x);
+
+   // Compare with the solution obtained with the assembled matrix
+   Array<int> ess_tdof_list;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+   BilinearForm a_fa(&fes);
+   add_integrators(a_fa);
+   a_fa.Assemble();
+   GridFunction x_fa(&fes);
+   x_fa = 0.0;
+   OperatorPtr A_fa;
+   a_fa.FormLinearSystem(ess_tdof_list, x_fa, b, A_fa, X, B);
+   GSSmoother gs((SparseMatrix&)(*A_fa));
+   X = 0.0;
+   PCG(*A_fa, gs, B, X, 0, 2000, 1e-24, 0.0);
+   a_fa.RecoverFEMSolution(X, b, x_fa);
+
+   x_fa -= x;
+   REQUIRE(x_fa.Normlinf() == MFEM_Approx(0.0, 1e-8));
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+#include <random>
+
+using namespace mfem;
+
+namespace
+{
+
+struct Item2 : public Hashed2 { int value; };
+struct OpenItem2 : public OpenHashed2 { int value; };
+struct Item4 : public Hashed4 { int value; };
+struct OpenItem4 : public OpenHashed4 { int value; };
+
+// Apply the same random sequence of operations to a HashTable and to an
+// OpenHashTable, which must always return the same ids.
+template <typename T, typename OT, int NK>
+void CompareHashTables(int nops, int max_key)
+{
+   HashTable<T> ht(64, 16);
+   OpenHashTable<OT> oht(64, 16);
+
+   std::mt19937 gen(42);
+   std::uniform_int_distribution<int> key(0, max_key), op(0, 9);
+
+   auto rand_key = [&](int k[4])
+   {
+      for (int i = 0; i < 4; i++) { k[i] = (i < NK) ? key(gen) : -1; }
+   };
+   auto get = [&](auto &table, const int k[4])
+   {
+      if constexpr (NK == 2) { return table.GetId(k[0], k[1]); }
+      else { return table.GetId(k[0], k[1], k[2], k[3]); }
+   };
+   auto find = [&](const auto &table, const int k[4])
+   {
+      if constexpr (NK == 2) { return table.FindId(k[0], k[1]); }
+      else { return table.FindId(k[0], k[1], k[2], k[3]); }
+   };
+
+   for (int n = 0; n < nops; n++)
+   {
+      int k[4];
+      rand_key(k);
+      const int o = op(gen);
+      if (o < 5)
+      {
+         const int id = get(ht, k);
+         REQUIRE(get(oht, k) == id);
+         ht[id].value = oht[id].value = n;
+      }
+      else if (o < 7)
+      {
+         const int id = find(ht, k);
+         REQUIRE(find(oht, k) == id);
+         if (id >= 0)
+         {
+            REQUIRE(oht[id].value == ht[id].value);
+            ht.Delete(id);
+            oht.Delete(id);
+         }
+      }
+      else if (o < 8)
+      {
+         const int id = find(ht, k);
+         REQUIRE(find(oht, k) == id);
+         int nk[4];
+         rand_key(nk);
+         if (id >= 0 && find(ht, nk) < 0)
+         {
+            if constexpr (NK == 2)
+            {
+               ht.Reparent(id, nk[0], nk[1]);
+               oht.Reparent(id, nk[0], nk[1]);
+            }
+            else
+            {
+               ht.Reparent(id, nk[0], nk[1], nk[2], nk[3]);
+               oht.Reparent(id, nk[0], nk[1], nk[2], nk[3]);
+            }
+            REQUIRE(find(oht, nk) == id);
+            REQUIRE(find(oht, k) < 0);
+         }
+      }
+      else
+      {
+         const int id = find(ht, k);
+         REQUIRE(find(oht, k) == id);
+         if (id >= 0) { REQUIRE(oht[id].value == ht[id].value); }
+      }
+      REQUIRE(oht.Size() == ht.Size());
+      REQUIRE(oht.NumIds() == ht.NumIds());
+   }
+
+   // the iterators must visit the same items
+   int count = 0;
+   for (auto it = oht.cbegin(); it != oht.cend(); ++it, ++count)
+   {
+      REQUIRE(ht.IdExists(it.index()));
+      REQUIRE(it->value == ht[it.index()].value);
+   }
+   REQUIRE(count == ht.Size());
+
+   // a copy must find the same items
+   OpenHashTable<OT> copy(oht);
+   REQUIRE(copy.Size() == ht.Size());
+   for (int n = 0; n < nops/10; n++)
+   {
+      int k[4];
+      rand_key(k);
+      REQUIRE(find(copy, k) == find(ht, k));
+   }
+}
+
+} // namespace
+
+TEST_CASE("OpenHashTable", "[OpenHashTable]")
+{
+   SECTION("Two keys")
+   {
+      CompareHashTables<Item2, OpenItem2, 2>(20000, 150);
+   }
+   SECTION("Three keys")
+   {
+      CompareHashTables<Item4, OpenItem4, 3>(20000, 30);
+   }
+   SECTION("Alloc")
+   {
+      OpenHashTable<OpenItem2> oht(16, 4);
+      for (int id = 20; id >= 0; id -= 2) { oht.Alloc(id, id, id); }
+      oht.UpdateUnused();
+      REQUIRE(oht.Size() == 11);
+      REQUIRE(oht.NumFreeIds() == 10);
+      for (int id = 0; id <= 20; id++)
+      {
+         REQUIRE(oht.IdExists(id) == (id % 2 == 0));
+         REQUIRE(oht.FindId(id, id) == ((id % 2 == 0) ? id : -1));
+      }
+      // new items reuse the unused ids
+      const int id = oht.GetId(3, 5);
+      REQUIRE(id % 2 == 1);
+      REQUIRE(oht.FindId(5, 3) == id);
+   }
+}
@@ -363,7 +363,8 @@ TEST_CASE("Batched Linear Algebra",
 {
    auto backend = GENERATE(BatchedLinAlg::NATIVE,
                            BatchedLinAlg::GPU_BLAS,
-                           BatchedLinAlg::MAGMA);
+                           BatchedLinAlg::MAGMA,
+                           BatchedLinAlg::INTERLEAVED);
    // Skip unavailable backends
    if (!BatchedLinAlg::IsAvailable(backend)) { return; }
    CAPTURE(backend);
@@ -494,6 +495,248 @@ TEST_CASE("Batched Linear Algebra",
    }
 }
 
+TEST_CASE("Batched Cholesky, QR and Eigensystem",
+          "[DenseMatrix][GPU]")
+{
+   auto backend = GENERATE(BatchedLinAlg::NATIVE,
+                           BatchedLinAlg::GPU_BLAS,
+                           BatchedLinAlg::MAGMA,
+                           BatchedLinAlg::INTERLEAVED);
+   // Skip unavailable backends
+   if (!BatchedLinAlg::IsAvailable(backend)) { return; }
+   CAPTURE(backend);
+
+   const int n = 5;
+   const int n_mat = 4;
+   const int n_rhs = 2;
+   const real_t tol = 1e-10;
+
+   int seed = 1;
+   std::vector<DenseMatrix> As;
+   DenseTensor A_batch(n, n, n_mat);
+   for (int i = 0; i < n_mat; ++i)
+   {
+      DenseMatrix B(n);
+      for (int j = 0; j < n; ++j)
+      {
+         Vector col;
+         B.GetColumnReference(j, col);
+         col.Randomize(seed++);
+      }
+      As.emplace_back(n);
+      MultAAt(B, As.back());
+      for (int j = 0; j < n; ++j) { As.back()(j, j) += 1.0; } // Ensure SPD
+      A_batch(i) = As.back();
+   }
+
+   SECTION("Cholesky")
+   {
+      Vector x_batch(n * n_rhs * n_mat);
+      x_batch.Randomize(seed++);
+      Vector b_batch(x_batch);
+
+      BatchedLinAlg::Get(backend).CholeskyFactor(A_batch);
+      BatchedLinAlg::Get(backend).CholeskySolve(A_batch, x_batch);
+      x_batch.HostReadWrite();
+      A_batch.HostReadWrite();
+      for (int i = 0; i < n_mat; ++i)
+      {
+         // Check that L L^T = A
+         DenseMatrix LLt(n);
+         MultAAt(A_batch(i), LLt);
+         LLt -= As[i];
+         REQUIRE(LLt.MaxMaxNorm() == MFEM_Approx(0.0, tol));
+         // Check that A x = b
+         for (int j = 0; j < n_rhs; ++j)
+         {
+            Vector x(x_batch.GetData() + j*n + i*n*n_rhs, n);
+            Vector b(b_batch.GetData() + j*n + i*n*n_rhs, n);
+            Vector r(n);
+            As[i].Mult(x, r);
+            r -= b;
+            REQUIRE(r.Normlinf() == MFEM_Approx(0.0, tol));
+         }
+      }
+
+      // Check the Cholesky mode of BatchedDirectSolver
+      Vector y_batch(x_batch.Size());
+      for (int i = 0; i < n_mat; ++i) { A_batch(i) = As[i]; }
+      BatchedDirectSolver solver(A_batch, BatchedDirectSolver::CHOLESKY,
+                                 backend);
+      solver.Mult(b_batch, y_batch);
+      y_batch -= x_batch;
+      REQUIRE(y_batch.Normlinf() == MFEM_Approx(0.0, tol));
+   }
+
+   SECTION("QR")
+   {
+      const int m = n + 2;
+      DenseTensor QR_batch(m, n, n_mat);
+      std::vector<DenseMatrix> Bs;
+      for (int i = 0; i < n_mat; ++i)
+      {
+         Bs.emplace_back(m, n);
+         for (int j = 0; j < n; ++j)
+         {
+            Vector col;
+            Bs.back().GetColumnReference(j, col);
+            col.Randomize(seed++);
+         }
+         QR_batch(i) = Bs.back();
+      }
+      Vector x_batch(m * n_rhs * n_mat);
+      x_batch.Randomize(seed++);
+      Vector b_batch(x_batch);
+
+      Vector tau;
+      BatchedLinAlg::Get(backend).QRFactor(QR_batch, tau);
+      BatchedLinAlg::Get(backend).QRSolve(QR_batch, tau, x_batch);
+      x_batch.HostReadWrite();
+      for (int i = 0; i < n_mat; ++i)
+      {
+         for (int j = 0; j < n_rhs; ++j)
+         {
+            // Check the normal equations B^T (B x - b) = 0
+            Vector x(x_batch.GetData() + j*m + i*m*n_rhs, n);
+            Vector b(b_batch.GetData() + j*m + i*m*n_rhs, m);
+            Vector r(m), Btr(n);
+            Bs[i].Mult(x, r);
+            r -= b;
+            Bs[i].MultTranspose(r, Btr);
+            REQUIRE(Btr.Normlinf() == MFEM_Approx(0.0, tol));
+         }
+      }
+   }
+
+   SECTION("Eigensystem")
+   {
+      Vector lambda;
+      DenseTensor V;
+      BatchedLinAlg::Get(backend).SymmetricEigensystem(A_batch, lambda, V);
+      lambda.HostRead();
+      V.HostRead();
+      for (int i = 0; i < n_mat; ++i)
+      {
+         DenseMatrix AV(n), VtV(n);
+         Mult(As[i], V(i), AV);
+         MultAtB(V(i), V(i), VtV);
+         for (int j = 0; j < n; ++j)
+         {
+            const real_t lambda_j = lambda[j + i*n];
+            if (j > 0) { REQUIRE(lambda[j - 1 + i*n] <= lambda_j); }
+            for (int k = 0; k < n; ++k)
+            {
+               REQUIRE(AV(k, j) == MFEM_Approx(lambda_j*V(i)(k, j), tol));
+               REQUIRE(VtV(k, j) == MFEM_Approx(k == j ? 1.0 : 0.0, tol));
+            }
+         }
+      }
+   }
+}
+
+TEST_CASE("Batched Interleaved Layout", "[DenseMatrix]")
+{
+   const auto &native = BatchedLinAlg::Get(BatchedLinAlg::NATIVE);
+   const auto &interleaved = BatchedLinAlg::Get(BatchedLinAlg::INTERLEAVED);
+
+   const int n = GENERATE(1, 3, 6);
+   // Not a multiple of the number of lanes
+   const int n_mat = 2*InterleavedBatchedLinAlg::lanes + 3;
+   const int n_rhs = 2;
+   CAPTURE(n);
+
+   DenseTensor A(n, n, n_mat);
+   Vector A_vec(A.Data(), A.TotalSize());
+   A_vec.Randomize(1);
+   for (int i = 0; i < n_mat; ++i)
+   {
+      for (int j = 0; j < n; ++j) { A(j, j, i) += n; } // Ensure invertible
+   }
+
+   auto check_equal = [](const Vector &x, const Vector &y)
+   {
+      REQUIRE(x.Size() == y.Size());
+      for (int i = 0; i < x.Size(); ++i)
+      {
+         REQUIRE(x[i] == MFEM_Approx(y[i], 1e-10));
+      }
+   };
+
+   // Conversion round-trip
+   Vector A_il;
+   InterleavedBatchedLinAlg::Interleave(A, A_il);
+   REQUIRE(A_il.Size() % (n*n*InterleavedBatchedLinAlg::lanes) == 0);
+   DenseTensor A2(n, n, n_mat);
+   InterleavedBatchedLinAlg::Deinterleave(A_il, A2);
+   check_equal(Vector(A2.Data(), A2.TotalSize()), A_vec);
+
+   Vector x(n*n_rhs*n_mat);
+   x.Randomize(2);
+
+   SECTION("Mult")
+   {
+      for (auto op : {BatchedLinAlg::Op::N, BatchedLinAlg::Op::T})
+      {
+         Vector y1(x.Size()), y2(x.Size());
+         y1.Randomize(3);
+         y2 = y1;
+         native.AddMult(A, x, y1, 1.5, 0.5, op);
+         interleaved.AddMult(A, x, y2, 1.5, 0.5, op);
+         check_equal(y2, y1);
+      }
+   }
+
+   SECTION("LU")
+   {
+      DenseTensor LU1 = A, LU2 = A;
+      Array<int> P1, P2;
+      native.LUFactor(LU1, P1);
+      interleaved.LUFactor(LU2, P2);
+      for (int i = 0; i < P1.Size(); ++i) { REQUIRE(P1[i] == P2[i]); }
+      check_equal(Vector(LU2.Data(), LU2.TotalSize()),
+                  Vector(LU1.Data(), LU1.TotalSize()));
+
+      Vector x1(x), x2(x);
+      native.LUSolve(LU1, P1, x1);
+      interleaved.LUSolve(LU2, P2, x2);
+      check_equal(x2, x1);
+   }
+
+   SECTION("Inverse and determinant")
+   {
+      DenseTensor inv1 = A, inv2 = A;
+      native.Invert(inv1);
+      interleaved.Invert(inv2);
+      check_equal(Vector(inv2.Data(), inv2.TotalSize()),
+                  Vector(inv1.Data(), inv1.TotalSize()));
+
+      Vector det1, det2;
+      native.Det(A, det1);
+      interleaved.Det(A, det2);
+      check_equal(det2, det1);
+      for (int i = 0; i < n_mat; ++i)
+      {
+         REQUIRE(det1[i] == MFEM_Approx(A(i).Det(), 1e-10));
+      }
+   }
+
+   SECTION("Cholesky")
+   {
+      DenseTensor L1(n, n, n_mat), L2;
+      for (int i = 0; i < n_mat; ++i) { MultAAt(A(i), L1(i)); }
+      L2 = L1;
+      native.CholeskyFactor(L1);
+      interleaved.CholeskyFactor(L2);
+      check_equal(Vector(L2.Data(), L2.TotalSize()),
+                  Vector(L1.Data(), L1.TotalSize()));
+
+      Vector x1(x), x2(x);
+      native.CholeskySolve(L1, x1);
+      interleaved.CholeskySolve(L2, x2);
+      check_equal(x2, x1);
+   }
+}
+
 TEST_CASE("DenseTensor copy", "[DenseMatrix][DenseTensor]")
 {
    DenseTensor t1(2,3,4);
@@ -305,6 +305,24 @@ TEST_CASE("First order ODE methods", "[ODE]")
       REQUIRE(check.order(new RK8Solver) + tol > 8.0);
    }
 
+   SECTION("LowStorageRK3Solver")
+   {
+      mfem::out<<"LowStorageRK3Solver"<<std::endl;
+      REQUIRE(check.order(new LowStorageRK3Solver) + tol > 3.0);
+   }
+
+   SECTION("LowStorageRK4Solver")
+   {
+      mfem::out<<"LowStorageRK4Solver"<<std::endl;
+      REQUIRE(check.order(new LowStorageRK4Solver) + tol > 4.0);
+   }
+
+   SECTION("SSPRK104Solver")
+   {
+      mfem::out<<"SSPRK104Solver"<<std::endl;
+      REQUIRE(check.order(new SSPRK104Solver) + tol > 4.0);
+   }
+
    SECTION("ImplicitMidpointSolver")
    {
       mfem::out<<"ImplicitMidpoint"<<std::endl;
@@ -474,3 +492,174 @@ TEST_CASE("First order ODE methods", "[ODE]")
    }
 
 }
+
+TEST_CASE("Adaptive ODE methods", "[ODE]")
+{
+   // Harmonic oscillator, du/dt = -A u, with exact solution u(3 pi) = -u(0).
+   class ODE : public TimeDependentOperator
+   {
+   protected:
+      DenseMatrix A, T;
+   public:
+      ODE() : TimeDependentOperator(2, (real_t) 0.0), A(2), T(2)
+      {
+         A(0,0) = 0.0;  A(0,1) = 1.0;
+         A(1,0) = -1.0; A(1,1) = 0.0;
+      }
+
+      void Mult(const Vector &u, Vector &dudt) const override
+      {
+         A.Mult(u, dudt);
+         dudt.Neg();
+      }
+
+      void ImplicitSolve(const real_t dt, const Vector &u,
+                         Vector &dudt) override
+      {
+         // Solve (I + dt A) dudt = -A u
+         Vector r(2);
+         A.Mult(u, r);
+         r.Neg();
+         T = A;
+         T *= dt;
+         T(0,0) += 1.0;
+         T(1,1) += 1.0;
+         T.Invert();
+         T.Mult(r, dudt);
+      }
+   };
+
+   auto make_solver = [](int type) -> AdaptiveODESolver*
+   {
+      switch (type)
+      {
+         case 0: return new BogackiShampine32Solver;
+         case 1: return new DormandPrince54Solver;
+         case 2: return new EmbeddedSDIRK22Solver;
+         default: return new EmbeddedSDIRK54Solver;
+      }
+   };
+
+   const int type = GENERATE(0, 1, 2, 3);
+   CAPTURE(type);
+
+   ODE oper;
+   const real_t t_final = 3*M_PI;
+   Vector u0(2);
+   u0 = 1.0;
+
+   real_t prev_error = infinity();
+   int prev_steps = 0;
+   for (real_t tol : {1e-4, 1e-6, 1e-8})
+   {
+      std::unique_ptr<AdaptiveODESolver> ode_solver(make_solver(type));
+      ode_solver->SetTolerances(tol, tol);
+      ode_solver->Init(oper);
+
+      Vector u(u0);
+      real_t t = 0.0;
+      // Large initial step size, forces rejected steps
+      real_t dt = t_final;
+      ode_solver->Run(u, t, dt, t_final);
+      REQUIRE(t == t_final);
+      REQUIRE(ode_solver->GetNumRejectedSteps() > 0);
+
+      u += u0;
+      const real_t error = u.Normlinf();
+      const int steps = ode_solver->GetNumAcceptedSteps();
+      mfem::out << "tol = " << tol << ", error = " << error
+                << ", steps = " << steps << std::endl;
+
+      // The global error is proportional to the tolerance
+      REQUIRE(error < 100*tol);
+      REQUIRE(error < prev_error);
+      REQUIRE(steps > prev_steps);
+      prev_error = error;
+      prev_steps = steps;
+   }
+}
+
+TEST_CASE("Parallel-in-time ODE integration", "[ODE]")
+{
+   // Linear decay, du/dt = -A u, with A symmetric positive definite.
+   class ODE : public TimeDependentOperator
+   {
+   protected:
+      DenseMatrix A, T;
+   public:
+      ODE() : TimeDependentOperator(2, (real_t) 0.0), A(2), T(2)
+      {
+         A(0,0) = 2.0;  A(0,1) = -1.0;
+         A(1,0) = -1.0; A(1,1) = 2.0;
+      }
+
+      void Mult(const Vector &u, Vector &dudt) const override
+      {
+         A.Mult(u, dudt);
+         dudt.Neg();
+      }
+
+      void ImplicitSolve(const real_t dt, const Vector &u,
+                         Vector &dudt) override
+      {
+         // Solve (I + dt A) dudt = -A u
+         Vector r(2);
+         A.Mult(u, r);
+         r.Neg();
+         T = A;
+         T *= dt;
+         T(0,0) += 1.0;
+         T(1,1) += 1.0;
+         T.Invert();
+         T.Mult(r, dudt);
+      }
+   };
+
+   ODE oper;
+   const int slices = 16, fine_steps = 10;
+   const real_t t_final = 2.0;
+   Vector u0(2);
+   u0(0) = 1.0;
+   u0(1) = -0.5;
+
+   // Sequential fine solution
+   RK4Solver fine;
+   fine.Init(oper);
+   Vector u_fine(u0);
+   real_t t = 0.0, dt = t_final/(slices*fine_steps);
+   for (int i = 0; i < slices*fine_steps; i++) { fine.Step(u_fine, t, dt); }
+
+   SDIRK23Solver coarse;
+   int iters[2];
+   for (auto type : { ParallelInTimeSolver::PARAREAL,
+                      ParallelInTimeSolver::MGRIT })
+   {
+      ParallelInTimeSolver pint(fine, coarse, type);
+      pint.SetSlices(slices);
+      pint.SetFineSteps(fine_steps);
+      pint.Init(oper);
+
+      // Without tolerance, the iteration reproduces the fine solution after
+      // (at most) one iteration per slice.
+      pint.SetTolerance(0.0);
+      Vector u(u0);
+      t = 0.0;
+      dt = t_final;
+      pint.Step(u, t, dt);
+      REQUIRE(t == MFEM_Approx(t_final));
+      REQUIRE(pint.GetNumIterations() <= slices);
+      u -= u_fine;
+      REQUIRE(u.Normlinf() < 1e-13);
+
+      pint.SetTolerance(1e-8);
+      u = u0;
+      t = 0.0;
+      pint.Step(u, t, dt);
+      iters[type] = pint.GetNumIterations();
+      REQUIRE(iters[type] < slices);
+      u -= u_fine;
+      REQUIRE(u.Normlinf() < 1e-7);
+   }
+   REQUIRE(iters[ParallelInTimeSolver::MGRIT] <=
+           iters[ParallelInTimeSolver::PARAREAL]);
+}
@@ -146,6 +146,144 @@ TEST_CASE("Gecko integration in MFEM", "[Mesh]")
    }
 }
 
+TEST_CASE("Sort-based topology", "[Mesh]")
+{
+   auto mesh_fname = GENERATE("../../data/star.mesh",
+                              "../../data/inline-tri.mesh",
+                              "../../data/escher.mesh",
+                              "../../data/fichera-mixed.mesh",
+                              "../../data/beam-wedge.mesh",
+                              "../../data/inline-pyramid.mesh",
+                              "periodic");
+   CAPTURE(mesh_fname);
+
+   auto make_mesh = [&](bool sort_based)
+   {
+      const bool old_sort_based = Mesh::sort_based_topology;
+      Mesh::sort_based_topology = sort_based;
+      Mesh mesh;
+      if (std::string(mesh_fname) == "periodic")
+      {
+         Mesh orig = Mesh::MakeCartesian3D(3, 3, 3, Element::HEXAHEDRON);
+         std::vector<Vector> translations =
+         {
+            Vector({1.0, 0.0, 0.0}), Vector({0.0, 1.0, 0.0})
+         };
+         mesh = Mesh::MakePeriodic(
+                   orig, orig.CreatePeriodicVertexMapping(translations));
+      }
+      else
+      {
+         mesh = Mesh::LoadFromFile(mesh_fname);
+      }
+      mesh.UniformRefinement();
+      Mesh::sort_based_topology = old_sort_based;
+      return mesh;
+   };
+   Mesh mesh_sort = make_mesh(true), mesh_hash = make_mesh(false);
+
+   auto check_table = [](const Table &t1, const Table &t2)
+   {
+      REQUIRE(t1.Size() == t2.Size());
+      REQUIRE(t1.Size_of_connections() == t2.Size_of_connections());
+      for (int i = 0; i <= t1.Size(); i++)
+      {
+         REQUIRE(t1.GetI()[i] == t2.GetI()[i]);
+      }
+      for (int k = 0; k < t1.Size_of_connections(); k++)
+      {
+         REQUIRE(t1.GetJ()[k] == t2.GetJ()[k]);
+      }
+   };
+
+   const int dim = mesh_sort.Dimension();
+   REQUIRE(mesh_sort.GetNEdges() == mesh_hash.GetNEdges());
+   REQUIRE(mesh_sort.GetNFaces() == mesh_hash.GetNFaces());
+   check_table(mesh_sort.ElementToEdgeTable(), mesh_hash.ElementToEdgeTable());
+   if (dim == 3)
+   {
+      check_table(mesh_sort.ElementToFaceTable(),
+                  mesh_hash.ElementToFaceTable());
+   }
+   Array<int> edges_sort, edges_hash, cor;
+   for (int i = 0; i < mesh_sort.GetNBE(); i++)
+   {
+      REQUIRE(mesh_sort.GetBdrElementFaceIndex(i) ==
+              mesh_hash.GetBdrElementFaceIndex(i));
+      mesh_sort.GetBdrElementEdges(i, edges_sort, cor);
+      mesh_hash.GetBdrElementEdges(i, edges_hash, cor);
+      REQUIRE(edges_sort == edges_hash);
+   }
+   for (int f = 0; f < mesh_sort.GetNumFaces(); f++)
+   {
+      int e1_sort, e2_sort, e1_hash, e2_hash;
+      mesh_sort.GetFaceElements(f, &e1_sort, &e2_sort);
+      mesh_hash.GetFaceElements(f, &e1_hash, &e2_hash);
+      REQUIRE(e1_sort == e1_hash);
+      REQUIRE(e2_sort == e2_hash);
+   }
+}
+
+TEST_CASE("MakeRefined", "[Mesh]")
+{
+   auto mesh_fname = GENERATE("../../data/star.mesh",
+                              "../../data/inline-tri.mesh",
+                              "../../data/inline-hex.mesh",
+                              "../../data/inline-tet.mesh",
+                              "../../data/beam-wedge.mesh",
+                              "../../data/star-q3.mesh",
+                              "../../data/escher-p3.mesh",
+                              "../../data/fichera-mixed-p2.mesh");
+   const int curvature = GENERATE(0, 2, 3);
+   const int ref_factor = GENERATE(1, 3);
+   CAPTURE(mesh_fname, curvature, ref_factor);
+
+   Mesh orig_mesh(mesh_fname, 1, 1);
+   if (curvature > 0)
+   {
+      // Discontinuous nodes as in periodic meshes for the order 2 case.
+      orig_mesh.SetCurvature(curvature, curvature == 2);
+      orig_mesh.Transform([](const Vector &x, Vector &y)
+      {
+         y = x;
+         y(0) += 0.1*sin(x(1));
+         y(1) += 0.1*x(0)*x(0);
+      });
+   }
+   Mesh mesh = Mesh::MakeRefined(orig_mesh, ref_factor,
+                                 BasisType::GaussLobatto);
+   const int dim = mesh.Dimension();
+   REQUIRE(mesh.GetNE() > 0);
+
+   // The vertices of each refined element are the images of the vertices of
+   // its sub-element in the reference element of its parent.
+   const CoarseFineTransformations &cf = mesh.GetRefinementTransforms();
+   DenseMatrix phys;
+   Array<int> v;
+   real_t max_err = 0.0;
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      const Embedding &emb = cf.embeddings[i];
+      const DenseMatrix &pm = cf.point_matrices[emb.geom](emb.matrix);
+      IntegrationRule ir(pm.Width());
+      for (int k = 0; k < pm.Width(); k++)
+      {
+         ir.IntPoint(k).Set(pm.GetColumn(k), dim);
+      }
+      orig_mesh.GetElementTransformation(emb.parent)->Transform(ir, phys);
+      mesh.GetElementVertices(i, v);
+      for (int k = 0; k < v.Size(); k++)
+      {
+         for (int d = 0; d < mesh.SpaceDimension(); d++)
+         {
+            const real_t err = std::abs(mesh.GetVertex(v[k])[d] - phys(d, k));
+            max_err = std::max(max_err, err);
+         }
+      }
+   }
+   REQUIRE(max_err == MFEM_Approx(0.0));
+}
+
 TEST_CASE("MakeSimplicial", "[Mesh]")
 {
    auto mesh_fname = GENERATE("../../data/star.mesh",
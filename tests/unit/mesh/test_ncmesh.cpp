@@ -182,6 +182,137 @@ TEST_CASE("NCMesh 3D Derefined Volume", "[NCMesh]")
    REQUIRE(derefined_volume == MFEM_Approx(original_volume));
 } // test case
 
+TEST_CASE("NCMesh Batch Refinement", "[NCMesh]")
+{
+   // Refine (and in 3D derefine) a mesh a few times and check that the leaf
+   // elements updated locally by Refine and Derefine are in the same order as
+   // when they are collected from the roots, as done by the copy constructor.
+   const int dim = GENERATE(2, 3);
+   const bool aniso = GENERATE(false, true);
+
+   Mesh mesh = (dim == 2)
+               ? Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL)
+               : Mesh::MakeCartesian3D(3, 3, 3, Element::HEXAHEDRON);
+   mesh.EnsureNCMesh();
+
+   const char types[] = { Refinement::X, Refinement::Y, Refinement::Z,
+                          Refinement::XY, Refinement::XYZ
+                        };
+   auto check_leaves = [&]()
+   {
+      NCMesh copy(*mesh.ncmesh);
+      REQUIRE(copy.GetNVertices() == mesh.GetNV());
+      Array<int> faces, fattr, copy_faces, copy_fattr;
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         REQUIRE(mesh.ncmesh->GetElementDepth(i) == copy.GetElementDepth(i));
+         mesh.ncmesh->GetElementFacesAttributes(i, faces, fattr);
+         copy.GetElementFacesAttributes(i, copy_faces, copy_fattr);
+         for (int j = 0; j < faces.Size(); j++)
+         {
+            REQUIRE(faces[j] == copy_faces[j]);
+         }
+      }
+
+      real_t volume = 0.0;
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         volume += mesh.GetElementVolume(i);
+      }
+      REQUIRE(volume == MFEM_Approx(1.0));
+   };
+
+   for (int it = 0; it < 3; it++)
+   {
+      Array<Refinement> refs;
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         if ((i*7 + it) % 5 == 0)
+         {
+            const char type = aniso ? types[(i + it) % (dim == 2 ? 2 : 5)]
+                              : (dim == 2 ? Refinement::XY : Refinement::XYZ);
+            refs.Append(Refinement(i, type));
+         }
+      }
+      // a repeated refinement of the same element is merged
+      const Refinement first = refs[0];
+      refs.Append(first);
+      mesh.GeneralRefinement(refs);
+      check_leaves();
+   }
+
+   if (dim == 2 || !aniso)
+   {
+      const int ne = mesh.GetNE();
+      Vector elem_error(ne);
+      for (int i = 0; i < ne; i++)
+      {
+         elem_error(i) = (i % 13 == 0) ? 1.0 : 0.0;
+      }
+      REQUIRE(mesh.DerefineByError(elem_error, 0.5));
+      REQUIRE(mesh.GetNE() < ne);
+      check_leaves();
+   }
+} // test case
+
+TEST_CASE("NCMesh Conforming Interpolation", "[NCMesh]")
+{
+   // Refine a mesh a few times, updating the spaces, and check that the
+   // conforming interpolation reproduces polynomials that are in the space,
+   // also when slave DOFs depend on other slave DOFs.
+   const int dim = GENERATE(2, 3);
+   const int order = 3;
+
+   Mesh mesh = (dim == 2)
+               ? Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL)
+               : Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   mesh.EnsureNCMesh();
+
+   H1_FECollection h1_fec(order, dim);
+   ND_FECollection nd_fec(order, dim);
+   FiniteElementSpace h1_fes(&mesh, &h1_fec), nd_fes(&mesh, &nd_fec);
+
+   FunctionCoefficient h1_coeff([](const Vector &x)
+   {
+      return x(0)*x(0)*x(1) - 2.0*x(1)*x(1)*x(1) + x(0);
+   });
+   VectorFunctionCoefficient nd_coeff(dim, [](const Vector &x, Vector &v)
+   {
+      for (int d = 0; d < v.Size(); d++) { v(d) = x(0)*x(1) + d*x(d)*x(d); }
+   });
+
+   auto check_fespace = [](FiniteElementSpace &fes, GridFunction &x)
+   {
+      const SparseMatrix *P = fes.GetConformingProlongation();
+      const SparseMatrix *R = fes.GetConformingRestriction();
+      REQUIRE(P != nullptr);
+      REQUIRE(R != nullptr);
+      Vector tx(R->Height()), y(P->Height());
+      R->Mult(x, tx);
+      P->Mult(tx, y);
+      y -= x;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   };
+
+   for (int it = 0; it < 4; it++)
+   {
+      Array<int> refs;
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         if ((i*3 + it) % 4 == 0) { refs.Append(i); }
+      }
+      mesh.GeneralRefinement(refs, 1);
+      h1_fes.Update(false);
+      nd_fes.Update(false);
+
+      GridFunction h1_x(&h1_fes), nd_x(&nd_fes);
+      h1_x.ProjectCoefficient(h1_coeff);
+      nd_x.ProjectCoefficient(nd_coeff);
+      check_fespace(h1_fes, h1_x);
+      check_fespace(nd_fes, nd_x);
+   }
+} // test case
+
 
 #ifdef MFEM_USE_MPI
 
@@ -541,6 +541,89 @@ TEST_CASE("InterfaceTransferSolve", "[SubMesh]")
    CHECK((x_sub.Norml2() / x_sub.Size()) == MFEM_Approx(0.0, 1e-7, 1e-7));
 }
 
+TEST_CASE("BatchedTransfer", "[SubMesh]")
+{
+   // The batched transfer of several fields must match the transfer of each
+   // field, including the correction of the parent face orientations.
+   auto fec_type = GENERATE(FECType::H1, FECType::ND, FECType::RT);
+   auto from = GENERATE(SubMesh::From::Domain, SubMesh::From::Boundary);
+   CAPTURE(int(fec_type), int(from));
+
+   Mesh mesh = Mesh::MakeCartesian3D(2, 2, 2, Element::TETRAHEDRON);
+   Vector center;
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      mesh.GetElementCenter(i, center);
+      mesh.SetAttribute(i, (center(0) < 0.5) ? 1 : 2);
+   }
+   mesh.SetAttributes();
+   Array<int> attributes(1);
+   attributes[0] = 1;
+   SubMesh submesh = (from == SubMesh::From::Domain) ?
+                     SubMesh::CreateFromDomain(mesh, attributes) :
+                     SubMesh::CreateFromBoundary(mesh, attributes);
+
+   const int order = 2, nf = 3;
+   std::unique_ptr<FiniteElementCollection> fec(
+      create_fec(fec_type, order, 3));
+   std::unique_ptr<FiniteElementCollection> sub_fec(
+      create_fec(fec_type, order, submesh.Dimension()));
+   FiniteElementSpace fes(&mesh, fec.get());
+   FiniteElementSpace sub_fes(&submesh, sub_fec.get());
+
+   std::vector<GridFunction> parent_gf, sub_gf, parent_ref, sub_ref;
+   for (int f = 0; f < nf; f++)
+   {
+      parent_gf.emplace_back(&fes);
+      parent_gf[f].Randomize(f + 1);
+      parent_ref.emplace_back(parent_gf[f]);
+      sub_gf.emplace_back(&sub_fes);
+      sub_gf[f].Randomize(f + 11);
+      sub_ref.emplace_back(sub_gf[f]);
+   }
+
+   auto Check = [&](const std::vector<GridFunction> &x,
+                    const std::vector<GridFunction> &x_ref)
+   {
+      for (int f = 0; f < nf; f++)
+      {
+         Vector diff(x[f]);
+         diff -= x_ref[f];
+         REQUIRE(diff.Normlinf() == MFEM_Approx(0.0));
+      }
+   };
+
+   SECTION("ParentToSubMesh")
+   {
+      TransferMap map(fes, sub_fes);
+      Array<const GridFunction*> src(nf);
+      Array<GridFunction*> dst(nf);
+      for (int f = 0; f < nf; f++)
+      {
+         map.Transfer(parent_gf[f], sub_ref[f]);
+         src[f] = &parent_gf[f];
+         dst[f] = &sub_gf[f];
+      }
+      map.Transfer(src, dst);
+      Check(sub_gf, sub_ref);
+   }
+
+   SECTION("SubMeshToParent")
+   {
+      TransferMap map(sub_fes, fes);
+      Array<const GridFunction*> src(nf);
+      Array<GridFunction*> dst(nf);
+      for (int f = 0; f < nf; f++)
+      {
+         map.Transfer(sub_gf[f], parent_ref[f]);
+         src[f] = &sub_gf[f];
+         dst[f] = &parent_gf[f];
+      }
+      map.Transfer(src, dst);
+      Check(parent_gf, parent_ref);
+   }
+}
+
 /**
  * @brief Helper class for testing a NCMesh
  *